@@ -105,6 +105,9 @@ function(ie_add_plugin)
     if(TARGET inference_engine_ir_v7_reader)
         add_dependencies(${IE_PLUGIN_NAME} inference_engine_ir_v7_reader)
     endif()
+    if(TARGET inference_engine_ir_binary_reader)
+        add_dependencies(${IE_PLUGIN_NAME} inference_engine_ir_binary_reader)
+    endif()
     if(TARGET inference_engine_onnx_reader)
         add_dependencies(${IE_PLUGIN_NAME} inference_engine_onnx_reader)
     endif()
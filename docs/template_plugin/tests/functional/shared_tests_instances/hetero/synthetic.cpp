@@ -22,4 +22,19 @@ INSTANTIATE_TEST_CASE_P(nightly_RandomMajorNodes, HeteroSyntheticTest,
                                 ::testing::Values(std::vector<PluginParameter>{{"TEMPLATE0", "templatePlugin"}, {"TEMPLATE1", "templatePlugin"}}),
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_randomMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_MinLatency, HeteroSyntheticMinLatencyTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"TEMPLATE0", "templatePlugin"}, {"TEMPLATE1", "templatePlugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticMinLatencyTest::_withoutAffinityFunctions)),
+                        HeteroSyntheticTest::getTestCaseName);
+
+#ifdef ENABLE_MKL_DNN
+INSTANTIATE_TEST_CASE_P(smoke_MinLatencyWithCPU, HeteroSyntheticMinLatencyTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"TEMPLATE", "templatePlugin"}, {"CPU", "MKLDNNPlugin"}},
+                                                  std::vector<PluginParameter>{{"CPU", "MKLDNNPlugin"}, {"TEMPLATE", "templatePlugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticMinLatencyTest::_withoutAffinityFunctions)),
+                        HeteroSyntheticTest::getTestCaseName);
+#endif
 }  // namespace
@@ -0,0 +1,17 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_latency_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+#ifdef ENABLE_MKL_DNN
+const std::vector<DevicesNames> device_names_with_cpu {
+        {CPU, CommonTestUtils::DEVICE_TEMPLATE},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_MultiLatencyCPUTemplate, MultiDevice_Test,
+        ::testing::ValuesIn(device_names_with_cpu), MultiDevice_Test::getTestCaseName);
+#endif
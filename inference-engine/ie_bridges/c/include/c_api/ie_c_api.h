@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -298,6 +299,15 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_completion
+ * @brief Represents a record about finished asynchronous infer request
+ */
+typedef struct ie_completion {
+    void *user_data;  //!< A user data passed to ie_infer_request_set_completion_queue
+    IEStatusCode status;  //!< A status of the finished inference
+} ie_completion_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -638,6 +648,20 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_infer_async(i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_set_completion_callback(ie_infer_request_t *infer_request, ie_complete_call_back_t *callback);
 
+/**
+ * @brief Attaches the infer request to a completion queue. Every asynchronous inference posts a completion
+ * with user_data and the inference status into the queue. Replaces the completion callback set before.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance. Several requests can share one queue.
+ * @param user_data A value to identify the request in completions.
+ * @param inline_completion If non-zero, the completion is posted directly from the thread which finished inference
+ * instead of being passed to the callback executor of the plugin.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request,
+        ie_completion_queue_t *queue, void *user_data, int inline_completion);
+
 /**
  * @brief Waits for the result to become available. Blocks until specified timeout elapses or the result becomes available, whichever comes first.
  * @ingroup InferRequest
@@ -661,6 +685,55 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_
 
 /** @} */ // end of InferRequest
 
+// CompletionQueue
+
+/**
+ * @defgroup CompletionQueue CompletionQueue
+ * Set of functions to collect completions of asynchronous infer requests
+ * in event loops without callbacks.
+ * @{
+ */
+
+/**
+ * @brief Constructs an empty completion queue. Use the ie_completion_queue_free() method to free memory.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the newly created ie_completion_queue_t instance.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance.
+ * @note The queue stays alive until all infer requests attached to it are released.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to the ie_completion_queue_t to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Gets a file descriptor which is readable while the queue is not empty. It can be added to epoll or poll sets.
+ * The descriptor is owned by the queue and must not be read or closed by the application.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param fd A pointer to the file descriptor, -1 on platforms without eventfd support.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd);
+
+/**
+ * @brief Takes completions from the queue without blocking.
+ * @ingroup CompletionQueue
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param completions A pointer to array of at least max_count elements to store completions to.
+ * @param max_count Maximum number of completions to take.
+ * @param count A pointer to the number of stored completions, 0 if the queue is empty.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_drain(ie_completion_queue_t *queue, ie_completion_t *completions,
+        size_t max_count, size_t *count);
+
+/** @} */ // end of CompletionQueue
+
 // Network
 
 /**
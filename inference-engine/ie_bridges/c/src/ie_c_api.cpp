@@ -52,6 +52,14 @@ struct ie_blob {
     IE::Blob::Ptr object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct represents a queue of asynchronous infer requests completions
+ */
+struct ie_completion_queue {
+    IE::CompletionQueue::Ptr object;
+};
+
 /**
  * @struct ie_network
  * @brief This is the main interface to describe the NN topology
@@ -1298,6 +1306,24 @@ IEStatusCode ie_infer_set_completion_callback(ie_infer_request_t *infer_request,
     return status;
 }
 
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request,
+        ie_completion_queue_t *queue, void *user_data, int inline_completion) {
+    IEStatusCode status = IEStatusCode::OK;
+
+    if (infer_request == nullptr || queue == nullptr) {
+        status = IEStatusCode::GENERAL_ERROR;
+        return status;
+    }
+
+    try {
+        infer_request->object.SetCompletionQueue(queue->object, user_data, inline_completion != 0);
+    } CATCH_IE_EXCEPTIONS catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
 IEStatusCode ie_infer_request_wait(ie_infer_request_t *infer_request, const int64_t timeout) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1333,6 +1359,64 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_completion_queue_t> tmp(new ie_completion_queue_t);
+        tmp->object = std::make_shared<IE::CompletionQueue>();
+        *queue = tmp.release();
+    } CATCH_IE_EXCEPTIONS catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_completion_queue_get_fd(const ie_completion_queue_t *queue, int *fd) {
+    if (queue == nullptr || fd == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    *fd = queue->object->GetNotificationHandle();
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_drain(ie_completion_queue_t *queue, ie_completion_t *completions, size_t max_count, size_t *count) {
+    if (queue == nullptr || count == nullptr || (completions == nullptr && max_count != 0)) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        // the records are taken in chunks of a stack buffer and converted right into the caller's array
+        IE::CompletionQueue::Completion drained[64];
+        *count = 0;
+        while (*count < max_count) {
+            const size_t chunk = queue->object->Drain(drained, std::min(max_count - *count, sizeof(drained) / sizeof(drained[0])));
+            for (size_t i = 0; i < chunk; i++) {
+                completions[*count + i].user_data = drained[i].userData;
+                completions[*count + i].status = status_map[drained[i].status];
+            }
+            *count += chunk;
+            if (chunk < sizeof(drained) / sizeof(drained[0]))
+                break;
+        }
+    } CATCH_IE_EXCEPTIONS catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1539,6 +1539,62 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+TEST(ie_infer_request_set_completion_queue, drainCompletion) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_infer_request_t *infer_request = nullptr;
+    IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_request));
+    EXPECT_NE(nullptr, infer_request);
+
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_infer_request_get_blob(infer_request, "data", &blob));
+
+    cv::Mat image = cv::imread(input_image);
+    Mat2Blob(image, blob);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_EXPECT_OK(ie_completion_queue_create(&queue));
+    EXPECT_NE(nullptr, queue);
+
+    int fd = -1;
+    IE_EXPECT_OK(ie_completion_queue_get_fd(queue, &fd));
+
+    IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_request, queue, infer_request, 1));
+    IE_EXPECT_OK(ie_infer_request_infer_async(infer_request));
+    IE_EXPECT_OK(ie_infer_request_wait(infer_request, -1));
+
+    ie_completion_t completions[2];
+    size_t count = 0;
+    IE_EXPECT_OK(ie_completion_queue_drain(queue, completions, 2, &count));
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(infer_request, completions[0].user_data);
+    EXPECT_EQ(IEStatusCode::OK, completions[0].status);
+
+    IE_EXPECT_OK(ie_completion_queue_drain(queue, completions, 2, &count));
+    EXPECT_EQ(0, count);
+
+    ie_blob_free(&blob);
+    ie_infer_request_free(&infer_request);
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
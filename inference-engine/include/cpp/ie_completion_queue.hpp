@@ -0,0 +1,91 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides a completion queue for asynchronous infer requests
+ *
+ * @file ie_completion_queue.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A queue which collects completions of asynchronous infer requests.
+ *
+ * Infer requests attached with InferRequest::SetCompletionQueue post a completion record into the queue
+ * instead of calling a user callback. On Linux the queue exposes an eventfd file descriptor which is readable
+ * while the queue is not empty, so it can be registered in epoll, poll or io_uring based event loops.
+ * Completions are taken from the queue in batches without blocking.
+ */
+class INFERENCE_ENGINE_API_CLASS(CompletionQueue) {
+public:
+    /**
+     * @brief A smart pointer to the CompletionQueue object
+     */
+    using Ptr = std::shared_ptr<CompletionQueue>;
+
+    /**
+     * @brief A record about finished asynchronous infer request
+     */
+    struct Completion {
+        void* userData = nullptr;  //!< A user data passed to InferRequest::SetCompletionQueue
+        StatusCode status = OK;  //!< A status of the finished inference
+    };
+
+    /**
+     * @brief Creates an empty completion queue
+     */
+    CompletionQueue();
+
+    /**
+     * @brief Destructor, closes the notification file descriptor
+     */
+    ~CompletionQueue();
+
+    CompletionQueue(const CompletionQueue&) = delete;
+    CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+    /**
+     * @brief Gets a file descriptor which is readable while the queue is not empty
+     *
+     * @note The descriptor is owned by the queue and should not be read or closed by the application.
+     * @return An eventfd file descriptor on Linux, -1 on other platforms
+     */
+    int GetNotificationHandle() const noexcept;
+
+    /**
+     * @brief Takes completions from the queue without blocking
+     *
+     * @param completions A pointer to array of at least @p maxCount elements to store completions to
+     * @param maxCount Maximum number of completions to take
+     * @return A number of completions stored to @p completions, 0 if the queue is empty
+     */
+    size_t Drain(Completion* completions, size_t maxCount);
+
+    /**
+     * @brief Gets a number of completions in the queue
+     * @return A number of completions which were posted but not drained yet
+     */
+    size_t Size() const;
+
+    /**
+     * @brief Adds a completion to the queue and signals the notification file descriptor
+     *
+     * @note Is called by infer requests attached to the queue. Can be called from any thread.
+     * @param completion A completion record
+     */
+    void Post(const Completion& completion);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace InferenceEngine
@@ -9,11 +9,14 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
 
 #include "cpp/ie_memory_state.hpp"
+#include "cpp/ie_completion_queue.hpp"
+#include "cpp/ie_state_session.hpp"
 #include "ie_remote_context.hpp"
 #include "ie_iinfer_request.hpp"
 #include "details/ie_so_loader.h"
@@ -53,6 +56,19 @@ public:
         STATUS_ONLY = 0,
     };
 
+    /**
+     * @enum Priority
+     * @brief Enumeration to hold priority classes of asynchronous inference requests
+     */
+    enum Priority : int {
+        /** Interactive requests which are run before the requests of other classes */
+        HIGH = 0,
+        /** Default priority class */
+        NORMAL = 1,
+        /** Background requests which are run after the requests of other classes */
+        LOW = 2,
+    };
+
     /**
      * @brief A smart pointer to the InferRequest object
      */
@@ -194,6 +210,28 @@ public:
         return SetCallback<F>{*this}(std::move(callbackToSet));
     }
 
+    /**
+     * @brief Attaches the request to a completion queue. Every asynchronous inference posts a completion record
+     * with @p userData and the inference status into the @p queue. Replaces the completion callback set before.
+     *
+     * @param queue A completion queue, several requests can share one queue
+     * @param userData A value to identify the request in completion records
+     * @param inlineCompletion If `true` the completion is posted directly from the thread which finished inference
+     * instead of being passed to the callback executor of the plugin
+     */
+    void SetCompletionQueue(const CompletionQueue::Ptr& queue, void* userData, bool inlineCompletion = false);
+
+    /**
+     * @brief Sets the priority class and the deadline of the request. Executors of the plugin which share tasks of
+     * several requests run the queued tasks by priority class first and then by the earliest deadline.
+     * Tasks of less urgent classes are not starved: a task which waits too long is run first.
+     *
+     * @param priority A priority class of the request
+     * @param deadline A time from the start of each inference until which the request should be finished,
+     * zero means no deadline
+     */
+    void SetPriority(Priority priority, std::chrono::milliseconds deadline = std::chrono::milliseconds::zero());
+
     /**
      * @brief Gets state control interface for given infer request.
      *
@@ -202,6 +240,24 @@ public:
      */
     std::vector<VariableState> QueryState();
 
+    /**
+     * @brief Creates a new state session for the network of the request.
+     *
+     * The session is initialized with default (zero) values of variables and isn't bound to any request
+     * @return A shared pointer to the created session
+     */
+    StateSession::Ptr CreateStateSession();
+
+    /**
+     * @brief Binds state sessions to the request. Following inferences read and update variables of the sessions
+     * instead of variable states of the request.
+     *
+     * Several sessions are inferred as one batch, the i-th session occupies the i-th batch sample of variables.
+     * An empty vector unbinds sessions and the request returns to its own variable states.
+     * @param sessions Sessions created by any request of the same executable network
+     */
+    void SetStateSessions(const std::vector<StateSession::Ptr>& sessions);
+
     IE_SUPPRESS_DEPRECATED_START
     /**
      * @brief  IInferRequest pointer to be used directly in CreateInferRequest functions
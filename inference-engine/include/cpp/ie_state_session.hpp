@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides a state session for stateful networks
+ *
+ * @file ie_state_session.hpp
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ie_blob.h"
+#include "ie_common.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief A storage for variables of a stateful network which belongs to a single stream of data, e.g. one audio stream.
+ *
+ * Unlike variable states of an infer request a session is not tied to any request. Sessions are created with
+ * InferRequest::CreateStateSession and bound to an idle infer request with InferRequest::SetStateSessions right
+ * before the inference, so a few infer requests can serve many concurrent streams. The session holds one batch
+ * sample of each variable, the first dimension of a variable is treated as a batch.
+ *
+ * A session is dropped by releasing its last reference. It must not be bound to several running requests at once.
+ */
+class INFERENCE_ENGINE_API_CLASS(StateSession) {
+public:
+    /**
+     * @brief A smart pointer to the StateSession object
+     */
+    using Ptr = std::shared_ptr<StateSession>;
+
+    /**
+     * @brief Creates a session which owns the given variable storages
+     *
+     * @note Is called by plugins. The storages are used as is, their content is the initial session state.
+     * @param states A map of variable names to allocated blobs
+     */
+    explicit StateSession(const BlobMap& states);
+
+    StateSession(const StateSession&) = delete;
+    StateSession& operator=(const StateSession&) = delete;
+
+    /**
+     * @brief Gets variable storages of the session
+     *
+     * @note The blobs are read and written by the infer requests the session is bound to.
+     * @return A map of variable names to blobs
+     */
+    const BlobMap& GetStates() const;
+
+    /**
+     * @brief Gets a storage of a variable
+     *
+     * @param name A variable name
+     * @return A blob with the current value of the variable
+     */
+    Blob::CPtr GetState(const std::string& name) const;
+
+    /**
+     * @brief Resets all variables of the session to the default (zero) value
+     */
+    void Reset();
+
+    /**
+     * @brief Copies current values of all variables
+     * @return A map of variable names to deep copies of the storages
+     */
+    BlobMap Snapshot() const;
+
+    /**
+     * @brief Restores values of variables from a snapshot
+     *
+     * @param snapshot A snapshot taken with Snapshot() from this or another session of the same network
+     */
+    void Restore(const BlobMap& snapshot);
+
+private:
+    BlobMap _states;
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <map>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining CPU configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables benchmark-driven selection of primitive implementations during network loading.
+ * Candidate implementations and layouts of heavy nodes (convolutions, deconvolutions) are timed on the target CPU
+ * together with the reorders they induce, and the fastest combination is used instead of the static priority list.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(TUNING_MODE);
+
+/**
+ * @brief The key specifies path to the file which keeps tuning results between network loads.
+ * Results are keyed by CPU model, ISA and node signature. If the file is set and tuning mode is disabled,
+ * stored results are applied but nodes missing in the file are not tuned.
+ * Empty string (default) means that tuning results are not persisted.
+ */
+DECLARE_CPU_CONFIG_KEY(TUNING_CACHE_FILE);
+
+/**
+ * @brief The key sets the maximal number of oneDNN primitives kept in the process wide primitive cache.
+ * Identical primitives of all streams and networks are created once and reused from the cache, also after the networks are
+ * released. The capacity is a plugin level option: it is applied by Core::SetConfig only and ignored in the LoadNetwork config.
+ * This option should be used with non-negative integer values, 0 disables the cache. Default value is 1024.
+ */
+DECLARE_CPU_CONFIG_KEY(PRIMITIVE_CACHE_CAPACITY);
+
+/**
+ * @brief The key specifies an existing directory where the machine code of JIT kernels is persisted between processes.
+ * Kernels missing in the process wide kernel cache are loaded from the directory instead of being compiled, if they were
+ * compiled by the same plugin and oneDNN versions on a CPU with the same ISA. Otherwise they are compiled and written to the directory.
+ * The directory is a plugin level option: it is applied by Core::SetConfig only and ignored in the LoadNetwork config.
+ * Empty string (default) means that kernels are not persisted.
+ */
+DECLARE_CPU_CONFIG_KEY(JIT_KERNEL_CACHE_DIR);
+
+/**
+ * @brief The key asks the OS to back large activation workspaces of the streams with transparent huge pages (madvise).
+ * It reduces TLB misses for networks with large intermediate tensors at the cost of memory rounded up to huge pages.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_CPU_CONFIG_KEY(WORKSPACE_HUGE_PAGES);
+
+/**
+ * @brief The key sets the number of threads of a separate executor which runs the input preprocessing and precision
+ * conversion of the asynchronous requests. The preprocessing of one request then overlaps with the inference of the others.
+ * This option should be used with non-negative integer values, 0 (default) runs the preprocessing in the inference streams.
+ */
+DECLARE_CPU_CONFIG_KEY(PREPROCESS_THREADS);
+
+/**
+ * @brief The key sets the number of threads which all CPU executable networks of the process may use together.
+ * Every loaded network reserves its threads from the free threads of the budget, the threads return to the budget when the
+ * network is released. Threads reserved by loaded networks are not taken back, so LoadNetwork fails if the budget has no
+ * free threads.
+ * The budget is a plugin level option: it is applied by Core::SetConfig only and ignored in the LoadNetwork config.
+ * This option should be used with non-negative integer values, 0 (default) disables the budget.
+ */
+DECLARE_CPU_CONFIG_KEY(THREADS_BUDGET);
+
+/**
+ * @brief The key sets the share of the threads budget of the network relative to other networks. The network gets at most
+ * the budget multiplied by its weight and divided by the sum of weights of all loaded networks, so networks loaded while
+ * others are running do not take all free threads.
+ * This option should be used with positive integer values. Default value is 1.
+ */
+DECLARE_CPU_CONFIG_KEY(THREADS_WEIGHT);
+
+}  // namespace CPUConfigParams
+
+//
+// Metrics
+//
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief Shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get number of reorders removed from the executable network by the whole-graph layout assignment,
+ * String value is "CPU_ELIMINATED_REORDERS"
+ */
+DECLARE_CPU_METRIC_KEY(ELIMINATED_REORDERS, unsigned int);
+
+/**
+ * @brief Metric to get memory traffic in bytes per inference of the reorders removed by the whole-graph layout assignment,
+ * String value is "CPU_ELIMINATED_REORDER_BYTES"
+ */
+DECLARE_CPU_METRIC_KEY(ELIMINATED_REORDER_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get number of precision conversions (e.g. BF16 <-> FP32) executed on each inference,
+ * String value is "CPU_PRECISION_CONVERSIONS"
+ */
+DECLARE_CPU_METRIC_KEY(PRECISION_CONVERSIONS, unsigned int);
+
+/**
+ * @brief Metric to get number of JIT kernels which were reused from the process wide kernel cache instead of compiling,
+ * String value is "CPU_JIT_KERNEL_CACHE_HITS"
+ */
+DECLARE_CPU_METRIC_KEY(JIT_KERNEL_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get number of JIT kernels which were compiled because the kernel cache had no such kernel,
+ * String value is "CPU_JIT_KERNEL_CACHE_MISSES"
+ */
+DECLARE_CPU_METRIC_KEY(JIT_KERNEL_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get number of JIT kernels which were loaded from the persistent kernel cache directory instead of compiling,
+ * String value is "CPU_JIT_KERNEL_CACHE_LOADS"
+ */
+DECLARE_CPU_METRIC_KEY(JIT_KERNEL_CACHE_LOADS, uint64_t);
+
+/**
+ * @brief Metric to get number of oneDNN primitives which were reused from the process wide primitive cache,
+ * String value is "CPU_PRIMITIVE_CACHE_HITS"
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get number of oneDNN primitives which were created because the primitive cache had no such primitive,
+ * String value is "CPU_PRIMITIVE_CACHE_MISSES"
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES, uint64_t);
+
+/**
+ * @brief Metric to get number of oneDNN primitives evicted from the primitive cache because of its capacity,
+ * String value is "CPU_PRIMITIVE_CACHE_EVICTIONS"
+ */
+DECLARE_CPU_METRIC_KEY(PRIMITIVE_CACHE_EVICTIONS, uint64_t);
+
+/**
+ * @brief Metric to get number of bytes of the stream activation workspaces placed on each NUMA node,
+ * node -1 is reported if the OS can't report page placement, String value is "CPU_WORKSPACE_NUMA_PLACEMENT"
+ */
+DECLARE_CPU_METRIC_KEY(WORKSPACE_NUMA_PLACEMENT, std::map<int, uint64_t>);
+
+/**
+ * @brief Metric to get average latency in milliseconds of each stage of the inference pipeline ("PREPROCESS", "INFER"),
+ * String value is "CPU_PIPELINE_STAGE_LATENCIES"
+ */
+DECLARE_CPU_METRIC_KEY(PIPELINE_STAGE_LATENCIES, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get number of threads currently reserved by each loaded executable network. The keys are the network
+ * name followed by '#' and the number of the reservation, so networks of the same name are reported separately,
+ * String value is "CPU_THREADS_ALLOCATION"
+ */
+DECLARE_CPU_METRIC_KEY(THREADS_ALLOCATION, std::map<std::string, int>);
+
+/**
+ * @brief Metric to get average time in milliseconds the tasks of each request priority class ("HIGH", "NORMAL", "LOW")
+ * waited in the queue of the streams executor of the network, String value is "CPU_QUEUEING_DELAYS"
+ */
+DECLARE_CPU_METRIC_KEY(QUEUEING_DELAYS, std::map<std::string, float>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
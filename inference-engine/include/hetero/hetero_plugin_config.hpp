@@ -28,6 +28,12 @@ namespace HeteroConfigParams {
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 /**
  * @brief The key for enabling of dumping the topology with details of layers and details how
  * this network would be executed on different devices to the disk in GraphViz format.
@@ -35,5 +41,37 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key defines how layers without user defined affinity are assigned to devices.
+ * This option should be used with values:
+ * - HETERO_CONFIG_VALUE(PRIORITY) (default) - a layer goes to the first device in TARGET_FALLBACK that supports it
+ * - HETERO_CONFIG_VALUE(MIN_LATENCY) - layers are assigned to minimize estimated latency of the whole network,
+ *   including cost of the data transfers between devices. Performance of every device in TARGET_FALLBACK must be set
+ *   by HETERO_CONFIG_KEY(DEVICE_GFLOPS), otherwise layers are assigned as with HETERO_CONFIG_VALUE(PRIORITY)
+ */
+DECLARE_HETERO_CONFIG_KEY(AFFINITY_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(MIN_LATENCY);
+
+/**
+ * @brief The key sets expected performance of devices used by HETERO_CONFIG_VALUE(MIN_LATENCY) policy.
+ * The value is a comma separated list of <device>:<GFLOPS> pairs, e.g. "GPU:400,CPU:100".
+ */
+DECLARE_HETERO_CONFIG_KEY(DEVICE_GFLOPS);
+
+/**
+ * @brief The key enables the report of the partition chosen by HETERO_CONFIG_VALUE(MIN_LATENCY) policy.
+ * The report is written to hetero_partition_<network name>.txt with estimated and measured time of every subgraph.
+ * Subgraphs are executed to measure their time, so loading of the network takes longer.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(DUMP_PARTITION);
+
+/**
+ * @brief The key sets the minimal number of layers in a subgraph for HETERO_CONFIG_VALUE(MIN_LATENCY) policy.
+ * Smaller subgraphs are merged into a neighbouring device that supports all their layers. Default value is 3.
+ */
+DECLARE_HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -34,5 +37,49 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how inference requests are distributed between devices
+ *
+ * Supported values:
+ *  - MULTI_PRIORITY (default) - a request is sent to the first device in the priority list that has an idle request
+ *  - MULTI_LATENCY - a request is sent to the device with the earliest expected completion time, which is estimated
+ *    from the measured inference time of the device and the number of requests it is busy with
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY);
+
+/**
+ * @brief Request deadline config option, an unsigned integer number of microseconds
+ *
+ * Is used with the MULTI_LATENCY scheduling policy only. A request is sent to the first device in the priority list
+ * which is expected to complete it within the deadline, so cheaper devices are preferred while they keep up.
+ * If no device is expected to meet the deadline, the device with the earliest expected completion is used.
+ * The default value is 0, meaning no deadline. A deadline set by InferRequest::SetPriority is used instead of this
+ * value for the inferences of that request.
+ */
+DECLARE_MULTI_CONFIG_KEY(REQUEST_DEADLINE);
+
 }  // namespace MultiDeviceConfigParams
+
+//
+// Metrics
+//
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC_KEY(name) METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get number of inference requests completed by each device of the executable network,
+ * String value is "MULTI_DEVICE_REQUESTS"
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_REQUESTS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -6,7 +6,9 @@
 #include "hetero_executable_network.hpp"
 #include "hetero_async_infer_request.hpp"
 #include "hetero_itt.hpp"
+#include "hetero_partitioning.hpp"
 #include "xml_parse_utils.h"
+#include "blob_factory.hpp"
 #include <caseless.hpp>
 
 #include <vector>
@@ -19,7 +21,9 @@
 #include <memory>
 #include <unordered_set>
 #include <array>
+#include <chrono>
 #include <cstdint>
+#include <cstring>
 
 #include "transformations/serialize.hpp"
 #include "ie_ngraph_utils.hpp"
@@ -48,6 +52,34 @@ using namespace InferenceEngine::HeteroConfigParams;
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+// Average time of a subnetwork inference with zero filled inputs in microseconds
+double MeasureLatency(ExecutableNetwork& network) {
+    constexpr int iterations = 10;
+    auto request = network.CreateInferRequest();
+    for (auto&& input : network.GetInputsInfo()) {
+        auto blob = as<MemoryBlob>(request.GetBlob(input.first));
+        // devices with remote input blobs get a host blob instead
+        if (blob == nullptr) {
+            blob = as<MemoryBlob>(make_blob_with_precision(input.second->getTensorDesc()));
+            blob->allocate();
+            request.SetBlob(input.first, blob);
+        }
+        auto mapped = blob->wmap();
+        std::memset(mapped.as<void*>(), 0, blob->byteSize());
+    }
+    request.Infer();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        request.Infer();
+    }
+    std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / iterations;
+}
+
+}  // namespace
+
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwork&     network,
                                                  const Engine::Configs&                 config,
                                                  Engine*                                plugin):
@@ -61,6 +93,12 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     auto clonedFunction = ngraph::clone_function(*function);
     auto itDumpDotFile = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
     bool dumpDotFile = itDumpDotFile != _config.end() ? (itDumpDotFile->second == YES) : false;
+    auto itPolicy = _config.find(HETERO_CONFIG_KEY(AFFINITY_POLICY));
+    auto policy = itPolicy != _config.end() ? itPolicy->second : std::string{HETERO_CONFIG_VALUE(PRIORITY)};
+    auto itDumpPartition = _config.find(HETERO_CONFIG_KEY(DUMP_PARTITION));
+    bool dumpPartition = itDumpPartition != _config.end() ? (itDumpPartition->second == YES) : false;
+    // the partition report is written only if layers were assigned by the cost model
+    bool minimizedLatency = false;
 #ifndef NDEBUG
     dumpDotFile  = true;
 #endif
@@ -82,11 +120,48 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
-        } else {
+        if (policy != HETERO_CONFIG_VALUE(PRIORITY) && policy != HETERO_CONFIG_VALUE(MIN_LATENCY)) {
+            IE_THROW() << "Wrong value " << policy << " for " << HETERO_CONFIG_KEY(AFFINITY_POLICY)
+                       << ". Expected " << HETERO_CONFIG_VALUE(PRIORITY) << " or " << HETERO_CONFIG_VALUE(MIN_LATENCY);
+        }
+        if (it == _config.end()) {
             IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
+        CostModel costModel{_config};
+        // without performance of every device the estimations are meaningless, so the layers are assigned by priority
+        auto fallbackDevices = DeviceIDParser::getHeteroDevices(it->second);
+        minimizedLatency = policy == HETERO_CONFIG_VALUE(MIN_LATENCY) &&
+            std::all_of(fallbackDevices.begin(), fallbackDevices.end(), [&] (const std::string& device) {
+                return costModel.IsDefinedFor(device);
+            });
+        if (minimizedLatency) {
+            OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "HeteroExecutableNetwork::MinimizeLatency");
+            std::unordered_map<std::string, std::vector<std::string>> devicesPerLayer;
+            for (auto&& queryResult : _heteroPlugin->QueryNetworkPerDevice(network, _config)) {
+                for (auto&& layer : queryResult.second.supportedLayersMap) {
+                    devicesPerLayer[layer.first].push_back(queryResult.first);
+                }
+            }
+            NodeMap<std::vector<std::string>> supportedDevices;
+            for (auto&& node : orderedOps) {
+                auto itDevices = devicesPerLayer.find(node->get_friendly_name());
+                if (itDevices != devicesPerLayer.end()) {
+                    supportedDevices.emplace(node.get(), itDevices->second);
+                }
+            }
+            auto itMinSize = _config.find(HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE));
+            std::size_t minSubgraphSize = 0;
+            try {
+                minSubgraphSize = itMinSize != _config.end() ? std::stoul(itMinSize->second) : 0;
+            } catch (...) {
+                IE_THROW() << "Wrong value " << itMinSize->second << " for " << HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE)
+                           << ". Expected non negative integer";
+            }
+            queryNetworkResult.supportedLayersMap =
+                MinimizeLatency(orderedOps, supportedDevices, costModel, minSubgraphSize);
+        } else {
+            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+        }
     }
 
     using Input = ngraph::Input<ngraph::Node>;
@@ -424,6 +499,32 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
             network._device, metaDevices[network._device]);
     }
+
+    if (dumpPartition && minimizedLatency) {
+        CostModel costModel{_config};
+        std::ofstream report{"hetero_partition_" + _name + ".txt"};
+        report << "subgraph\tdevice\tlayers\testimated_us\tmeasured_us\n";
+        double estimatedTotal = 0., measuredTotal = 0.;
+        for (std::size_t i = 0; i < networks.size(); ++i) {
+            std::size_t layers = 0;
+            double estimated = 0.;
+            for (auto&& node : subFunctions[i]->get_ops()) {
+                if (contains(subgraphParameterToPrevResult, node.get())) {
+                    estimated += costModel.TransferCost(node->output(0));
+                } else if (!ngraph::op::is_constant(node) && !ngraph::op::is_output(node) &&
+                           !ngraph::op::is_parameter(node)) {
+                    estimated += costModel.ComputeCost(node.get(), networks[i]._device);
+                    ++layers;
+                }
+            }
+            auto measured = MeasureLatency(networks[i]._network);
+            estimatedTotal += estimated;
+            measuredTotal += measured;
+            report << i << '\t' << networks[i]._device << '\t' << layers << '\t'
+                   << estimated << '\t' << measured << '\n';
+        }
+        report << "total\t\t\t" << estimatedTotal << '\t' << measuredTotal << '\n';
+    }
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -671,10 +772,16 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
             result = std::string{};
         }
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+               name == HETERO_CONFIG_KEY(DUMP_PARTITION) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(AFFINITY_POLICY) ||
+               name == HETERO_CONFIG_KEY(DEVICE_GFLOPS) ||
+               name == HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{};
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -759,6 +866,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(DUMP_PARTITION),
+            HETERO_CONFIG_KEY(AFFINITY_POLICY),
+            HETERO_CONFIG_KEY(DEVICE_GFLOPS),
+            HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -0,0 +1,291 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioning.hpp"
+
+#include <set>
+#include <memory>
+#include <sstream>
+#include <functional>
+#include <algorithm>
+#include <unordered_set>
+
+#include <ie_common.h>
+#include "hetero/hetero_plugin_config.hpp"
+
+#include <ngraph/opsets/opset7.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace HeteroPlugin;
+
+namespace {
+
+// Host memory bandwidth used to estimate the copy of a tensor between devices, GB/s
+constexpr double transferBandwidth = 10.;
+// Fixed cost of switching to another device: extra subgraph request, synchronization, blob conversion
+constexpr double transitionOverheadUs = 20.;
+constexpr double epsilon = 1e-6;
+constexpr std::size_t maxLocalSearchPasses = 16;
+
+bool IsComputeLayer(const ngraph::Node* node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+double OutputSize(const ngraph::Node* node, std::size_t index) {
+    auto& shape = node->get_output_partial_shape(index);
+    return shape.is_static() ? static_cast<double>(ngraph::shape_size(shape.to_shape())) : 1.;
+}
+
+// Number of floating point operations of the layer. Layers other than convolutions and matrix multiplications are
+// treated as memory bound: every input and output element costs one operation.
+double Flops(const ngraph::Node* node) {
+    using namespace ngraph;
+    auto inputs = node->inputs();
+    bool staticShapes = std::all_of(inputs.begin(), inputs.end(), [] (const Input<const Node>& input) {
+        return input.get_partial_shape().is_static();
+    }) && node->get_output_size() > 0 && node->get_output_partial_shape(0).is_static();
+
+    if (staticShapes && (is_type<opset7::Convolution>(node) ||
+                         is_type<opset7::GroupConvolution>(node) ||
+                         is_type<opset7::ConvolutionBackpropData>(node) ||
+                         is_type<opset7::GroupConvolutionBackpropData>(node))) {
+        auto outputShape = node->get_output_shape(0);
+        // every output element accumulates all weights of its output channel
+        if (outputShape.size() > 1 && outputShape[1] != 0) {
+            return 2. * shape_size(outputShape) * shape_size(node->get_input_shape(1)) / outputShape[1];
+        }
+    } else if (staticShapes && is_type<opset7::MatMul>(node)) {
+        auto matMul = static_cast<const opset7::MatMul*>(node);
+        auto inputShape = node->get_input_shape(0);
+        std::size_t k = 1;
+        if (inputShape.size() == 1) {
+            k = inputShape[0];
+        } else if (!inputShape.empty()) {
+            k = inputShape[inputShape.size() - (matMul->get_transpose_a() ? 2 : 1)];
+        }
+        return 2. * shape_size(node->get_output_shape(0)) * k;
+    }
+
+    double elements = 0.;
+    for (auto&& input : inputs) {
+        elements += OutputSize(input.get_source_output().get_node(), input.get_source_output().get_index());
+    }
+    for (std::size_t i = 0; i < node->get_output_size(); ++i) {
+        elements += OutputSize(node, i);
+    }
+    return elements;
+}
+
+}  // namespace
+
+CostModel::CostModel(const std::map<std::string, std::string>& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(DEVICE_GFLOPS));
+    if (it == config.end()) {
+        return;
+    }
+    std::stringstream stream(it->second);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        auto pos = item.rfind(':');
+        if (pos == std::string::npos || pos == 0) {
+            IE_THROW() << "Wrong value " << it->second << " for " << HETERO_CONFIG_KEY(DEVICE_GFLOPS)
+                       << ". Expected comma separated list of <device>:<GFLOPS> pairs";
+        }
+        double gflops = 0.;
+        try {
+            gflops = std::stod(item.substr(pos + 1));
+        } catch (...) {
+            gflops = 0.;
+        }
+        if (gflops <= 0.) {
+            IE_THROW() << "Wrong performance value " << item.substr(pos + 1) << " for device " << item.substr(0, pos)
+                       << " in " << HETERO_CONFIG_KEY(DEVICE_GFLOPS);
+        }
+        _deviceGflops[item.substr(0, pos)] = gflops;
+    }
+}
+
+bool CostModel::IsDefinedFor(const std::string& device) const {
+    return _deviceGflops.find(device) != _deviceGflops.end();
+}
+
+double CostModel::ComputeCost(const ngraph::Node* node, const std::string& device) const {
+    auto it = _deviceGflops.find(device);
+    if (it == _deviceGflops.end()) {
+        IE_THROW() << "Performance of device " << device << " is not set in " << HETERO_CONFIG_KEY(DEVICE_GFLOPS);
+    }
+    return Flops(node) / (it->second * 1e3);
+}
+
+double CostModel::TransferCost(const ngraph::Output<ngraph::Node>& output) const {
+    auto bytes = OutputSize(output.get_node(), output.get_index()) * output.get_element_type().size();
+    return bytes / (transferBandwidth * 1e3) + transitionOverheadUs;
+}
+
+std::map<std::string, std::string> HeteroPlugin::MinimizeLatency(
+        const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+        const std::unordered_map<ngraph::Node*, std::vector<std::string>>& supportedDevices,
+        const CostModel& costModel,
+        std::size_t minSubgraphSize) {
+    std::vector<ngraph::Node*> layers;
+    std::unordered_map<ngraph::Node*, std::string> affinities;
+    auto Supports = [&] (ngraph::Node* node, const std::string& device) {
+        auto& devices = supportedDevices.at(node);
+        return std::find(devices.begin(), devices.end(), device) != devices.end();
+    };
+
+    // Initial assignment: the fastest device for every layer, ties are resolved by the device priority
+    for (auto&& node : orderedOps) {
+        auto itDevices = supportedDevices.find(node.get());
+        if (!IsComputeLayer(node.get()) || itDevices == supportedDevices.end() || itDevices->second.empty()) {
+            continue;
+        }
+        layers.push_back(node.get());
+        auto& devices = itDevices->second;
+        auto best = devices.front();
+        for (auto&& device : devices) {
+            if (costModel.ComputeCost(node.get(), device) < costModel.ComputeCost(node.get(), best) - epsilon) {
+                best = device;
+            }
+        }
+        affinities[node.get()] = best;
+    }
+
+    // Transfer cost of the output: one copy for every other device consuming it
+    auto OutputCost = [&] (const ngraph::Output<ngraph::Node>& output) {
+        auto& producerDevice = affinities.at(output.get_node());
+        std::unordered_set<std::string> consumerDevices;
+        for (auto&& input : output.get_target_inputs()) {
+            auto itAffinity = affinities.find(input.get_node());
+            if (itAffinity != affinities.end() && itAffinity->second != producerDevice) {
+                consumerDevices.insert(itAffinity->second);
+            }
+        }
+        return consumerDevices.size() * costModel.TransferCost(output);
+    };
+
+    // Part of the network cost that depends on the device of the layer
+    auto LayerCost = [&] (ngraph::Node* node) {
+        double cost = costModel.ComputeCost(node, affinities.at(node));
+        for (auto&& output : node->outputs()) {
+            cost += OutputCost(output);
+        }
+        std::set<ngraph::Output<ngraph::Node>> producers;
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            if (affinities.count(source.get_node()) != 0) {
+                producers.insert(source);
+            }
+        }
+        for (auto&& producer : producers) {
+            cost += OutputCost(producer);
+        }
+        return cost;
+    };
+
+    // Move single layers while it reduces the estimated latency
+    for (std::size_t pass = 0; pass < maxLocalSearchPasses; ++pass) {
+        bool improved = false;
+        for (auto&& node : layers) {
+            auto& devices = supportedDevices.at(node);
+            if (devices.size() < 2) {
+                continue;
+            }
+            auto current = affinities[node];
+            auto best = current;
+            auto bestCost = LayerCost(node);
+            for (auto&& device : devices) {
+                if (device == current) {
+                    continue;
+                }
+                affinities[node] = device;
+                auto cost = LayerCost(node);
+                if (cost < bestCost - epsilon) {
+                    best = device;
+                    bestCost = cost;
+                }
+            }
+            affinities[node] = best;
+            improved = improved || (best != current);
+        }
+        if (!improved) {
+            break;
+        }
+    }
+
+    auto ForEachNeighbour = [&] (ngraph::Node* node, const std::function<void(ngraph::Node*)>& f) {
+        for (auto&& input : node->inputs()) {
+            auto producer = input.get_source_output().get_node();
+            if (affinities.count(producer) != 0) {
+                f(producer);
+            }
+        }
+        for (auto&& output : node->outputs()) {
+            for (auto&& input : output.get_target_inputs()) {
+                if (affinities.count(input.get_node()) != 0) {
+                    f(input.get_node());
+                }
+            }
+        }
+    };
+
+    // Merge small islands into a neighbouring device. Every merge joins the island with a neighbouring subgraph,
+    // so the number of subgraphs decreases and the loop terminates.
+    for (bool merged = true; merged;) {
+        merged = false;
+        std::unordered_set<ngraph::Node*> visited;
+        for (auto&& node : layers) {
+            if (!visited.insert(node).second) {
+                continue;
+            }
+            auto device = affinities[node];
+            std::vector<ngraph::Node*> island{node};
+            std::set<std::string> neighbourDevices;
+            for (std::size_t i = 0; i < island.size(); ++i) {
+                ForEachNeighbour(island[i], [&] (ngraph::Node* neighbour) {
+                    if (affinities[neighbour] != device) {
+                        neighbourDevices.insert(affinities[neighbour]);
+                    } else if (visited.insert(neighbour).second) {
+                        island.push_back(neighbour);
+                    }
+                });
+            }
+            if (island.size() >= minSubgraphSize) {
+                continue;
+            }
+            std::string best;
+            double bestCost = 0.;
+            for (auto&& neighbourDevice : neighbourDevices) {
+                if (!std::all_of(island.begin(), island.end(), [&] (ngraph::Node* layer) {
+                        return Supports(layer, neighbourDevice);})) {
+                    continue;
+                }
+                for (auto&& layer : island) {
+                    affinities[layer] = neighbourDevice;
+                }
+                double cost = 0.;
+                for (auto&& layer : island) {
+                    cost += LayerCost(layer);
+                }
+                if (best.empty() || cost < bestCost - epsilon) {
+                    best = neighbourDevice;
+                    bestCost = cost;
+                }
+            }
+            for (auto&& layer : island) {
+                affinities[layer] = best.empty() ? device : best;
+            }
+            if (!best.empty()) {
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    std::map<std::string, std::string> result;
+    for (auto&& node : layers) {
+        result.emplace(node->get_friendly_name(), affinities[node]);
+    }
+    return result;
+}
@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Cost model and latency driven affinity assignment
+ * @file hetero_partitioning.hpp
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <ngraph/node.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Estimates time of layers on devices and time of data transfers between devices in microseconds
+ */
+class CostModel {
+public:
+    explicit CostModel(const std::map<std::string, std::string>& config);
+
+    /**
+     * @brief Checks that performance of the device is set, compute cost of other devices is unknown
+     */
+    bool IsDefinedFor(const std::string& device) const;
+
+    double ComputeCost(const ngraph::Node* node, const std::string& device) const;
+
+    double TransferCost(const ngraph::Output<ngraph::Node>& output) const;
+
+private:
+    std::map<std::string, double> _deviceGflops;
+};
+
+/**
+ * @brief Assigns every layer to one of its supported devices to minimize the estimated network latency
+ * @param orderedOps Layers in topological order
+ * @param supportedDevices Devices supporting a layer in priority order, layers without devices are not assigned
+ * @param costModel Cost model which is defined for all supported devices
+ * @param minSubgraphSize Subgraphs with fewer layers are merged into a neighbouring device if it is possible
+ * @return Map of layer friendly names to devices
+ */
+std::map<std::string, std::string> MinimizeLatency(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                                   const std::unordered_map<ngraph::Node*, std::vector<std::string>>& supportedDevices,
+                                                   const CostModel& costModel,
+                                                   std::size_t minSubgraphSize);
+
+}  // namespace HeteroPlugin
@@ -25,6 +25,9 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(DUMP_PARTITION)] = NO;
+    _config[HETERO_CONFIG_KEY(AFFINITY_POLICY)] = HETERO_CONFIG_VALUE(PRIORITY);
+    _config[HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE)] = "3";
 }
 
 namespace {
@@ -112,9 +115,8 @@ void Engine::SetConfig(const Configs &configs) {
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+std::vector<std::pair<std::string, QueryNetworkResult>> Engine::QueryNetworkPerDevice(const CNNNetwork &network,
+                                                                                      const Configs& config) const {
     if (GetCore() == nullptr) {
         IE_THROW() << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -142,8 +144,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    std::vector<std::pair<std::string, QueryNetworkResult>> results;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+        results.emplace_back(deviceName, queryResults[deviceName]);
+    }
+    return results;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    for (auto&& queryResult : QueryNetworkPerDevice(network, config)) {
+        for (auto&& layerQueryResult : queryResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -165,6 +177,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(DUMP_PARTITION),
+            HETERO_CONFIG_KEY(AFFINITY_POLICY),
+            HETERO_CONFIG_KEY(DEVICE_GFLOPS),
+            HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)});
     } else if (METRIC_KEY(FULL_DEVICE_NAME) == name) {
@@ -202,15 +218,21 @@ std::string Engine::DeviceArchitecture(const std::string& targetFallback) const
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter> & /*options*/) const {
-    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
-        auto it = _config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
+        name == HETERO_CONFIG_KEY(DUMP_PARTITION)) {
+        auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
-    } else if (name == "TARGET_FALLBACK") {
-        auto it = _config.find("TARGET_FALLBACK");
+    } else if (name == HETERO_CONFIG_KEY(AFFINITY_POLICY) ||
+               name == HETERO_CONFIG_KEY(MIN_SUBGRAPH_SIZE)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
+    } else if (name == "TARGET_FALLBACK" || name == HETERO_CONFIG_KEY(DEVICE_GFLOPS)) {
+        auto it = _config.find(name);
         if (it == _config.end()) {
-            IE_THROW() << "Value for TARGET_FALLBACK is not set";
+            IE_THROW() << "Value for " << name << " is not set";
         } else {
             return { it->second };
         }
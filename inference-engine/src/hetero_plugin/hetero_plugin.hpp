@@ -42,6 +42,13 @@ public:
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
+    /**
+     * @brief Queries every fallback device separately
+     * @return Query results of devices in priority order
+     */
+    std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>>
+    QueryNetworkPerDevice(const InferenceEngine::CNNNetwork &network, const Configs& config) const;
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#ifdef __linux__
+# include <sys/eventfd.h>
+# include <unistd.h>
+#endif
+
+#include "cpp/ie_completion_queue.hpp"
+
+namespace InferenceEngine {
+
+struct CompletionQueue::Impl {
+    mutable std::mutex mutex;
+    std::deque<Completion> completions;
+    int fd = -1;
+};
+
+CompletionQueue::CompletionQueue() : _impl{new Impl} {
+#ifdef __linux__
+    _impl->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_impl->fd < 0)
+        IE_THROW() << "Failed to create eventfd for completion queue, errno: " << errno;
+#endif
+}
+
+CompletionQueue::~CompletionQueue() {
+#ifdef __linux__
+    if (_impl->fd >= 0)
+        close(_impl->fd);
+#endif
+}
+
+int CompletionQueue::GetNotificationHandle() const noexcept {
+    return _impl->fd;
+}
+
+size_t CompletionQueue::Drain(Completion* completions, size_t maxCount) {
+    if (completions == nullptr && maxCount != 0)
+        IE_THROW() << "Completion queue: output array is not allocated";
+
+    std::lock_guard<std::mutex> lock{_impl->mutex};
+    const size_t count = std::min(maxCount, _impl->completions.size());
+    std::copy_n(_impl->completions.begin(), count, completions);
+    _impl->completions.erase(_impl->completions.begin(), _impl->completions.begin() + count);
+#ifdef __linux__
+    // The descriptor is readable exactly while the queue is not empty, so it is reset together with the queue
+    if (count != 0 && _impl->completions.empty()) {
+        uint64_t value = 0;
+        while (read(_impl->fd, &value, sizeof(value)) < 0 && errno == EINTR) {}
+    }
+#endif
+    return count;
+}
+
+size_t CompletionQueue::Size() const {
+    std::lock_guard<std::mutex> lock{_impl->mutex};
+    return _impl->completions.size();
+}
+
+void CompletionQueue::Post(const Completion& completion) {
+    std::lock_guard<std::mutex> lock{_impl->mutex};
+    _impl->completions.push_back(completion);
+#ifdef __linux__
+    if (_impl->completions.size() == 1) {
+        const uint64_t value = 1;
+        while (write(_impl->fd, &value, sizeof(value)) < 0 && errno == EINTR) {}
+    }
+#endif
+}
+
+}  // namespace InferenceEngine
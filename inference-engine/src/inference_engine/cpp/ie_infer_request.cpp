@@ -117,6 +117,8 @@ StatusCode InferRequest::Wait(int64_t millis_timeout) {
 
 void InferRequest::SetCompletionCallbackImpl(std::function<void()> callback) {
     INFER_REQ_CALL_STATEMENT(
+        // the callback may replace an inline completion queue, so it goes through the callback executor again
+        _impl->SetInlineCallback(false);
         _impl->SetCallback([callback] (std::exception_ptr) {
             callback();
         });
@@ -141,24 +143,39 @@ void InferRequest::SetCompletionCallbackImpl(std::function<void()> callback) {
         CATCH_IE_EXCEPTION_RETURN(NETWORK_NOT_READ, NetworkNotRead)        \
         CATCH_IE_EXCEPTION_RETURN(INFER_CANCELLED, InferCancelled)
 
+namespace {
+StatusCode ToStatusCode(const std::exception_ptr& exceptionPtr) {
+    if (exceptionPtr == nullptr)
+        return StatusCode::OK;
+    try {
+        std::rethrow_exception(exceptionPtr);
+    } CATCH_IE_EXCEPTIONS_RETURN catch (const std::exception&) {
+        return GENERAL_ERROR;
+    } catch (...) {
+        return UNEXPECTED;
+    }
+}
+}  // namespace
 
 void InferRequest::SetCompletionCallbackImpl(std::function<void(InferRequest, StatusCode)> callback) {
     INFER_REQ_CALL_STATEMENT(
         auto weakThis = InferRequest{std::shared_ptr<IInferRequestInternal>{_impl.get(), [](IInferRequestInternal*){}}, _so};
+        _impl->SetInlineCallback(false);
         _impl->SetCallback([callback, weakThis] (std::exception_ptr exceptionPtr) {
-            StatusCode statusCode = StatusCode::OK;
-            if (exceptionPtr != nullptr) {
-                statusCode = [&] {
-                    try {
-                        std::rethrow_exception(exceptionPtr);
-                    } CATCH_IE_EXCEPTIONS_RETURN catch (const std::exception& ex) {
-                        return GENERAL_ERROR;
-                    } catch (...) {
-                        return UNEXPECTED;
-                    }
-                } ();
-            }
-            callback(weakThis, statusCode);
+            callback(weakThis, ToStatusCode(exceptionPtr));
+        });
+    )
+}
+
+void InferRequest::SetCompletionQueue(const CompletionQueue::Ptr& queue, void* userData, bool inlineCompletion) {
+    INFER_REQ_CALL_STATEMENT(
+        if (queue == nullptr) IE_THROW() << "Completion queue is not initialized";
+        _impl->SetInlineCallback(inlineCompletion);
+        _impl->SetCallback([queue, userData] (std::exception_ptr exceptionPtr) {
+            CompletionQueue::Completion completion;
+            completion.userData = userData;
+            completion.status = ToStatusCode(exceptionPtr);
+            queue->Post(completion);
         });
     )
 }
@@ -168,20 +185,9 @@ IE_SUPPRESS_DEPRECATED_START
 void InferRequest::SetCompletionCallbackImpl(IInferRequest::CompletionCallback callback) {
     INFER_REQ_CALL_STATEMENT(
         IInferRequest::Ptr weakThis = InferRequest{std::shared_ptr<IInferRequestInternal>{_impl.get(), [](IInferRequestInternal*){}}, _so};
+        _impl->SetInlineCallback(false);
         _impl->SetCallback([callback, weakThis] (std::exception_ptr exceptionPtr) {
-            StatusCode statusCode = StatusCode::OK;
-            if (exceptionPtr != nullptr) {
-                statusCode = [&] {
-                    try {
-                        std::rethrow_exception(exceptionPtr);
-                    } CATCH_IE_EXCEPTIONS_RETURN catch (const std::exception& ex) {
-                        return GENERAL_ERROR;
-                    } catch (...) {
-                        return UNEXPECTED;
-                    }
-                } ();
-            }
-            callback(weakThis, statusCode);
+            callback(weakThis, ToStatusCode(exceptionPtr));
         });
     )
 }
@@ -204,6 +210,22 @@ std::vector<VariableState> InferRequest::QueryState() {
     return controller;
 }
 
+StateSession::Ptr InferRequest::CreateStateSession() {
+    INFER_REQ_CALL_STATEMENT(return _impl->CreateStateSession();)
+}
+
+void InferRequest::SetPriority(Priority priority, std::chrono::milliseconds deadline) {
+    INFER_REQ_CALL_STATEMENT(
+        if (priority < HIGH || priority > LOW) IE_THROW() << "Unknown priority of infer request: " << static_cast<int>(priority);
+        if (deadline < std::chrono::milliseconds::zero()) IE_THROW() << "Deadline of infer request can't be negative";
+        _impl->SetPriority(priority, deadline);
+    )
+}
+
+void InferRequest::SetStateSessions(const std::vector<StateSession::Ptr>& sessions) {
+    INFER_REQ_CALL_STATEMENT(_impl->SetStateSessions(sessions);)
+}
+
 bool InferRequest::operator!() const noexcept {
     return !_impl;
 }
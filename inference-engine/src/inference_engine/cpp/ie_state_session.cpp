@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <string>
+
+#include "blob_factory.hpp"
+#include "cpp/ie_state_session.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+void* GetBuffer(const Blob::Ptr& blob, const std::string& name) {
+    auto memoryBlob = as<MemoryBlob>(blob);
+    void* buffer = memoryBlob == nullptr ? nullptr : memoryBlob->rwmap().as<void*>();
+    if (buffer == nullptr)
+        IE_THROW(NotAllocated) << "State session: storage of variable " << name << " is not allocated";
+    return buffer;
+}
+
+}  // namespace
+
+StateSession::StateSession(const BlobMap& states) : _states{states} {
+    for (auto&& state : _states)
+        GetBuffer(state.second, state.first);
+}
+
+const BlobMap& StateSession::GetStates() const {
+    return _states;
+}
+
+Blob::CPtr StateSession::GetState(const std::string& name) const {
+    auto it = _states.find(name);
+    if (it == _states.end())
+        IE_THROW(NotFound) << "State session doesn't have variable " << name;
+    return it->second;
+}
+
+void StateSession::Reset() {
+    for (auto&& state : _states)
+        std::memset(GetBuffer(state.second, state.first), 0, state.second->byteSize());
+}
+
+BlobMap StateSession::Snapshot() const {
+    BlobMap snapshot;
+    for (auto&& state : _states) {
+        auto copy = make_blob_with_precision(state.second->getTensorDesc());
+        copy->allocate();
+        std::memcpy(GetBuffer(copy, state.first), GetBuffer(state.second, state.first), state.second->byteSize());
+        snapshot.emplace(state.first, copy);
+    }
+    return snapshot;
+}
+
+void StateSession::Restore(const BlobMap& snapshot) {
+    if (snapshot.size() != _states.size())
+        IE_THROW(ParameterMismatch) << "State session: snapshot has " << snapshot.size()
+                                    << " variables, but the session has " << _states.size();
+    for (auto&& state : _states) {
+        auto it = snapshot.find(state.first);
+        if (it == snapshot.end())
+            IE_THROW(NotFound) << "State session: snapshot doesn't have variable " << state.first;
+        if (it->second == nullptr || it->second->byteSize() != state.second->byteSize())
+            IE_THROW(ParameterMismatch) << "State session: snapshot of variable " << state.first
+                                        << " has incompatible size";
+    }
+    for (auto&& state : _states) {
+        auto& source = snapshot.at(state.first);
+        std::memcpy(GetBuffer(state.second, state.first), GetBuffer(source, state.first), state.second->byteSize());
+    }
+}
+
+}  // namespace InferenceEngine
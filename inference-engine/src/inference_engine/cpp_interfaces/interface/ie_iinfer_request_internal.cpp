@@ -164,6 +164,14 @@ std::vector<std::shared_ptr<IVariableStateInternal>> IInferRequestInternal::Quer
     IE_THROW(NotImplemented);
 }
 
+StateSession::Ptr IInferRequestInternal::CreateStateSession() {
+    IE_THROW(NotImplemented);
+}
+
+void IInferRequestInternal::SetStateSessions(const std::vector<StateSession::Ptr>& sessions) {
+    IE_THROW(NotImplemented);
+}
+
 void IInferRequestInternal::StartAsync() {
     checkBlobs();
     StartAsyncImpl();
@@ -181,6 +189,15 @@ void IInferRequestInternal::SetCallback(Callback callback) {
     _callback = std::move(callback);
 }
 
+void IInferRequestInternal::SetInlineCallback(bool inlineCallback) {
+    _inlineCallback = inlineCallback;
+}
+
+void IInferRequestInternal::SetPriority(InferRequest::Priority priority, std::chrono::milliseconds deadline) {
+    _priority = priority;
+    _deadline = deadline;
+}
+
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
@@ -0,0 +1,110 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+#include "precision_utils.h"
+
+namespace InferenceEngine {
+
+// Converts 4 FP16 values stored in 32 bit lanes, follows PrecisionUtils::f16tof32
+static inline __m128 mm_f16tof32(__m128i h) {
+    const __m128i expMaskF16 = _mm_set1_epi32(0x7C00);
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    const __m128i exponent = _mm_and_si128(h, expMaskF16);
+    const __m128i mantissa = _mm_and_si128(h, _mm_set1_epi32(0x03FF));
+
+    // normal values: shift mantissa and exp to f32 position and change exp bias from 15 to 127
+    const __m128i normal = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 23 - 10),
+                                         _mm_set1_epi32((127 - 15) << 23));
+
+    // NAN and INF: NAN gets the 10th bit raised to be aligned with intrinsics
+    const __m128i isNan = _mm_andnot_si128(_mm_cmpeq_epi32(mantissa, _mm_setzero_si128()), _mm_set1_epi32(0x0200));
+    const __m128i nanInf = _mm_or_si128(_mm_slli_epi32(_mm_or_si128(mantissa, isNan), 23 - 10),
+                                        _mm_set1_epi32(0x7F800000));
+
+    // zero and denormals: 2^-14 * (1 + m / 2^10) - 2^-14 == m * 2^-24 is exact
+    const __m128 denormalBase = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128i denormal = _mm_castps_si128(_mm_sub_ps(
+        _mm_castsi128_ps(_mm_or_si128(_mm_slli_epi32(mantissa, 23 - 10), _mm_castps_si128(denormalBase))),
+        denormalBase));
+
+    __m128i u = _mm_blendv_epi8(normal, nanInf, _mm_cmpeq_epi32(exponent, expMaskF16));
+    u = _mm_blendv_epi8(u, denormal, _mm_cmpeq_epi32(exponent, _mm_setzero_si128()));
+
+    return _mm_castsi128_ps(_mm_or_si128(u, sign));
+}
+
+// Converts 4 FP32 values to FP16 stored in 32 bit lanes, follows PrecisionUtils::f32tof16:
+// rounds to nearest, saturates to the maximal f16 value and flushes denormals
+static inline __m128i mm_f32tof16(__m128 x) {
+    const __m128i expMaskF32 = _mm_set1_epi32(0x7F800000);
+    const __m128 min16 = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128 halfMin16 = _mm_mul_ps(min16, _mm_set1_ps(0.5f));
+    const __m128 max16 = _mm_castsi128_ps(_mm_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    const __m128i max16f16 = _mm_set1_epi32(((15 + 15) << 10) | 0x3FF);
+
+    const __m128i u = _mm_castps_si128(x);
+    const __m128i sign = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x8000));
+    const __m128i abs = _mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i exponent = _mm_and_si128(abs, expMaskF32);
+
+    // NAN and INF, the upper bits of NAN are truncated to 16 bits the same way as in the scalar code
+    const __m128i isNan = _mm_cmpeq_epi32(_mm_cmpeq_epi32(_mm_and_si128(abs, _mm_set1_epi32(0x007FFFFF)),
+                                                          _mm_setzero_si128()),
+                                          _mm_setzero_si128());
+    const __m128i nan = _mm_or_si128(_mm_srli_epi32(abs, 23 - 10), _mm_set1_epi32(0x0200));
+    const __m128i nanInf = _mm_blendv_epi8(_mm_set1_epi32(0x7C00), nan, isNan);
+
+    // create halfULP for f16 and add it to origin value to round to nearest
+    const __m128 halfULP = _mm_mul_ps(_mm_castsi128_ps(exponent), _mm_castsi128_ps(_mm_set1_epi32((127 - 11) << 23)));
+    const __m128 rounded = _mm_add_ps(_mm_castsi128_ps(abs), halfULP);
+
+    // change exp bias from 127 to 15 and round to f16
+    __m128i r = _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(rounded), _mm_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm_blendv_epi8(r, max16f16, _mm_castps_si128(_mm_cmpge_ps(rounded, max16)));
+    r = _mm_blendv_epi8(r, _mm_set1_epi32(1 << 10), _mm_castps_si128(_mm_cmplt_ps(rounded, min16)));
+    r = _mm_blendv_epi8(r, _mm_setzero_si128(), _mm_castps_si128(_mm_cmplt_ps(rounded, halfMin16)));
+    r = _mm_blendv_epi8(r, nanInf, _mm_cmpeq_epi32(exponent, expMaskF32));
+
+    return _mm_and_si128(_mm_or_si128(r, sign), _mm_set1_epi32(0xFFFF));
+}
+
+void f16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128 lo = mm_f16tof32(_mm_cvtepu16_epi32(h));
+        const __m128 hi = mm_f16tof32(_mm_cvtepu16_epi32(_mm_srli_si128(h, 8)));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(lo, vscale), vbias));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(hi, vscale), vbias));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(static_cast<ie_fp16>(src[i])) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vbias);
+        const __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(mm_f32tof16(lo), mm_f32tof16(hi)));
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace InferenceEngine
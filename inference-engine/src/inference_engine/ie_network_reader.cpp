@@ -126,6 +126,11 @@ void registerReaders() {
     if (irReaderv7)
         readers.emplace("xml", irReaderv7);
 
+    // try to load binary IR reader if library exists
+    auto irBinaryReader = create_if_exists("IRBinary", std::string("inference_engine_ir_binary_reader") + std::string(IE_BUILD_POSTFIX));
+    if (irBinaryReader)
+        readers.emplace("irb", irBinaryReader);
+
     initialized = true;
 }
 
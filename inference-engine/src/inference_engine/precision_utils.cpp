@@ -6,21 +6,73 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <exception>
+
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+#endif
+
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
+namespace {
+
+// Arrays up to this number of elements are converted by the calling thread
+constexpr size_t parallelConversionBlock = 64 * 1024;
+
+template <typename F>
+void convertInBlocks(size_t nelem, const F& convert) {
+    if (nelem <= parallelConversionBlock) {
+        convert(0, nelem);
+        return;
+    }
+
+    const size_t numBlocks = (nelem + parallelConversionBlock - 1) / parallelConversionBlock;
+    parallel_for(numBlocks, [&](size_t block) {
+        const size_t begin = block * parallelConversionBlock;
+        convert(begin, std::min(nelem, begin + parallelConversionBlock));
+    });
+}
+
+}  // namespace
+
 void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertInBlocks(nelem, [&](size_t begin, size_t end) {
+            f16tof32Arrays_sse42(dst + begin, src + begin, end - begin, scale, bias);
+        });
+        return;
+    }
+#endif
+
     const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
-    }
+    convertInBlocks(nelem, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertInBlocks(nelem, [&](size_t begin, size_t end) {
+            f32tof16Arrays_sse42(dst + begin, src + begin, end - begin, scale, bias);
+        });
+        return;
     }
+#endif
+
+    convertInBlocks(nelem, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
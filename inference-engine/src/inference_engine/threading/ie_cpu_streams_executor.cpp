@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <memory>
@@ -9,6 +11,8 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <chrono>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -203,8 +207,7 @@ struct CPUStreamsExecutor::Impl {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
                         if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                            task = Dequeue();
                         }
                     }
                     if (task) {
@@ -215,14 +218,39 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, const TaskScheduling& scheduling) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueue.push_back({std::move(task), scheduling, std::chrono::steady_clock::now()});
         }
         _queueCondVar.notify_one();
     }
 
+    // should be called under _mutex on non empty queue
+    Task Dequeue() {
+        const auto now = std::chrono::steady_clock::now();
+        // the queue is kept in the order of arrival, so the front task waits the longest
+        auto selected = _taskQueue.begin();
+        if (now - selected->_enqueued <= _config._taskStarvationTimeout) {
+            for (auto it = std::next(_taskQueue.begin()); it != _taskQueue.end(); ++it) {
+                if (std::make_pair(it->_scheduling.priority, it->_scheduling.deadline) <
+                    std::make_pair(selected->_scheduling.priority, selected->_scheduling.deadline)) {
+                    selected = it;
+                }
+            }
+        }
+
+        auto& delay = _queueingDelays[selected->_scheduling.priority];
+        const auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(now - selected->_enqueued);
+        delay._tasks++;
+        delay._total += waited;
+        delay._max = std::max(delay._max, waited);
+
+        auto task = std::move(selected->_task);
+        _taskQueue.erase(selected);
+        return task;
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
@@ -258,7 +286,13 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
+    struct QueuedTask {
+        Task                                    _task;
+        TaskScheduling                          _scheduling;
+        std::chrono::steady_clock::time_point   _enqueued;
+    };
+    std::deque<QueuedTask>                  _taskQueue;
+    std::vector<QueueingDelay>              _queueingDelays = std::vector<QueueingDelay>(TaskScheduling::priorities);
     bool                                    _isStopped = false;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
@@ -305,11 +339,20 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    runScheduled(std::move(task), {});
+}
+
+void CPUStreamsExecutor::runScheduled(Task task, const TaskScheduling& scheduling) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), scheduling);
     }
 }
 
+std::vector<CPUStreamsExecutor::QueueingDelay> CPUStreamsExecutor::GetQueueingDelays() {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    return _impl->_queueingDelays;
+}
+
 }  // namespace InferenceEngine
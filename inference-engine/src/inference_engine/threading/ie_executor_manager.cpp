@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "ie_common.h"
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 
@@ -45,6 +48,63 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+void ExecutorManagerImpl::setCPUThreadsBudget(int threads) {
+    std::lock_guard<std::mutex> guard(cpuThreadsMutex);
+    cpuThreadsBudget = std::max(0, threads);
+}
+
+int ExecutorManagerImpl::getCPUThreadsBudget() {
+    std::lock_guard<std::mutex> guard(cpuThreadsMutex);
+    return cpuThreadsBudget;
+}
+
+CPUThreadsReservation::Ptr ExecutorManagerImpl::reserveCPUThreads(const std::string& name, int threads, int weight) {
+    std::lock_guard<std::mutex> guard(cpuThreadsMutex);
+    cpuThreadsReservations.erase(
+        std::remove_if(cpuThreadsReservations.begin(), cpuThreadsReservations.end(),
+                       [](const std::weak_ptr<CPUThreadsReservation>& it) {
+                           return it.expired();
+                       }),
+        cpuThreadsReservations.end());
+
+    auto reservation = std::make_shared<CPUThreadsReservation>();
+    reservation->_name = name;
+    reservation->_id = cpuThreadsReservationsNum++;
+    reservation->_weight = std::max(1, weight);
+    reservation->_threads = std::max(1, threads);
+    if (cpuThreadsBudget > 0) {
+        int reservedThreads = 0;
+        int weights = reservation->_weight;
+        for (const auto& it : cpuThreadsReservations) {
+            auto other = it.lock();
+            if (other) {
+                reservedThreads += other->_threads;
+                weights += other->_weight;
+            }
+        }
+        // running arenas can't be shrunk, so the network gets only the threads nobody holds
+        const int freeThreads = cpuThreadsBudget - reservedThreads;
+        if (freeThreads <= 0)
+            IE_THROW() << "The CPU threads budget of " << cpuThreadsBudget << " threads is reserved by "
+                       << cpuThreadsReservations.size() << " loaded networks, network " << name << " can't be loaded";
+        const int share = std::max(1, cpuThreadsBudget * reservation->_weight / weights);
+        reservation->_threads = std::min({reservation->_threads, freeThreads, share});
+    }
+    cpuThreadsReservations.emplace_back(reservation);
+    return reservation;
+}
+
+std::vector<CPUThreadsReservation> ExecutorManagerImpl::getCPUThreadsReservations() {
+    std::lock_guard<std::mutex> guard(cpuThreadsMutex);
+    std::vector<CPUThreadsReservation> reservations;
+    for (const auto& it : cpuThreadsReservations) {
+        auto reservation = it.lock();
+        if (reservation)
+            reservations.push_back(*reservation);
+    }
+    return reservations;
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -133,4 +193,20 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+void ExecutorManager::setCPUThreadsBudget(int threads) {
+    _impl.setCPUThreadsBudget(threads);
+}
+
+int ExecutorManager::getCPUThreadsBudget() {
+    return _impl.getCPUThreadsBudget();
+}
+
+CPUThreadsReservation::Ptr ExecutorManager::reserveCPUThreads(const std::string& name, int threads, int weight) {
+    return _impl.reserveCPUThreads(name, threads, weight);
+}
+
+std::vector<CPUThreadsReservation> ExecutorManager::getCPUThreadsReservations() {
+    return _impl.getCPUThreadsReservations();
+}
+
 }  // namespace InferenceEngine
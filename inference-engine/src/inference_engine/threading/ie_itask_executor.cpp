@@ -11,6 +11,12 @@
 
 namespace InferenceEngine {
 
+constexpr int TaskScheduling::priorities;
+
+void ITaskExecutor::runScheduled(Task task, const TaskScheduling&) {
+    run(std::move(task));
+}
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
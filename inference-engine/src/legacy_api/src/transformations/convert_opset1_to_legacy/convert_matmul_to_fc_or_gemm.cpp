@@ -17,6 +17,7 @@
 
 #include <legacy/ngraph_ops/fully_connected.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/common_optimizations/mark_weights_decompression.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertMatMulToFCorGemm, "ConvertMatMulToFCorGemm", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertMatMulToFC, "ConvertMatMulToFC", 0);
@@ -108,11 +109,12 @@ ngraph::pass::ConvertMatMulToFC::ConvertMatMulToFC() {
         // vector of new nGraph operations
         NodeVector new_ops;
 
-        // Check that if second inputs is Constant operation and it's shape without ones dimensions has length <= 2
-        // we replace MatMul with FullyConnected operation.
+        // Check that if second inputs is Constant operation (or compressed weights decompression subgraph)
+        // and it's shape without ones dimensions has length <= 2 we replace MatMul with FullyConnected operation.
         // Otherwise we replace MatMul with Gemm.
         if ((std::dynamic_pointer_cast<opset1::Constant>    (fc_input_b.get_node_shared_ptr())  ||
-             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())) &&
+             std::dynamic_pointer_cast<opset1::FakeQuantize>(fc_input_b.get_node_shared_ptr())  ||
+             ngraph::is_weights_decompression(fc_input_b.get_node_shared_ptr())) &&
             std::count_if(shape_b.begin(), shape_b.end(), [](size_t x) {
                 return x != 1;
             }) <= 2) {
@@ -9,6 +9,7 @@
 #include "legacy/ngraph_ops/eltwise.hpp"
 #include "legacy/ngraph_ops/power.hpp"
 #include "transformations/utils/utils.hpp"
+#include "transformations/common_optimizations/mark_weights_decompression.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
@@ -55,7 +56,8 @@ ngraph::matcher_pass_callback get_callback() {
         const auto intInputs = !lin_op->get_input_element_type(0).is_real() &&
                                !lin_op->get_input_element_type(1).is_real();
 
-        if (!lin_op->get_element_type().is_real() || intInputs) {
+        // Weights decompression keeps constant operand as is, it is consumed by plugin together with compressed weights
+        if (!lin_op->get_element_type().is_real() || intInputs || ngraph::is_weights_decompression(lin_op)) {
             return convert_to_eltwise<T>(lin_op,
                                          lin_op->input(0).get_source_output(),
                                          lin_op->input(1).get_source_output());
@@ -9,9 +9,11 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include "mkldnn_primitive_cache.h"
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
@@ -38,6 +40,8 @@ Config::Config() {
     if (!with_cpu_x86_bfloat16())
         enforceBF16 = false;
 
+    primitiveCacheCapacity = MKLDNNPrimitiveCache::defaultCapacity;
+
     updateProperties();
 }
 
@@ -111,6 +115,68 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_TUNING_MODE) {
+            if (val == PluginConfigParams::YES) tuningMode = true;
+            else if (val == PluginConfigParams::NO) tuningMode = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_TUNING_MODE
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE) {
+            // empty string means that tuning results are not persisted
+            tuningCacheFile = val;
+        } else if (key == CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            primitiveCacheCapacity = static_cast<size_t>(val_i);
+        } else if (key == CPUConfigParams::KEY_CPU_JIT_KERNEL_CACHE_DIR) {
+            // empty string means that kernels are not persisted
+            jitKernelCacheDir = val;
+        } else if (key == CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES) workspaceHugePages = true;
+            else if (val == PluginConfigParams::NO) workspaceHugePages = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_PREPROCESS_THREADS) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PREPROCESS_THREADS
+                                   << ". Expected only non-negative integer numbers";
+            preprocessThreads = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_THREADS_BUDGET) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_THREADS_BUDGET
+                                   << ". Expected only non-negative integer numbers";
+            threadsBudget = val_i;
+        } else if (key == CPUConfigParams::KEY_CPU_THREADS_WEIGHT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i <= 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_THREADS_WEIGHT
+                                   << ". Expected only positive integer numbers";
+            threadsWeight = val_i;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -158,6 +224,20 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (tuningMode)
+            _config.insert({ CPUConfigParams::KEY_CPU_TUNING_MODE, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_TUNING_MODE, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE, tuningCacheFile });
+        _config.insert({ CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, std::to_string(primitiveCacheCapacity) });
+        _config.insert({ CPUConfigParams::KEY_CPU_JIT_KERNEL_CACHE_DIR, jitKernelCacheDir });
+        if (workspaceHugePages)
+            _config.insert({ CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, std::to_string(preprocessThreads) });
+        _config.insert({ CPUConfigParams::KEY_CPU_THREADS_BUDGET, std::to_string(threadsBudget) });
+        _config.insert({ CPUConfigParams::KEY_CPU_THREADS_WEIGHT, std::to_string(threadsWeight) });
     }
 }
 
@@ -25,6 +25,14 @@ struct Config {
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    bool tuningMode = false;
+    std::string tuningCacheFile = "";
+    size_t primitiveCacheCapacity = 0;
+    std::string jitKernelCacheDir = "";
+    bool workspaceHugePages = false;
+    int preprocessThreads = 0;
+    int threadsBudget = 0;
+    int threadsWeight = 1;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
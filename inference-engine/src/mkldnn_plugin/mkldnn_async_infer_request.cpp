@@ -3,13 +3,29 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_itt.h"
 #include <memory>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
+                                                               const InferenceEngine::ITaskExecutor::Ptr& preprocessExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto mkldnnRequest = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    mkldnnRequest->SetAsyncRequest(this);
+
+    if (preprocessExecutor != nullptr) {
+        _pipeline = {
+            {preprocessExecutor, [mkldnnRequest] {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNAsyncInferRequest::Preprocess");
+                mkldnnRequest->InferPreprocess();
+            }},
+            {taskExecutor, [mkldnnRequest] {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNAsyncInferRequest::Infer");
+                mkldnnRequest->InferGraph();
+            }}
+        };
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
@@ -13,8 +13,13 @@ namespace MKLDNNPlugin {
 
 class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
+    /**
+     * @brief      Creates the asynchronous request. If the preprocess executor is set, the input preprocessing runs as a separate
+     *             pipeline stage on it, so it overlaps with the inference of other requests in the task executor.
+     */
     MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
+                            const InferenceEngine::ITaskExecutor::Ptr &preprocessExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
 };
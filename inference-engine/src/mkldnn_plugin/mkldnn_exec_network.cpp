@@ -3,6 +3,7 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
@@ -10,6 +11,7 @@
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
+#include "mkldnn_primitive_tuner.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
@@ -236,6 +238,20 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+
+        const int requestedThreads = std::max(1, streamsExecutorConfig._streams) * streamsExecutorConfig._threadsPerStream;
+        _threadsReservation = InferenceEngine::ExecutorManager::getInstance()->reserveCPUThreads(_name, requestedThreads, _cfg.threadsWeight);
+        const int grantedThreads = _threadsReservation->_threads;
+        if (grantedThreads < requestedThreads) {
+            // the streams get less threads first, then there are less streams than threads are granted
+            if (streamsExecutorConfig._streams > grantedThreads) {
+                streamsExecutorConfig._streams = grantedThreads;
+                _cfg.streamExecutorConfig._streams = grantedThreads;
+                _cfg._config.clear();
+                _cfg.updateProperties();
+            }
+            streamsExecutorConfig._threadsPerStream = std::max(1, grantedThreads / std::max(1, streamsExecutorConfig._streams));
+        }
         _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
     if (0 != cfg.streamExecutorConfig._streams) {
@@ -244,6 +260,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (cfg.preprocessThreads > 0) {
+        // single thread streams, so the preprocessing of several requests runs in parallel
+        _preprocessExecutor = InferenceEngine::ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreprocessExecutor", cfg.preprocessThreads, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    }
+
+    if (_cfg.tuningMode || !_cfg.tuningCacheFile.empty())
+        _primitiveTuner = std::make_shared<MKLDNNPrimitiveTuner>(_cfg, MKLDNNGraph::getEngine());
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
@@ -298,6 +322,7 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setPrimitiveTuner(_primitiveTuner);
                 graphLock._graph.CreateGraph(localNetwork, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -329,7 +354,9 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _preprocessExecutor, _callbackExecutor);
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -364,6 +391,12 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPU_METRIC_KEY(ELIMINATED_REORDERS));
+        metrics.push_back(CPU_METRIC_KEY(ELIMINATED_REORDER_BYTES));
+        metrics.push_back(CPU_METRIC_KEY(PRECISION_CONVERSIONS));
+        metrics.push_back(CPU_METRIC_KEY(WORKSPACE_NUMA_PLACEMENT));
+        metrics.push_back(CPU_METRIC_KEY(PIPELINE_STAGE_LATENCIES));
+        metrics.push_back(CPU_METRIC_KEY(QUEUEING_DELAYS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -378,6 +411,43 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPU_METRIC_KEY(ELIMINATED_REORDERS)) {
+        const auto& statistics = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetLayoutStatistics();
+        IE_SET_METRIC_RETURN(CPU_ELIMINATED_REORDERS, static_cast<unsigned int>(statistics.eliminatedReorders));
+    } else if (name == CPU_METRIC_KEY(ELIMINATED_REORDER_BYTES)) {
+        const auto& statistics = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph.GetLayoutStatistics();
+        IE_SET_METRIC_RETURN(CPU_ELIMINATED_REORDER_BYTES, static_cast<uint64_t>(statistics.eliminatedReorderBytes));
+    } else if (name == CPU_METRIC_KEY(PRECISION_CONVERSIONS)) {
+        const auto& graph = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph;
+        IE_SET_METRIC_RETURN(CPU_PRECISION_CONVERSIONS, static_cast<unsigned int>(graph.GetPrecisionConversions()));
+    } else if (name == CPU_METRIC_KEY(WORKSPACE_NUMA_PLACEMENT)) {
+        std::map<int, uint64_t> placement;
+        for (auto& g : const_cast<MKLDNNExecNetwork*>(this)->_graphs) {
+            auto graphLock = Graph::Lock(g);
+            if (!graphLock._graph.IsReady())
+                continue;
+            for (const auto& nodeBytes : graphLock._graph.GetWorkspacePlacement())
+                placement[nodeBytes.first] += nodeBytes.second;
+        }
+        IE_SET_METRIC_RETURN(CPU_WORKSPACE_NUMA_PLACEMENT, placement);
+    } else if (name == CPU_METRIC_KEY(PIPELINE_STAGE_LATENCIES)) {
+        std::map<std::string, float> latencies = {
+            {"PREPROCESS", _preprocessStatistics.averageMs()},
+            {"INFER", _inferStatistics.averageMs()}
+        };
+        IE_SET_METRIC_RETURN(CPU_PIPELINE_STAGE_LATENCIES, latencies);
+    } else if (name == CPU_METRIC_KEY(QUEUEING_DELAYS)) {
+        std::map<std::string, float> delays;
+        auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+        if (nullptr != streamsExecutor) {
+            const auto queueingDelays = streamsExecutor->GetQueueingDelays();
+            const char* priorities[] = {"HIGH", "NORMAL", "LOW"};
+            for (int priority = 0; priority < TaskScheduling::priorities; priority++) {
+                const auto& delay = queueingDelays[priority];
+                delays[priorities[priority]] = delay._tasks == 0 ? 0.f : static_cast<float>(delay._total.count()) / delay._tasks / 1e6f;
+            }
+        }
+        IE_SET_METRIC_RETURN(CPU_QUEUEING_DELAYS, delays);
     } else {
         IE_THROW() << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -9,7 +9,10 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <threading/ie_executor_manager.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <memory>
 #include <map>
@@ -47,6 +50,21 @@ public:
 
 protected:
     friend class MKLDNNInferRequest;
+
+    struct StageStatistics {
+        std::atomic<uint64_t>   _totalNs = {0};
+        std::atomic<uint64_t>   _count = {0};
+
+        void add(std::chrono::steady_clock::duration duration) {
+            _totalNs += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+            _count++;
+        }
+        float averageMs() const {
+            const auto count = _count.load();
+            return count == 0 ? 0.f : static_cast<float>(_totalNs.load()) / count / 1e6f;
+        }
+    };
+
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::CNNNetwork                 _clonedNetwork;
@@ -54,6 +72,14 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // runs the input preprocessing of asynchronous requests if CPU_PREPROCESS_THREADS is set
+    InferenceEngine::ITaskExecutor::Ptr         _preprocessExecutor;
+    StageStatistics                             _preprocessStatistics;
+    StageStatistics                             _inferStatistics;
+    // threads of the process wide budget used by the streams of the network
+    InferenceEngine::CPUThreadsReservation::Ptr _threadsReservation;
+    // shared by the graphs of all streams, so every node is benchmarked once
+    std::shared_ptr<MKLDNNPrimitiveTuner>       _primitiveTuner;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
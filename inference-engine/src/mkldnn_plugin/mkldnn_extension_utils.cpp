@@ -7,6 +7,7 @@
 #include <limits>
 #include <vector>
 #include <numeric>
+#include <sstream>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -198,6 +199,23 @@ std::string MKLDNNExtensionUtils::getReorderArgs(const InferenceEngine::TensorDe
     return inArgs + "_" + outArgs;
 }
 
+std::string MKLDNNExtensionUtils::getLayoutSignature(const InferenceEngine::TensorDesc &desc) {
+    std::ostringstream signature;
+    signature << desc.getPrecision().name() << ":";
+    if (desc.getLayout() == InferenceEngine::Layout::ANY) {
+        signature << "any";
+        return signature.str();
+    }
+    const auto& blocking = desc.getBlockingDesc();
+    for (size_t i = 0; i < blocking.getOrder().size(); i++) {
+        signature << (i ? "," : "") << blocking.getOrder()[i];
+        // inner blocks are the only block dims which define the layout
+        if (i >= desc.getDims().size())
+            signature << "/" << blocking.getBlockDims()[i];
+    }
+    return signature.str();
+}
+
 InferenceEngine::Precision MKLDNNExtensionUtils::getMaxPrecision(std::vector<InferenceEngine::Precision> precisions) {
     if (!precisions.empty()) {
         std::sort(precisions.begin(), precisions.end(),
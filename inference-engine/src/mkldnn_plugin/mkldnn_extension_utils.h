@@ -78,6 +78,8 @@ public:
     static InferenceEngine::TensorDesc getUninitTensorDesc(const InferenceEngine::TensorDesc& desc);
     static bool initTensorsAreEqual(const InferenceEngine::TensorDesc &desc1, const InferenceEngine::TensorDesc &desc2);
     static std::string getReorderArgs(const InferenceEngine::TensorDesc &parentDesc, const InferenceEngine::TensorDesc &childDesc);
+    /** Returns string which identifies precision and layout (order and inner blocks) of the tensor regardless of its strides */
+    static std::string getLayoutSignature(const InferenceEngine::TensorDesc &desc);
     static InferenceEngine::Precision getMaxPrecision(std::vector<InferenceEngine::Precision> precisions);
 };
 
@@ -12,6 +12,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "mkldnn_graph.h"
@@ -20,6 +21,7 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_primitive_tuner.h"
 #include "mkldnn_itt.h"
 #include "mkldnn_infer_request.h"
 #include <nodes/mkldnn_input_node.h>
@@ -39,6 +41,7 @@
 #include "utils/general_utils.h"
 #include "utils/debug_capabilities.h"
 #include "utils/node_dumper.h"
+#include "utils/numa_memory.h"
 
 /*****************************************************
  * Debug capability
@@ -338,6 +341,8 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    layoutStatistics = optimizer.ApplyLayoutOptimizations(*this);
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -345,10 +350,14 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    CountPrecisionConversions();
+
     Allocate();
 
     CreatePrimitives();
 
+    AllocateScratchpad();
+
     SetOriginalLayerNames();
 
     if (!config.dumpToDot.empty())
@@ -366,6 +375,25 @@ void MKLDNNGraph::InitGraph() {
     ExecuteConstantNodesOnly();
 }
 
+void MKLDNNGraph::CountPrecisionConversions() {
+    precisionConversions = 0;
+    for (auto &graphNode : graphNodes) {
+        if (graphNode->getType() != Reorder && graphNode->getType() != Convert)
+            continue;
+        // conversions on constant paths are executed only once
+        if (graphNode->isConstant())
+            continue;
+        auto selectedPD = graphNode->getSelectedPrimitiveDescriptor();
+        if (selectedPD == nullptr)
+            continue;
+        const auto& config = selectedPD->getConfig();
+        if (config.inConfs.empty() || config.outConfs.empty())
+            continue;
+        if (config.inConfs[0].desc.getPrecision() != config.outConfs[0].desc.getPrecision())
+            precisionConversions++;
+    }
+}
+
 void MKLDNNGraph::SetOriginalLayerNames() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::SetOriginalLayerNames");
 
@@ -398,8 +426,42 @@ void MKLDNNGraph::InitNodes() {
     }
 }
 
+namespace {
+
+// Runs func for every node concurrently, the first exception is rethrown on the calling thread
+template <typename F>
+void parallelForNodes(const std::vector<MKLDNNNodePtr>& nodes, const F& func) {
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    parallel_for(nodes.size(), [&](size_t i) {
+        try {
+            func(nodes[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{exceptionMutex};
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+// Splits nodes into the ones which can be initialized concurrently and the rest ones. The rest nodes are processed after
+// the concurrent ones in topological order, so the nodes which look at their neighbours see them already initialized.
+void splitConcurrentNodes(const std::vector<MKLDNNNodePtr>& graphNodes,
+                          std::vector<MKLDNNNodePtr>& concurrentNodes, std::vector<MKLDNNNodePtr>& sequentialNodes) {
+    for (auto &node : graphNodes) {
+        if (node->canBeInitializedConcurrently())
+            concurrentNodes.push_back(node);
+        else
+            sequentialNodes.push_back(node);
+    }
+}
+
+}  // namespace
+
 void MKLDNNGraph::InitDescriptors() {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitDescriptors");
 
     for (auto &node : graphNodes) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
@@ -407,20 +469,49 @@ void MKLDNNGraph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
+    auto initSupportedDescriptors = [](const MKLDNNNodePtr& node) {
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.filterSupportedPrimitiveDescriptors);
         node->filterSupportedPrimitiveDescriptors();
+    };
+
+    std::vector<MKLDNNNodePtr> concurrentNodes, sequentialNodes;
+    splitConcurrentNodes(graphNodes, concurrentNodes, sequentialNodes);
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitDescriptors::Concurrent");
+        parallelForNodes(concurrentNodes, initSupportedDescriptors);
     }
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::InitDescriptors::Sequential");
+        for (auto &node : sequentialNodes)
+            initSupportedDescriptors(node);
+    }
+
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "SelectOptimal");
+
+    auto tuner = primitiveTuner;
+    if (!tuner && (config.tuningMode || !config.tuningCacheFile.empty()))
+        tuner = std::make_shared<MKLDNNPrimitiveTuner>(config, getEngine());
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
+        // tuned node overrides the default selection, its consumers adapt to the tuned layouts afterwards
+        if (tuner)
+            tuner->tune(node);
     }
+
+    if (tuner)
+        tuner->save();
 }
 
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
@@ -433,7 +524,6 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
-    mkldnn::stream stream(eng);
 
     using shared_memory_ptr = MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr;
 
@@ -459,10 +549,8 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
-
+    auto executeNode = [&](MKLDNNNodePtr graphNode) {
+        mkldnn::stream stream(eng);
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(graphNode);
 
@@ -475,6 +563,35 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() {
         } else {
             graphNode->execute(stream);
         }
+    };
+
+    // Constant nodes of the same DAG level don't depend on each other and are executed concurrently.
+    // In-place nodes share memory with their neighbours, so they are executed one by one.
+    std::unordered_map<MKLDNNNode*, size_t> levels;
+    std::vector<std::vector<MKLDNNNodePtr>> concurrentNodes, sequentialNodes;
+    for (auto &graphNode : graphNodes) {
+        if (!graphNode->isConstant())
+            continue;
+
+        size_t level = 0;
+        for (size_t i = 0; i < graphNode->getParentEdges().size(); i++) {
+            auto parentLevel = levels.find(graphNode->getParentEdgeAt(i)->getParent().get());
+            if (parentLevel != levels.end())
+                level = std::max(level, parentLevel->second + 1);
+        }
+        levels[graphNode.get()] = level;
+
+        if (concurrentNodes.size() <= level) {
+            concurrentNodes.resize(level + 1);
+            sequentialNodes.resize(level + 1);
+        }
+        (graphNode->isInplace() ? sequentialNodes : concurrentNodes)[level].push_back(graphNode);
+    }
+
+    for (size_t level = 0; level < concurrentNodes.size(); level++) {
+        parallelForNodes(concurrentNodes[level], executeNode);
+        for (auto &graphNode : sequentialNodes[level])
+            executeNode(graphNode);
     }
 }
 
@@ -685,6 +802,12 @@ void MKLDNNGraph::AllocateWithReuse() {
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
 
+    // graphs are created by the threads of their streams, so touching the workspace here places its pages on the NUMA node
+    // of the stream instead of the node of the thread which happens to run the first inference
+    if (config.workspaceHugePages)
+        adviseHugePages(memWorkspace->GetData(), total_size);
+    firstTouchMemory(memWorkspace->GetData(), total_size);
+
     if (edge_clusters.empty())
         return;
 
@@ -712,6 +835,12 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+std::map<int, uint64_t> MKLDNNGraph::GetWorkspacePlacement() const {
+    if (!memWorkspace)
+        return {};
+    return getMemoryPlacement(memWorkspace->GetData(), memWorkspace->GetSize());
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -732,9 +861,41 @@ void MKLDNNGraph::Allocate() {
 
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // JIT compilation of heavy primitives dominates the network loading time, so they are created in parallel
+    auto createPrimitive = [](const MKLDNNNodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
         node->createPrimitive();
+    };
+
+    std::vector<MKLDNNNodePtr> concurrentNodes, sequentialNodes;
+    splitConcurrentNodes(graphNodes, concurrentNodes, sequentialNodes);
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::CreatePrimitives::Concurrent");
+        parallelForNodes(concurrentNodes, createPrimitive);
+    }
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::CreatePrimitives::Sequential");
+    for (auto& node : sequentialNodes)
+        createPrimitive(node);
+}
+
+void MKLDNNGraph::AllocateScratchpad() {
+    // nodes are executed one by one, so instead of a scratchpad per node all of them use one sized for the largest
+    size_t size = 0;
+    for (auto& node : graphNodes)
+        size = std::max(size, node->scratchpadDesc.get_size());
+    if (size == 0) {
+        memScratchpad.reset();
+        return;
+    }
+
+    memScratchpad = std::make_shared<MKLDNNMemory>(eng);
+    memScratchpad->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+    // placed on the NUMA node of the stream for the same reason as the workspace
+    firstTouchMemory(memScratchpad->GetData(), size);
+
+    for (auto& node : graphNodes) {
+        if (node->scratchpadDesc.get_size() != 0)
+            node->primArgs[DNNL_ARG_SCRATCHPAD] = mkldnn::memory(node->scratchpadDesc, eng, memScratchpad->GetData());
     }
 }
 
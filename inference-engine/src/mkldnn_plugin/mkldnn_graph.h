@@ -20,6 +20,7 @@
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
+class MKLDNNPrimitiveTuner;
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -30,6 +31,15 @@ public:
         Ready = 1,
     };
 
+    /**
+     * @brief Layout mismatches on non-constant edges which were removed by the whole-graph layout assignment.
+     * Every mismatch results in a Reorder node executed on each inference.
+     */
+    struct LayoutStatistics {
+        size_t eliminatedReorders = 0;
+        size_t eliminatedReorderBytes = 0;
+    };
+
     MKLDNNGraph() = default;
 
     Status GetStatus() {
@@ -41,6 +51,12 @@ public:
     }
 
     void setConfig(const Config &cfg);
+    /**
+     * @brief Sets the tuner shared with the graphs of other streams, otherwise the graph creates own tuner if tuning is enabled
+     */
+    void setPrimitiveTuner(const std::shared_ptr<MKLDNNPrimitiveTuner>& tuner) {
+        primitiveTuner = tuner;
+    }
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
@@ -82,12 +98,29 @@ public:
     }
 
 
-    mkldnn::engine getEngine() const {
+    static mkldnn::engine getEngine() {
         return eng;
     }
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    const LayoutStatistics& GetLayoutStatistics() const {
+        return layoutStatistics;
+    }
+
+    /**
+     * @brief Number of Reorder and Convert nodes executed on each inference which change the tensor precision,
+     * e.g. BF16 <-> FP32 conversions around nodes without native BF16 support.
+     */
+    size_t GetPrecisionConversions() const {
+        return precisionConversions;
+    }
+
+    /**
+     * @brief Number of bytes of the activations workspace placed on each NUMA node
+     */
+    std::map<int, uint64_t> GetWorkspacePlacement() const;
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -181,7 +214,11 @@ protected:
 
     bool reuse_io_tensors = true;
 
+    std::shared_ptr<MKLDNNPrimitiveTuner> primitiveTuner;
+
     MKLDNNMemoryPtr memWorkspace;
+    // scratchpad shared by the primitives of all nodes
+    MKLDNNMemoryPtr memScratchpad;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -191,18 +228,23 @@ protected:
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
+    LayoutStatistics layoutStatistics;
+    size_t precisionConversions = 0;
+
     static mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const InferenceEngine::TensorIterator::Body &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
     void InitGraph();
     void InitNodes();
+    void CountPrecisionConversions();
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void AllocateScratchpad();
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
 
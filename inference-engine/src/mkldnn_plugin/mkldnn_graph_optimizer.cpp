@@ -17,8 +17,10 @@
 #include <nodes/mkldnn_permute_node.h>
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 
 #include "mkldnn/ie_mkldnn.h"
+#include "ie_parallel.hpp"
 
 #include <blob_factory.hpp>
 #include <legacy/ie_layers_internal.hpp>
@@ -40,6 +42,8 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <functional>
+#include <numeric>
 
 #include "mkldnn_itt.h"
 
@@ -129,6 +133,10 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFullyConnectedAndSimpleOperation");
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -175,6 +183,162 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+namespace {
+
+// Max number of passes over the graph, every pass strictly decreases total reorders size so it converges anyway
+constexpr int layoutOptimizationPasses = 8;
+
+const TensorDesc* getSelectedOutputDesc(const MKLDNNNodePtr& node, int port) {
+    auto selectedPd = node->getSelectedPrimitiveDescriptor();
+    if (selectedPd == nullptr || selectedPd->getConfig().outConfs.empty())
+        return nullptr;
+    const auto& outConfs = selectedPd->getConfig().outConfs;
+    return &outConfs[port >= 0 && static_cast<size_t>(port) < outConfs.size() ? port : 0].desc;
+}
+
+const TensorDesc* getSelectedInputDesc(const MKLDNNNodePtr& node, int port) {
+    auto selectedPd = node->getSelectedPrimitiveDescriptor();
+    if (selectedPd == nullptr || port < 0 || static_cast<size_t>(port) >= selectedPd->getConfig().inConfs.size())
+        return nullptr;
+    return &selectedPd->getConfig().inConfs[port].desc;
+}
+
+// Memory traffic of the reorder which is inserted between tensors with different layouts
+size_t reorderBytes(const TensorDesc& from, const TensorDesc& to) {
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(from, to))
+        return 0;
+    auto tensorBytes = [](const TensorDesc& desc) {
+        const auto& dims = desc.getDims();
+        return std::accumulate(dims.begin(), dims.end(), desc.getPrecision().size(), std::multiplies<size_t>());
+    };
+    return tensorBytes(from) + tensorBytes(to);
+}
+
+}  // namespace
+
+MKLDNNGraph::LayoutStatistics MKLDNNGraphOptimizer::ApplyLayoutOptimizations(MKLDNNGraph &graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraphOptimizer::ApplyLayoutOptimizations");
+    auto& graphNodes = graph.GetNodes();
+
+    auto collectStatistics = [&graph]() {
+        MKLDNNGraph::LayoutStatistics statistics;
+        for (auto& edge : graph.GetEdges()) {
+            auto parent = edge->getParent();
+            // reorders on constant paths are executed only once
+            if (parent->isConstant())
+                continue;
+            auto from = getSelectedOutputDesc(parent, edge->getInputNum());
+            auto to = getSelectedInputDesc(edge->getChild(), edge->getOutputNum());
+            if (from == nullptr || to == nullptr)
+                continue;
+            size_t bytes = reorderBytes(*from, *to);
+            if (bytes) {
+                statistics.eliminatedReorders++;
+                statistics.eliminatedReorderBytes += bytes;
+            }
+        }
+        return statistics;
+    };
+
+    auto initial = collectStatistics();
+    if (initial.eliminatedReorders == 0)
+        return {};
+
+    // Iterated conditional modes: each layout-flexible node takes the descriptor which minimizes reorders on all its edges
+    // given the current choice of its neighbours. Total reorders size never grows, so the result is not worse than
+    // the node by node selection.
+    for (int pass = 0; pass < layoutOptimizationPasses; pass++) {
+        bool changed = false;
+        for (auto& node : graphNodes) {
+            if (!IsLayoutFlexible(node))
+                continue;
+
+            const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+            const size_t selectedIdx = static_cast<size_t>(node->selectedPrimitiveDescriptorIndex);
+            const auto implType = supportedPds[selectedIdx].getImplementationType();
+
+            size_t bestIdx = selectedIdx;
+            size_t bestBytes = LayoutMismatchBytes(node, selectedIdx);
+            for (size_t i = 0; i < supportedPds.size() && bestBytes; i++) {
+                // another implementation may have completely different performance, only the layout is changed
+                if (i == selectedIdx || supportedPds[i].getImplementationType() != implType)
+                    continue;
+                const auto& config = supportedPds[i].getConfig();
+                bool inPlace = false;
+                for (const auto& confs : {config.inConfs, config.outConfs}) {
+                    for (const auto& conf : confs)
+                        inPlace |= conf.inPlace >= 0;
+                }
+                if (inPlace || config.inConfs.size() != supportedPds[selectedIdx].getConfig().inConfs.size())
+                    continue;
+
+                size_t bytes = LayoutMismatchBytes(node, i);
+                if (bytes < bestBytes) {
+                    bestBytes = bytes;
+                    bestIdx = i;
+                }
+            }
+
+            if (bestIdx != selectedIdx) {
+                node->selectPrimitiveDescriptorByIndex(static_cast<int>(bestIdx));
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    auto optimized = collectStatistics();
+    initial.eliminatedReorders -= std::min(initial.eliminatedReorders, optimized.eliminatedReorders);
+    initial.eliminatedReorderBytes -= std::min(initial.eliminatedReorderBytes, optimized.eliminatedReorderBytes);
+    return initial;
+}
+
+bool MKLDNNGraphOptimizer::IsLayoutFlexible(const MKLDNNNodePtr& node) {
+    // Heavy nodes keep the layouts selected for them since their kernels performance depends on the layout.
+    // Nodes with special selection logic or in-place semantics are skipped as well.
+    if (IsOneOf(node->getType(), {Input, Output, Reorder, Reshape, Concatenation, Split, MemoryInput, MemoryOutput, TensorIterator,
+                                  Convolution, Deconvolution, BinaryConvolution, FullyConnected, Gemm, RNNCell, RNNSeq}))
+        return false;
+
+    auto selectedPd = node->getSelectedPrimitiveDescriptor();
+    if (selectedPd == nullptr || node->getSupportedPrimitiveDescriptors().size() < 2 || node->isConstant())
+        return false;
+
+    for (const auto& confs : {selectedPd->getConfig().inConfs, selectedPd->getConfig().outConfs}) {
+        for (const auto& conf : confs) {
+            if (conf.inPlace >= 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+size_t MKLDNNGraphOptimizer::LayoutMismatchBytes(const MKLDNNNodePtr& node, size_t idx) {
+    const auto& config = node->getSupportedPrimitiveDescriptors()[idx].getConfig();
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < node->getParentEdges().size() && i < config.inConfs.size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        auto parent = edge->getParent();
+        auto from = getSelectedOutputDesc(parent, edge->getInputNum());
+        if (from == nullptr || parent->isConstant())
+            continue;
+        bytes += reorderBytes(*from, config.inConfs[i].desc);
+    }
+
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        auto to = getSelectedInputDesc(edge->getChild(), edge->getOutputNum());
+        int port = edge->getInputNum();
+        if (to == nullptr || config.outConfs.empty())
+            continue;
+        bytes += reorderBytes(config.outConfs[port >= 0 && static_cast<size_t>(port) < config.outConfs.size() ? port : 0].desc, *to);
+    }
+
+    return bytes;
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -673,12 +837,277 @@ static bool BF16QuantizeNodeFusing(MKLDNNNodePtr parentNode, MKLDNNNodePtr child
             childNode->getCnnLayer()->outData[0].get()->getPrecision());
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstInput = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->getCnnLayer() && node->getCnnLayer()->type == "Const" &&
+               node->getChildEdges().size() == 1;
+    };
+
+    auto getBlobValue = [](const Blob::Ptr& blob, size_t idx) -> float {
+        switch (blob->getTensorDesc().getPrecision()) {
+            case Precision::FP32: return blob->cbuffer().as<const float*>()[idx];
+            case Precision::I32: return static_cast<float>(blob->cbuffer().as<const int32_t*>()[idx]);
+            case Precision::U8: return static_cast<float>(blob->cbuffer().as<const uint8_t*>()[idx]);
+            case Precision::I8: return static_cast<float>(blob->cbuffer().as<const int8_t*>()[idx]);
+            default: IE_THROW() << "Unsupported precision of weights decompression constant: " << blob->getTensorDesc().getPrecision();
+        }
+    };
+
+    // Returns constant blob of the second eltwise operand. The constant can be stored in low precision and converted
+    struct ConstOperand {
+        Blob::Ptr blob;
+        MKLDNNDims dims;
+        std::vector<MKLDNNNodePtr> nodes;
+    };
+    auto getConstOperand = [&](const MKLDNNNodePtr& eltwise, ConstOperand& operand) {
+        if (eltwise->getParentEdgesAtPort(1).size() != 1)
+            return false;
+        auto edge = eltwise->getParentEdgesAtPort(1)[0];
+        auto parent = edge->getParent();
+        operand.dims = edge->getDims();
+        operand.nodes.clear();
+        if (parent->getType() == Convert && parent->getChildEdges().size() == 1) {
+            operand.nodes.push_back(parent);
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (!isConstInput(parent))
+            return false;
+        operand.nodes.push_back(parent);
+        operand.blob = parent->getCnnLayer()->blobs.begin()->second;
+        return operand.blob != nullptr && operand.blob->size() == static_cast<size_t>(operand.dims.size());
+    };
+
+    auto isEltwise = [&](const MKLDNNNodePtr& node, EltwiseOpType opType) {
+        if (node->getType() != Eltwise || node->getParentEdges().size() != 2 || node->getChildEdges().size() != 1)
+            return false;
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(node.get());
+        return eltwiseNode != nullptr && eltwiseNode->getOpType() == opType && eltwiseNode->getFusedWith().empty();
+    };
+
+    // Transpose of two last dimensions, other dimensions must be equal to one
+    auto isTranspose2D = [](const MKLDNNNodePtr& node) {
+        auto dims = node->getParentEdgesAtPort(0)[0]->getDims().ToSizeVector();
+        std::vector<int> order = node->getCnnLayer()->GetParamAsInts("order", {});
+        if (dims.size() < 2 || order.size() != dims.size())
+            return false;
+        for (size_t i = 0; i + 2 < dims.size(); i++) {
+            if (order[i] != static_cast<int>(i) || dims[i] != 1)
+                return false;
+        }
+        return order[dims.size() - 2] == static_cast<int>(dims.size() - 1) && order[dims.size() - 1] == static_cast<int>(dims.size() - 2);
+    };
+
+    // Maps flat index of the decompressed weights to the index of the broadcasted constant
+    auto getBroadcastStrides = [](const SizeVector& dataDims, const SizeVector& constDims) {
+        std::vector<size_t> strides(dataDims.size(), 0);
+        size_t stride = 1;
+        for (size_t i = 0; i < constDims.size() && i < dataDims.size(); i++) {
+            size_t dataAxis = dataDims.size() - 1 - i;
+            size_t constDim = constDims[constDims.size() - 1 - i];
+            strides[dataAxis] = constDim == 1 ? 0 : stride;
+            stride *= constDim;
+        }
+        return strides;
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (fc->getType() != FullyConnected || fc->getParentEdges().size() != 3)
+            continue;
+
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(fc.get());
+        if (fcNode == nullptr || fcNode->withCompressedWeights() || !fc->getFusedWith().empty())
+            continue;
+
+        if (fc->getParentEdgesAtPort(1).size() != 1 || fc->getParentEdgesAtPort(2).size() != 1 ||
+            !isConstInput(fc->getParentEdgesAtPort(2)[0]->getParent()))
+            continue;
+
+        auto inDims = fc->getParentEdgesAtPort(0)[0]->getDims();
+        auto outDims = fc->getChildEdgeAt(0)->getDims();
+        if (!one_of(inDims.ndims(), 2, 3) || inDims.ndims() != outDims.ndims())
+            continue;
+        const size_t K = inDims[inDims.ndims() - 1];
+        const size_t N = outDims[outDims.ndims() - 1];
+
+        // FC <- [Reshape | Permute]* <- Multiply(scale) <- [Subtract(zero point)] <- Convert <- Const (u8/i8)
+        std::vector<MKLDNNNodePtr> chain;
+        std::vector<MKLDNNNodePtr> constants;
+        bool transposed = false;
+        bool isSuitable = true;
+
+        auto current = fc->getParentEdgesAtPort(1)[0]->getParent();
+        while (isSuitable && IsOneOf(current->getType(), {Reshape, Permute})) {
+            if (current->getChildEdges().size() != 1 || current->getParentEdgesAtPort(0).size() != 1) {
+                isSuitable = false;
+                break;
+            }
+            if (current->getType() == Permute) {
+                if (!isTranspose2D(current)) {
+                    isSuitable = false;
+                    break;
+                }
+                transposed = !transposed;
+            }
+            for (size_t port = 1; port < current->getParentEdges().size(); port++) {
+                auto shapeEdges = current->getParentEdgesAtPort(port);
+                if (shapeEdges.size() != 1 || !isConstInput(shapeEdges[0]->getParent())) {
+                    isSuitable = false;
+                    break;
+                }
+                constants.push_back(shapeEdges[0]->getParent());
+            }
+            chain.push_back(current);
+            current = current->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (!isSuitable || !isEltwise(current, Multiply))
+            continue;
+
+        auto multiply = current;
+        ConstOperand scale;
+        if (!getConstOperand(multiply, scale))
+            continue;
+
+        auto subtract = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        ConstOperand zeroPoint;
+        if (isEltwise(subtract, Subtract)) {
+            if (!getConstOperand(subtract, zeroPoint))
+                continue;
+            current = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        } else {
+            subtract = nullptr;
+            current = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        }
+
+        auto convert = current;
+        if (convert->getType() != Convert || convert->getChildEdges().size() != 1)
+            continue;
+        auto weights = convert->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isConstInput(weights))
+            continue;
+        auto codesBlob = weights->getCnnLayer()->blobs.begin()->second;
+        const auto codesPrecision = codesBlob->getTensorDesc().getPrecision();
+        if (!one_of(codesPrecision, Precision::U8, Precision::I8) || codesBlob->size() != N * K)
+            continue;
+
+        const SizeVector dataDims = multiply->getChildEdgeAt(0)->getDims().ToSizeVector();
+        const auto scaleStrides = getBroadcastStrides(dataDims, scale.dims.ToSizeVector());
+        const auto zeroPointStrides = subtract ? getBroadcastStrides(dataDims, zeroPoint.dims.ToSizeVector()) : std::vector<size_t>();
+
+        auto constIndex = [dataDims](size_t flatIdx, const std::vector<size_t>& strides) {
+            size_t idx = 0;
+            for (size_t axis = dataDims.size(); axis-- > 0;) {
+                idx += (flatIdx % dataDims[axis]) * strides[axis];
+                flatIdx /= dataDims[axis];
+            }
+            return idx;
+        };
+        auto flatIndex = [=](size_t n, size_t k) {
+            return transposed ? k * N + n : n * K + k;
+        };
+        auto scaleBlob = scale.blob;
+        auto zeroPointBlob = zeroPoint.blob;
+        auto scaleAt = [=](size_t n, size_t k) {
+            return getBlobValue(scaleBlob, constIndex(flatIndex(n, k), scaleStrides));
+        };
+        auto zeroPointAt = [=](size_t n, size_t k) {
+            return zeroPointBlob ? getBlobValue(zeroPointBlob, constIndex(flatIndex(n, k), zeroPointStrides)) : 0.f;
+        };
+
+        // The biggest group of input channels sharing scale and zero point
+        std::vector<size_t> channelGroups(N, K);
+        parallel_for(N, [&](size_t n) {
+            for (size_t k = 1; k < K; k++) {
+                if (scaleAt(n, k) != scaleAt(n, k - 1) || zeroPointAt(n, k) != zeroPointAt(n, k - 1)) {
+                    size_t a = channelGroups[n], b = k;
+                    while (b) { a %= b; std::swap(a, b); }
+                    channelGroups[n] = a;
+                    if (a < CompressedWeightsKernel::blockSize)
+                        break;
+                }
+            }
+        });
+        size_t groupSize = K;
+        for (auto channelGroup : channelGroups) {
+            size_t a = groupSize, b = channelGroup;
+            while (b) { a %= b; std::swap(a, b); }
+            groupSize = a;
+        }
+        // per element scales don't make sense for compression, such weights are decompressed as usual
+        if (groupSize < CompressedWeightsKernel::blockSize && groupSize != K)
+            continue;
+
+        const bool isSigned = codesPrecision == Precision::I8;
+        bool is4bit = true;
+        if (isSigned) {
+            const auto* codes = codesBlob->cbuffer().as<const int8_t*>();
+            is4bit = std::all_of(codes, codes + codesBlob->size(), [](int8_t v) { return v >= -8 && v <= 7; });
+        } else {
+            const auto* codes = codesBlob->cbuffer().as<const uint8_t*>();
+            is4bit = std::all_of(codes, codes + codesBlob->size(), [](uint8_t v) { return v <= 15; });
+        }
+
+        CompressedWeightsKernel::Params params;
+        params.N = N;
+        params.K = K;
+        params.groupSize = groupSize;
+        params.isSigned = isSigned;
+        params.is4bit = is4bit;
+
+        std::vector<Blob::Ptr> sources = {codesBlob, scaleBlob};
+        if (zeroPointBlob)
+            sources.push_back(zeroPointBlob);
+
+        auto code = [=](size_t n, size_t k) -> int32_t {
+            const size_t idx = flatIndex(n, k);
+            return isSigned ? codesBlob->cbuffer().as<const int8_t*>()[idx] : codesBlob->cbuffer().as<const uint8_t*>()[idx];
+        };
+        auto groupScale = [=](size_t n, size_t g) { return scaleAt(n, g * groupSize); };
+        auto groupZeroPoint = [=](size_t n, size_t g) { return zeroPointAt(n, g * groupSize); };
+        fcNode->setCompressedWeights(params, sources, code, groupScale, groupZeroPoint);
+
+        // Weights decompression subgraph is executed by FC node now
+        chain.push_back(multiply);
+        constants.insert(constants.end(), scale.nodes.begin(), scale.nodes.end());
+        if (subtract) {
+            chain.push_back(subtract);
+            constants.insert(constants.end(), zeroPoint.nodes.begin(), zeroPoint.nodes.end());
+        }
+        chain.push_back(convert);
+        constants.push_back(weights);
+
+        for (auto& node : chain) {
+            fc->mergeWith(node);
+            node->remove();
+        }
+        for (auto& node : constants) {
+            node->remove();
+        }
+
+        // Bias becomes the second input
+        auto biasEdge = fc->getParentEdgesAtPort(2)[0];
+        auto bias = biasEdge->getParent();
+        MKLDNNEdgePtr newEdge(new MKLDNNEdge(bias, fc, biasEdge->getInputNum(), 1));
+        graph.GetEdges().push_back(newEdge);
+        removeEdge(graph, biasEdge);
+        biasEdge->drop();
+        fc->addEdge(newEdge);
+        fc->inDims.erase(fc->inDims.begin() + 1);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+        if (node->getType() != FullyConnected || node->getChildEdges().size() != 1)
+            return false;
+
+        // post ops aren't supported by the compressed weights kernel
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
+        return fcNode != nullptr && !fcNode->withCompressedWeights();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
@@ -18,11 +18,18 @@ public:
     void ApplyCommonGraphOptimizations(MKLDNNGraph& graph);
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
+    /**
+     * @brief Reassigns primitive descriptors of layout-flexible nodes to minimize the number and size of reorders
+     * over the whole graph. Must be called after primitive descriptors are selected and before edges are initialized.
+     */
+    MKLDNNGraph::LayoutStatistics ApplyLayoutOptimizations(MKLDNNGraph& graph);
+
 private:
     void MergeGroupConvolution(MKLDNNGraph& graph);
     void MergeTwoEqualScaleShifts(MKLDNNGraph& graph);
     void FuseConvolutionAndActivation(MKLDNNGraph &graph);
     void FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
     void FuseConvolutionAndDepthwise(MKLDNNGraph &graph);
     void FuseConvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseConvolutionAndDWConvolution(MKLDNNGraph &graph);
@@ -47,6 +54,9 @@ private:
     void FuseClampAndQuantize(MKLDNNGraph &graph);
     void MergePermuteAndReorder(MKLDNNGraph &graph);
 
+    bool IsLayoutFlexible(const MKLDNNNodePtr& node);
+    size_t LayoutMismatchBytes(const MKLDNNNodePtr& node, size_t idx);
+
     bool IsOneOf(Type type, std::vector<Type> types);
     bool IsOneOf(EltwiseOpType alg, std::vector<EltwiseOpType> algs);
 
@@ -7,6 +7,8 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <chrono>
+#include <cstring>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -21,6 +23,19 @@
 #include "mkldnn_async_infer_request.h"
 #include <debug.h>
 
+namespace {
+
+std::string GetStateName(MKLDNNPlugin::MKLDNNMemoryInputNode* memoryNode) {
+    auto state_name = memoryNode->getId();
+
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = state_name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        state_name = state_name.substr(0, suffix_idx);
+    return state_name;
+}
+
+}  // namespace
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -50,12 +65,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
             if (node->getType() == MemoryInput) {
                 auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
                 auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
+                auto state_name = GetStateName(memoryNode);
 
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
            }
@@ -70,34 +80,36 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
     --(execNetwork->_numRequests);
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
-    bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
-
+void MKLDNNPlugin::MKLDNNInferRequest::convertInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob,
+                                                    InferenceEngine::Precision inPrec) {
     if (inputBlob->cbuffer().as<const void *>() == nullptr) {
         IE_THROW() << "Input blob has no allocated memory";
     }
 
-    InferenceEngine::Blob::Ptr iconv;
-    if (needConvert) {
-        iconv = make_blob_with_precision(inPrec, InferenceEngine::TensorDesc(inPrec, inputBlob->getTensorDesc().getDims(),
-                                         inputBlob->getTensorDesc().getLayout()));
-        iconv->allocate();
-        if (inputBlob->size() != iconv->size())
-            IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
-                               << iconv->size();
-
-        void *srcData = inputBlob->cbuffer().as<void *>();
-        void *dstData = iconv->buffer().as<void *>();
-        if (dstData == nullptr) {
-            IE_THROW() << "Converted input blob has no allocated memory";
-        }
-        cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
+    if (inPrec == inputBlob->getTensorDesc().getPrecision()) {
+        convertedInputs.erase(inputName);
+        return;
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    InferenceEngine::TensorDesc iconvDesc(inPrec, inputBlob->getTensorDesc().getDims(), inputBlob->getTensorDesc().getLayout());
+    auto& iconv = convertedInputs[inputName];
+    if (!iconv || iconv->getTensorDesc() != iconvDesc) {
+        iconv = make_blob_with_precision(iconvDesc);
+        iconv->allocate();
+    }
+    if (inputBlob->size() != iconv->size())
+        IE_THROW() << "Can't copy tensor: input and converted tensors have different number of elements: " << inputBlob->size() << " and "
+                           << iconv->size();
+
+    void *srcData = inputBlob->cbuffer().as<void *>();
+    void *dstData = iconv->buffer().as<void *>();
+    if (dstData == nullptr) {
+        IE_THROW() << "Converted input blob has no allocated memory";
+    }
+    cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+void MKLDNNPlugin::MKLDNNInferRequest::ConvertInputData() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             IE_THROW() << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
@@ -116,7 +128,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             // BUT if a mean image exists, we convert the blob and send FP32
             case InferenceEngine::Precision::U8:
             case InferenceEngine::Precision::BOOL: {
-                if (graph->hasMeanImageFor(input.first))
+                // the graph loads a mean image for every input with per channel preprocessing,
+                // the network input info is checked instead so the stage does not touch the stream graph
+                if (_networkInputs[input.first]->getPreProcess().getNumberOfChannels())
                     inPrec = InferenceEngine::Precision::FP32;
                 break;
             }
@@ -138,7 +152,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
         }
 
-        pushInput(input.first, input.second, inPrec);
+        convertInput(input.first, input.second, inPrec);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
+    for (const auto& input : _inputs) {
+        auto converted = convertedInputs.find(input.first);
+        graph->PushInputData(input.first, converted != convertedInputs.end() ? converted->second : input.second);
     }
 }
 
@@ -180,36 +201,111 @@ void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::BindStateSessions() {
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto cur_name = GetStateName(cur_node);
+            auto cur_state_mem = cur_node->getStore();
+
+            if (stateSessions.size() == 1 && stateSessions.front()->GetStates().at(cur_name)->byteSize() == cur_state_mem->GetSize()) {
+                // the only session holds the whole variable, so the graph works with the session storage directly
+                cur_node->bindExternalStore(stateSessions.front()->GetStates().at(cur_name)->buffer().as<void*>());
+                continue;
+            }
+
+            auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+            const size_t sample_size = cur_state_mem->GetSize() / cur_state_mem->GetDims()[0];
+            for (size_t i = 0; i < stateSessions.size(); i++) {
+                auto data_ptr = stateSessions[i]->GetStates().at(cur_name)->cbuffer().as<const void*>();
+                cpu_memcpy(cur_state_mem_buf + i * sample_size, data_ptr, sample_size);
+            }
+        }
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ReleaseStateSessions(bool storeStates) {
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto cur_name = GetStateName(cur_node);
+            auto cur_state_mem = cur_node->getStore();
+
+            if (stateSessions.size() == 1 && stateSessions.front()->GetStates().at(cur_name)->byteSize() == cur_state_mem->GetSize()) {
+                cur_node->releaseExternalStore();
+                continue;
+            }
+
+            if (!storeStates)
+                continue;
+
+            auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+            const size_t sample_size = cur_state_mem->GetSize() / cur_state_mem->GetDims()[0];
+            for (size_t i = 0; i < stateSessions.size(); i++) {
+                auto data_ptr = stateSessions[i]->GetStates().at(cur_name)->buffer().as<void*>();
+                cpu_memcpy(data_ptr, cur_state_mem_buf + i * sample_size, sample_size);
+            }
+        }
+    }
+}
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
+    InferPreprocess();
+    InferGraph();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferPreprocess() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "InferPreprocess");
+    const auto start = std::chrono::steady_clock::now();
+
+    ThrowIfCanceled();
+
+    execDataPreprocessing(_inputs);
+
+    ConvertInputData();
+
+    execNetwork->_preprocessStatistics.add(std::chrono::steady_clock::now() - start);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::InferGraph() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
+    const auto start = std::chrono::steady_clock::now();
     auto graphLock = execNetwork->GetGraph();
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
 
-    execDataPreprocessing(_inputs);
-
     changeDefaultPtr();
 
-    ThrowIfCanceled();
-
     PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
-    }
+    if (!stateSessions.empty()) {
+        BindStateSessions();
+        try {
+            graph->Infer(this, m_curBatch);
+        } catch (...) {
+            ReleaseStateSessions(false);
+            throw;
+        }
+        ReleaseStateSessions(true);
+    } else {
+        if (memoryStates.size() != 0) {
+            PushStates();
+        }
 
-    graph->Infer(this, m_curBatch);
+        graph->Infer(this, m_curBatch);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
+        if (memoryStates.size() != 0) {
+            PullStates();
+        }
     }
 
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
+
+    execNetwork->_inferStatistics.add(std::chrono::steady_clock::now() - start);
 }
 
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts() const {
@@ -485,6 +581,66 @@ std::vector<InferenceEngine::IVariableStateInternal::Ptr> MKLDNNPlugin::MKLDNNIn
     return memoryStates;
 }
 
+InferenceEngine::StateSession::Ptr MKLDNNPlugin::MKLDNNInferRequest::CreateStateSession() {
+    InferenceEngine::BlobMap states;
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto cur_name = GetStateName(cur_node);
+            auto cur_state_mem = cur_node->getStore();
+
+            // the session keeps one batch sample of the variable in the graph layout to bind it without reorders
+            InferenceEngine::TensorDesc desc = MKLDNNMemoryDesc(cur_state_mem->GetDescriptor());
+            auto dims = desc.getDims();
+            auto blockDims = desc.getBlockingDesc().getBlockDims();
+            const auto& order = desc.getBlockingDesc().getOrder();
+            if (dims.empty() || order.front() != 0 ||
+                InferenceEngine::details::product(dims) * desc.getPrecision().size() != cur_state_mem->GetSize())
+                IE_THROW(NotImplemented) << "State session doesn't support layout of variable " << cur_name;
+            dims[0] = blockDims[0] = 1;
+
+            auto state = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims,
+                                                                              InferenceEngine::BlockingDesc(blockDims, order)));
+            state->allocate();
+            std::memset(state->buffer(), 0, state->byteSize());
+            states.emplace(cur_name, state);
+        }
+    }
+    if (states.empty())
+        IE_THROW() << "Cannot create state session for network without variables";
+
+    return std::make_shared<InferenceEngine::StateSession>(states);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetStateSessions(const std::vector<InferenceEngine::StateSession::Ptr>& sessions) {
+    for (const auto& session : sessions) {
+        if (session == nullptr)
+            IE_THROW() << "State session is not initialized";
+    }
+
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            auto cur_name = GetStateName(cur_node);
+            auto cur_state_mem = cur_node->getStore();
+
+            const size_t batch = cur_state_mem->GetDims()[0];
+            if (sessions.size() > batch)
+                IE_THROW(ParameterMismatch) << "Cannot bind " << sessions.size() << " state sessions to variable " << cur_name
+                                            << " with batch " << batch;
+            for (const auto& session : sessions) {
+                auto state = session->GetStates().find(cur_name);
+                if (state == session->GetStates().end())
+                    IE_THROW(NotFound) << "State session doesn't have variable " << cur_name;
+                if (state->second->byteSize() != cur_state_mem->GetSize() / batch)
+                    IE_THROW(ParameterMismatch) << "State session has incompatible size of variable " << cur_name;
+            }
+        }
+    }
+
+    stateSessions = sessions;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest) {
     _asyncRequest = asyncRequest;
 }
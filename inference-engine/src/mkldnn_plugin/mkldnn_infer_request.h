@@ -26,6 +26,17 @@ public:
 
     void InferImpl() override;
 
+    /**
+     * @brief Runs the input preprocessing and converts inputs to the precisions supported by the graph.
+     * Does not use the stream graph, so it can run on a separate executor before InferGraph()
+     */
+    void InferPreprocess();
+
+    /**
+     * @brief Pushes the preprocessed inputs to the graph of the current stream, infers it and pulls the outputs
+     */
+    void InferGraph();
+
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) override;
@@ -36,6 +47,10 @@ public:
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
 
+    InferenceEngine::StateSession::Ptr CreateStateSession() override;
+
+    void SetStateSessions(const std::vector<InferenceEngine::StateSession::Ptr>& sessions) override;
+
     /**
      * @brief      Sets the pointer to asynchronous inference request that holds this request
      * @param[in]  asyncRequest Pointer to asynchronous inference request
@@ -48,18 +63,24 @@ public:
     void ThrowIfCanceled() const;
 
 private:
+    void ConvertInputData();
     void PushInputData();
     void PushStates();
     void PullStates();
+    void BindStateSessions();
+    void ReleaseStateSessions(bool storeStates);
 
-    void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    void convertInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    // inputs converted to the graph precisions, kept between the inferences to avoid reallocation
+    InferenceEngine::BlobMap            convertedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::vector<InferenceEngine::StateSession::Ptr> stateSessions;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,270 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_jit_kernel_cache.h"
+#include "utils/cpu_info.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <sys/mman.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const char header[] = "# CPU plugin JIT kernel v1";
+
+// absolute addresses are 64-bit immediates
+constexpr size_t addressSize = sizeof(uint64_t);
+
+uint64_t readAddress(const uint8_t* data) {
+    uint64_t value;
+    std::memcpy(&value, data, addressSize);
+    return value;
+}
+
+void writeAddress(uint8_t* data, uint64_t value) {
+    std::memcpy(data, &value, addressSize);
+}
+
+// FNV-1a, file names must not depend on the standard library implementation
+std::string fileName(const std::string& directory, const std::string& key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.kernel", static_cast<unsigned long long>(hash));
+    return directory + "/" + name;
+}
+
+std::string buildTag() {
+    static const std::string tag = getLibrariesVersion() + ";" + getCPUIsaName();
+    return tag;
+}
+
+/**
+ * Finds the offsets of the absolute addresses of the code itself by comparing two compilations of the same kernel.
+ * Returns false if the compilations differ in anything else.
+ */
+bool findRelocations(const uint8_t* code, const uint8_t* probe, size_t size, std::vector<size_t>& relocations) {
+    const uint64_t codeBase = reinterpret_cast<uint64_t>(code);
+    const uint64_t probeBase = reinterpret_cast<uint64_t>(probe);
+    size_t end = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (code[i] == probe[i])
+            continue;
+
+        // the lowest bytes of both addresses may be equal, so the address may start a few bytes before the first difference
+        bool found = false;
+        for (size_t start = i >= addressSize - 1 ? std::max(end, i - (addressSize - 1)) : end; start <= i && !found; start++) {
+            if (start + addressSize > size)
+                break;
+            const uint64_t codeAddress = readAddress(code + start);
+            const uint64_t probeAddress = readAddress(probe + start);
+            if (codeAddress < codeBase || codeAddress - codeBase > size || probeAddress < probeBase ||
+                    codeAddress - codeBase != probeAddress - probeBase)
+                continue;
+            relocations.push_back(start);
+            end = start + addressSize;
+            i = end - 1;
+            found = true;
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+std::shared_ptr<void> allocateExecutable(const std::vector<uint8_t>& code, const std::vector<size_t>& relocations) {
+    const size_t size = code.size();
+#ifdef _WIN32
+    void* memory = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (memory == nullptr)
+        return nullptr;
+    std::shared_ptr<void> executable(memory, [](void* ptr) { VirtualFree(ptr, 0, MEM_RELEASE); });
+#else
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
+        return nullptr;
+    std::shared_ptr<void> executable(memory, [size](void* ptr) { munmap(ptr, size); });
+#endif
+
+    auto data = static_cast<uint8_t*>(memory);
+    std::memcpy(data, code.data(), size);
+    const uint64_t base = reinterpret_cast<uint64_t>(data);
+    for (auto offset : relocations)
+        writeAddress(data + offset, readAddress(data + offset) + base);
+
+#ifdef _WIN32
+    DWORD oldProtection;
+    if (!VirtualProtect(memory, size, PAGE_EXECUTE_READ, &oldProtection))
+        return nullptr;
+    FlushInstructionCache(GetCurrentProcess(), memory, size);
+#else
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0)
+        return nullptr;
+#endif
+    return executable;
+}
+
+std::shared_ptr<void> readCode(const std::string& file, const std::string& key) {
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream.is_open())
+        return nullptr;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != header)
+        return nullptr;
+    if (!std::getline(stream, line) || line != buildTag())
+        return nullptr;
+    if (!std::getline(stream, line) || line != key)
+        return nullptr;
+
+    size_t size = 0;
+    size_t relocationsNum = 0;
+    if (!std::getline(stream, line) || sscanf(line.c_str(), "%zu %zu", &size, &relocationsNum) != 2 || size == 0 ||
+            relocationsNum > size / addressSize)
+        return nullptr;
+
+    std::vector<size_t> relocations(relocationsNum);
+    for (auto& offset : relocations) {
+        if (!(stream >> offset) || offset + addressSize > size)
+            return nullptr;
+    }
+    if (!std::getline(stream, line))
+        return nullptr;
+
+    std::vector<uint8_t> code(size);
+    if (!stream.read(reinterpret_cast<char*>(code.data()), size) || stream.peek() != std::ifstream::traits_type::eof())
+        return nullptr;
+    for (auto offset : relocations) {
+        if (readAddress(code.data() + offset) > size)
+            return nullptr;
+    }
+
+    return allocateExecutable(code, relocations);
+}
+
+}  // namespace
+
+MKLDNNJitKernelCache& MKLDNNJitKernelCache::getInstance() {
+    static MKLDNNJitKernelCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> MKLDNNJitKernelCache::find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = kernels.find(key);
+    if (found == kernels.end())
+        return nullptr;
+
+    auto kernel = found->second.lock();
+    if (!kernel)
+        kernels.erase(found);
+    return kernel;
+}
+
+std::shared_ptr<void> MKLDNNJitKernelCache::insert(const std::string& key, const std::shared_ptr<void>& kernel) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto& stored = kernels[key];
+    // other thread may have compiled the same kernel in the meantime, keep the first one
+    auto existing = stored.lock();
+    if (existing)
+        return existing;
+
+    stored = kernel;
+
+    // drop records of released kernels from time to time, so the map does not grow with every loaded network
+    if (kernels.size() % 256 == 0) {
+        for (auto it = kernels.begin(); it != kernels.end();) {
+            if (it->second.expired())
+                it = kernels.erase(it);
+            else
+                ++it;
+        }
+    }
+    return kernel;
+}
+
+MKLDNNJitKernelCache::Statistics MKLDNNJitKernelCache::getStatistics() const {
+    Statistics statistics;
+    statistics.hits = hits.load();
+    statistics.misses = misses.load();
+    statistics.loads = loads.load();
+    return statistics;
+}
+
+void MKLDNNJitKernelCache::setPersistentDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(guard);
+    persistentDirectory = directory;
+}
+
+std::string MKLDNNJitKernelCache::getPersistentDirectory() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return persistentDirectory;
+}
+
+std::shared_ptr<void> MKLDNNJitKernelCache::loadCode(const std::string& directory, const std::string& key) {
+    // a missing, stale or damaged file is not an error, the kernel is compiled instead
+    try {
+        return readCode(fileName(directory, key), key);
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void MKLDNNJitKernelCache::storeCode(const std::string& directory, const std::string& key, const Code& code, const Code& probe) {
+    if (code.data == nullptr || probe.data == nullptr || code.size == 0 || code.size != probe.size)
+        return;
+
+    std::vector<size_t> relocations;
+    if (!findRelocations(code.data, probe.data, code.size, relocations))
+        return;
+
+    // addresses are stored as offsets from the beginning of the code
+    std::vector<uint8_t> data(code.data, code.data + code.size);
+    const uint64_t base = reinterpret_cast<uint64_t>(code.data);
+    for (auto offset : relocations)
+        writeAddress(data.data() + offset, readAddress(data.data() + offset) - base);
+
+    // processes and threads write to own temporary files, so readers never see a partially written kernel
+    const std::string file = fileName(directory, key);
+    const std::string tmpFile = file + "." +
+        std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+                       static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count())) + ".tmp";
+    {
+        std::ofstream stream(tmpFile, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open())
+            return;
+        stream << header << "\n" << buildTag() << "\n" << key << "\n" << data.size() << " " << relocations.size() << "\n";
+        for (auto offset : relocations)
+            stream << offset << " ";
+        stream << "\n";
+        stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpFile.c_str());
+            return;
+        }
+    }
+    std::remove(file.c_str());
+    if (std::rename(tmpFile.c_str(), file.c_str()) != 0)
+        std::remove(tmpFile.c_str());
+}
+
+}  // namespace MKLDNNPlugin
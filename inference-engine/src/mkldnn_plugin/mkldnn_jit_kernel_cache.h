@@ -0,0 +1,159 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide storage of JIT compiled kernels
+ *
+ * Kernels are identified by a key built from the kernel name, ISA and all parameters which affect the generated code.
+ * A kernel is compiled once and shared by all nodes with the same key: nodes of the graph, graphs of all streams and
+ * all networks loaded in the process. The cache does not own kernels, so a kernel is released together with the last
+ * node using it.
+ *
+ * Only kernels which depend on their config parameters alone may be stored. Kernels with fused post operations embed
+ * addresses of the node data into the code and must not be shared.
+ *
+ * If the persistent directory is set, the machine code of compiled kernels is also written there, one file per key, and
+ * the next process loads it into executable memory instead of compiling. A file is used only if it was written by the
+ * same versions of the plugin and oneDNN on a CPU with the same ISA, otherwise the kernel is compiled and the file is
+ * overwritten. The code may address its own constant tables by absolute addresses. Such addresses are found by
+ * comparing two compilations placed at different addresses and are adjusted on load. Kernels whose compilations differ
+ * in any other way are not persisted.
+ *
+ * Is a thread safe
+ */
+class MKLDNNJitKernelCache {
+public:
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t loads = 0;
+    };
+
+    static MKLDNNJitKernelCache& getInstance();
+
+    /**
+     * @brief Returns the kernel stored with the key, or loads it from the persistent directory, or creates the kernel
+     * and calls its create_ker() method
+     * @param key unique kernel identifier, see makeKey()
+     * @param create function which allocates a new not yet compiled kernel
+     */
+    template <typename Kernel>
+    std::shared_ptr<Kernel> getOrCreate(const std::string& key, const std::function<Kernel*()>& create) {
+        auto cached = find(key);
+        if (cached) {
+            hits++;
+            return std::static_pointer_cast<Kernel>(cached);
+        }
+
+        const std::string directory = getPersistentDirectory();
+        std::shared_ptr<void> code = directory.empty() ? nullptr : loadCode(directory, key);
+
+        std::shared_ptr<Kernel> kernel;
+        if (code) {
+            // the kernel isn't generated, it only calls the loaded code which lives as long as the kernel
+            kernel.reset(create(), [code](Kernel* loaded) { delete loaded; });
+            kernel->ker_ = reinterpret_cast<decltype(kernel->ker_)>(code.get());
+            loads++;
+        } else {
+            // compilation may take a while, so it is done without the lock
+            kernel.reset(create());
+            kernel->create_ker();
+            misses++;
+
+            if (!directory.empty()) {
+                // the second compilation is placed at another address, see the class description
+                std::unique_ptr<Kernel> probe(create());
+                probe->create_ker();
+                storeCode(directory, key, getCode(kernel.get()), getCode(probe.get()));
+            }
+        }
+        return std::static_pointer_cast<Kernel>(insert(key, kernel));
+    }
+
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Sets the existing directory where the machine code of kernels is persisted, empty path disables persistence
+     */
+    void setPersistentDirectory(const std::string& directory);
+    std::string getPersistentDirectory() const;
+
+    /**
+     * @brief Builds a cache key from the kernel name and parameters
+     */
+    template <typename... Args>
+    static std::string makeKey(const std::string& name, const Args&... args) {
+        std::ostringstream key;
+        key << name;
+        appendToKey(key, args...);
+        return key.str();
+    }
+
+private:
+    struct Code {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    MKLDNNJitKernelCache() = default;
+
+    std::shared_ptr<void> find(const std::string& key);
+    std::shared_ptr<void> insert(const std::string& key, const std::shared_ptr<void>& kernel);
+
+    template <typename Kernel>
+    static Code getCode(const Kernel* kernel) {
+        Code code;
+        auto generator = dynamic_cast<const mkldnn::impl::cpu::x64::jit_generator*>(kernel);
+        if (generator) {
+            code.data = reinterpret_cast<const uint8_t*>(generator->jit_ker());
+            code.size = generator->getSize();
+        }
+        return code;
+    }
+
+    static std::shared_ptr<void> loadCode(const std::string& directory, const std::string& key);
+    static void storeCode(const std::string& directory, const std::string& key, const Code& code, const Code& probe);
+
+    static void appendToKey(std::ostringstream&) {}
+
+    template <typename T, typename... Args>
+    static void appendToKey(std::ostringstream& key, const T& value, const Args&... args) {
+        key << ',' << value;
+        appendToKey(key, args...);
+    }
+
+    template <typename T, typename... Args>
+    static void appendToKey(std::ostringstream& key, const std::vector<T>& values, const Args&... args) {
+        key << ",[";
+        for (const auto& value : values)
+            key << value << ' ';
+        key << ']';
+        appendToKey(key, args...);
+    }
+
+    std::unordered_map<std::string, std::weak_ptr<void>> kernels;
+    std::string persistentDirectory;
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+    std::atomic<size_t> loads{0};
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
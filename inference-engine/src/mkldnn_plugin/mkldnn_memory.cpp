@@ -97,7 +97,7 @@ void MKLDNNMemory::reorderData(const MKLDNNMemory &input, const MKLDNNMemory &ou
         auto dstPtr = static_cast<uint8_t*>(output.GetPtr());
 
         auto copySize = size == 0 ? output.GetSize() : size;
-        cpu_memcpy(dstPtr, srcPtr, copySize);
+        cpu_parallel_memcpy(dstPtr, srcPtr, copySize);
     } else {
         std::unique_ptr<mkldnn::reorder> pReorder;
         std::shared_ptr<memory> srcMemoryPtr;
@@ -149,7 +149,7 @@ void MKLDNNMemory::SetData(memory::data_type dataType, memory::format_tag format
         uint8_t* dataPtr = static_cast<uint8_t*>(GetData());
         // We cannot support strides for i/o blobs because it affects performance.
         dataPtr += itemSize * prim->get_desc().data.offset0;
-        cpu_memcpy(dataPtr, data, size);
+        cpu_parallel_memcpy(dataPtr, data, size);
     } else {
         auto memData = this->GetDescriptor().data;
         memory::dims dims(memData.dims, memData.dims + memData.ndims);
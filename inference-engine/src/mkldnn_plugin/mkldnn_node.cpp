@@ -11,6 +11,8 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <cstring>
+#include <sstream>
 #include <unordered_map>
 
 #include <nodes/mkldnn_batchnorm_node.h>
@@ -44,6 +46,7 @@
 #include <mkldnn_types.h>
 #include <dnnl_types.h>
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_primitive_tuner.h"
 
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_debug.h"
@@ -143,7 +146,11 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
         { "Erf", Eltwise },
+        { "Abs", Eltwise },
+        { "Neg", Eltwise },
         { "Roll", Roll },
+        { "ShuffleChannels", ShuffleChannels },
+        { "Gather", Gather },
 };
 
 Type TypeFromName(const std::string type) {
@@ -1043,6 +1050,212 @@ bool MKLDNNNode::isInitConfig(const InferenceEngine::LayerConfig& config) const
     return true;
 }
 
+std::string MKLDNNNode::getTuningSignature() const {
+    std::ostringstream signature;
+    signature << getTypeStr();
+    auto dimsToStream = [&](const MKLDNNDims& dims) {
+        signature << "[";
+        for (int i = 0; i < dims.ndims(); i++)
+            signature << (i ? "," : "") << dims[i];
+        signature << "]";
+    };
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        dimsToStream(getParentEdgeAt(i)->getDims());
+    signature << "->";
+    for (size_t i = 0; i < getChildEdges().size(); i++)
+        dimsToStream(getChildEdgeAt(i)->getDims());
+
+    if (!supportedPrimitiveDescriptors.empty()) {
+        const auto& config = supportedPrimitiveDescriptors[0].getConfig();
+        for (const auto& confs : {config.inConfs, config.outConfs}) {
+            signature << ";";
+            for (const auto& conf : confs)
+                signature << conf.desc.getPrecision().name() << ",";
+        }
+    }
+    if (cnnLayer) {
+        for (const auto& param : cnnLayer->params)
+            signature << ";" << param.first << "=" << param.second;
+    }
+    for (const auto& fusedNode : fusedWith)
+        signature << ";+" << fusedNode->getTypeStr();
+    return signature.str();
+}
+
+std::string MKLDNNNode::getPrimitiveDescriptorSignature(size_t idx) const {
+    if (idx >= supportedPrimitiveDescriptors.size())
+        IE_THROW() << "Incorrect index of supported primitive descriptor for node " << getName();
+    const auto& pd = supportedPrimitiveDescriptors[idx];
+    std::ostringstream signature;
+    signature << "impl=" << std::hex << static_cast<int>(pd.getImplementationType()) << std::dec;
+    signature << ";in=";
+    for (const auto& conf : pd.getConfig().inConfs)
+        signature << MKLDNNExtensionUtils::getLayoutSignature(conf.desc) << " ";
+    signature << ";out=";
+    for (const auto& conf : pd.getConfig().outConfs)
+        signature << MKLDNNExtensionUtils::getLayoutSignature(conf.desc) << " ";
+    return signature.str();
+}
+
+double MKLDNNNode::benchmarkPrimitive(size_t idx, const mkldnn::primitive_attr& attr) {
+    if (idx >= supportedPrimitiveDescriptors.size())
+        return -1.0;
+    const auto& candidate = supportedPrimitiveDescriptors[idx];
+
+    auto descsMatch = [](const std::vector<InferenceEngine::TensorDesc>& descs,
+                         const std::vector<InferenceEngine::DataConfig>& confs) {
+        for (size_t i = 0; i < descs.size() && i < confs.size(); i++) {
+            if (!MKLDNNExtensionUtils::initTensorsAreEqual(descs[i], confs[i].desc))
+                return false;
+        }
+        return true;
+    };
+
+    for (auto& desc : descs) {
+        auto itpd = desc.createPrimitiveDescriptorIterator(engine, attr);
+        while (static_cast<bool>(itpd)) {
+            std::vector<InferenceEngine::TensorDesc> srcDescs;
+            for (size_t i = 0; i < descInputNumbers(desc); i++)
+                srcDescs.push_back(getSrcMemDesc(itpd, i));
+            std::vector<InferenceEngine::TensorDesc> dstDescs;
+            for (size_t i = 0; i < descOutputNumbers(desc); i++)
+                dstDescs.push_back(getDstMemDesc(itpd, i));
+
+            if (parse_impl_name(itpd.impl_info_str()) == candidate.getImplementationType() &&
+                    descsMatch(srcDescs, candidate.getConfig().inConfs) &&
+                    descsMatch(dstDescs, candidate.getConfig().outConfs)) {
+                mkldnn::primitive primitive(itpd.get());
+
+                const std::pair<int, mkldnn::memory::desc> argDescs[] = {
+                    {DNNL_ARG_SRC, itpd.src_desc(0)},
+                    {DNNL_ARG_WEIGHTS, itpd.weights_desc(0)},
+                    {DNNL_ARG_BIAS, itpd.weights_desc(1)},
+                    {DNNL_ARG_DST, itpd.dst_desc(0)},
+                    {DNNL_ARG_DIFF_DST, itpd.diff_dst_desc(0)},
+                    {DNNL_ARG_DIFF_SRC, itpd.diff_src_desc(0)},
+                    {DNNL_ARG_WORKSPACE, itpd.workspace_desc()},
+                    {DNNL_ARG_SCRATCHPAD, itpd.scratchpad_desc()},
+                };
+                std::unordered_map<int, mkldnn::memory> args;
+                for (const auto& argDesc : argDescs) {
+                    const size_t size = argDesc.second.get_size();
+                    if (size == 0)
+                        continue;
+                    mkldnn::memory memory(argDesc.second, engine);
+                    std::memset(memory.get_data_handle(), 0, size);
+                    args[argDesc.first] = memory;
+                }
+
+                mkldnn::stream strm(engine);
+                return measureExecutionTime([&]() {
+                    primitive.execute(strm, args);
+                    strm.wait();
+                });
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+    }
+
+    return -1.0;
+}
+
+std::string MKLDNNNode::getPrimitiveAttrKey(const mkldnn::primitive_attr& attr) {
+    std::ostringstream key;
+    auto appendValue = [&key](float value) {
+        key.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    int mask = 0;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    key << "oscale:" << mask << ':';
+    for (auto scale : scales)
+        appendValue(scale);
+
+    const auto ops = attr.get_post_ops();
+    for (int i = 0; i < ops.len(); i++) {
+        switch (ops.kind(i)) {
+            case mkldnn::primitive::kind::sum: {
+                float scale = 0.f;
+                ops.get_params_sum(i, scale);
+                key << ";sum:";
+                appendValue(scale);
+                break;
+            }
+            case mkldnn::primitive::kind::eltwise: {
+                float scale = 0.f, alpha = 0.f, beta = 0.f;
+                mkldnn::algorithm alg;
+                ops.get_params_eltwise(i, scale, alg, alpha, beta);
+                key << ";eltwise:" << static_cast<int>(alg) << ':';
+                appendValue(scale);
+                appendValue(alpha);
+                appendValue(beta);
+                break;
+            }
+            default:
+                // depthwise, quantization and fused convolution post operations keep pointers to the node data
+                return {};
+        }
+    }
+    return key.str();
+}
+
+std::string MKLDNNNode::getPrimitiveCacheKey(const mkldnn::primitive_desc_base& prim_desc, const std::string& attrKey) {
+    if (attrKey.empty())
+        return {};
+
+    const_mkldnn_op_desc_t opDesc = nullptr;
+    if (mkldnn_primitive_desc_query(prim_desc.get(), mkldnn::convert_to_c(mkldnn::query::op_d), 0, &opDesc) != mkldnn_success ||
+        opDesc == nullptr)
+        return {};
+
+    // operation descriptors are plain structures which start with the primitive kind, so their bytes describe
+    // the operation, its shapes and parameters completely
+    size_t opDescSize = 0;
+    switch (*static_cast<const mkldnn_primitive_kind_t*>(opDesc)) {
+        case mkldnn_convolution:
+        case mkldnn_deconvolution:
+            opDescSize = sizeof(mkldnn_convolution_desc_t);
+            break;
+        case mkldnn_pooling:
+            opDescSize = sizeof(mkldnn_pooling_desc_t);
+            break;
+        case mkldnn_lrn:
+            opDescSize = sizeof(mkldnn_lrn_desc_t);
+            break;
+        case mkldnn_softmax:
+            opDescSize = sizeof(mkldnn_softmax_desc_t);
+            break;
+        case mkldnn_inner_product:
+            opDescSize = sizeof(mkldnn_inner_product_desc_t);
+            break;
+        default:
+            return {};
+    }
+
+    std::string key(prim_desc.impl_info_str());
+    key.append(static_cast<const char*>(opDesc), opDescSize);
+
+    // operation descriptor may leave the formats to the implementation, so the selected ones are added as well
+    const mkldnn::query memoryQueries[] = {mkldnn::query::src_md, mkldnn::query::weights_md, mkldnn::query::dst_md,
+                                           mkldnn::query::diff_src_md, mkldnn::query::diff_dst_md};
+    for (auto query : memoryQueries) {
+        for (int idx = 0; idx < 2; idx++) {
+            const auto desc = prim_desc.query_md(query, idx);
+            key.append(reinterpret_cast<const char*>(&desc.data), sizeof(desc.data));
+        }
+    }
+
+    key.append(attrKey);
+    return key;
+}
+
+void MKLDNNNode::addScratchpadArg(const mkldnn::primitive_desc_base& prim_desc) {
+    scratchpadDesc = prim_desc.scratchpad_desc();
+    primArgs.erase(DNNL_ARG_SCRATCHPAD);
+}
+
 MKLDNNMemoryDesc MKLDNNNode::getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     InferenceEngine::TensorDesc desc = MKLDNNMemoryDesc(primitive_desc_it.src_desc(idx));
     if (desc.getLayout() == InferenceEngine::Layout::ANY)
@@ -20,6 +20,7 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_primitive_cache.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
@@ -88,7 +89,9 @@ enum Type {
     ReduceProd,
     ReduceSum,
     ReduceSumSquare,
-    Roll
+    Roll,
+    ShuffleChannels,
+    Gather
 };
 
 Type TypeFromName(const std::string type);
@@ -209,6 +212,10 @@ static std::string NameFromType(Type type) {
             return "ReduceSumSquare";
         case Roll:
             return "Roll";
+        case ShuffleChannels:
+            return "ShuffleChannels";
+        case Gather:
+            return "Gather";
         default:
             return "Unknown";
     }
@@ -427,6 +434,28 @@ public:
     virtual void selectOptimalPrimitiveDescriptor();
     virtual void initOptimalPrimitiveDescriptor();
 
+    /**
+     * @brief Measures execution time of the primitive which implements supported primitive descriptor
+     * Node memory is not used: primitive is executed on scratch buffers of the same shapes.
+     * @param idx Index of the supported primitive descriptor
+     * @return Execution time in milliseconds or negative value if the descriptor can't be benchmarked
+     */
+    virtual double benchmarkPrimitiveDescriptor(size_t idx) {
+        return -1.0;
+    }
+
+    /**
+     * @brief Returns string which identifies the node in the tuning cache: type, shapes, precisions, layer parameters
+     * and fused operations
+     */
+    std::string getTuningSignature() const;
+
+    /**
+     * @brief Returns string which identifies supported primitive descriptor in the tuning cache: implementation type
+     * and memory layouts
+     */
+    std::string getPrimitiveDescriptorSignature(size_t idx) const;
+
     virtual void getSupportedDescriptors() = 0;
     virtual void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                                   const std::vector<InferenceEngine::TensorDesc>& outputDesc) {}
@@ -436,6 +465,14 @@ public:
         return created();
     }
 
+    /**
+     * @brief Returns true if descriptors enumeration and primitive creation of the node read only its own state, edges and
+     * constant data of the parents, so they can run concurrently with the same stages of other nodes
+     */
+    virtual bool canBeInitializedConcurrently() const {
+        return false;
+    }
+
     /**
      * @brief Performs Node initialization based on graph context.
      * This is an auxiliary method that allows to use information not available in Node constructor (e.g. connection information with other nodes)
@@ -555,6 +592,46 @@ protected:
     virtual void appendPostOps(mkldnn::post_ops& ops);
     virtual std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr() const { return nullptr; }
 
+    /**
+     * @brief Benchmarks oneDNN primitive created from descs with the given attributes which matches supported primitive descriptor idx
+     */
+    double benchmarkPrimitive(size_t idx, const mkldnn::primitive_attr& attr);
+
+    /**
+     * @brief Returns description of the attributes for the primitive cache key, or empty string if the primitive must not
+     * be shared because its post operations refer to the node data by pointers
+     */
+    static std::string getPrimitiveAttrKey(const mkldnn::primitive_attr& attr);
+
+    /**
+     * @brief Returns the key of the primitive in the process wide primitive cache, or empty string if the primitive can't be shared
+     * @param attrKey description of the primitive attributes, see getPrimitiveAttrKey()
+     */
+    static std::string getPrimitiveCacheKey(const mkldnn::primitive_desc_base& prim_desc, const std::string& attrKey);
+
+    /**
+     * @brief Creates the primitive or takes the one created for the same key from the process wide primitive cache.
+     * Shared primitives are executed concurrently, so the descriptor must be created with the user scratchpad mode.
+     * The memory of the scratchpad is bound by the graph, see addScratchpadArg().
+     * @param attrKey description of the primitive attributes, see getPrimitiveAttrKey()
+     */
+    template <typename P, typename PD>
+    void createPrimitiveFromCache(const PD& prim_desc, const std::string& attrKey) {
+        std::function<MKLDNNPrimitiveCache::PrimitivePtr()> create = [&prim_desc]() {
+            return std::make_shared<P>(prim_desc);
+        };
+
+        const auto key = getPrimitiveCacheKey(prim_desc, attrKey);
+        prim = key.empty() ? create() : MKLDNNPrimitiveCache::getInstance().getOrCreate(key, create);
+        addScratchpadArg(prim_desc);
+    }
+
+    /**
+     * @brief Records the scratchpad of the primitive. Nodes of a graph are executed one by one, so the graph binds the
+     * scratchpads of all its nodes to one memory sized for the largest of them
+     */
+    void addScratchpadArg(const mkldnn::primitive_desc_base& prim_desc);
+
     typedef std::function<MKLDNNMemoryDesc (mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx)>
             GetPrimitiveMemoryFormatFunc;
     std::vector<GetPrimitiveMemoryFormatFunc> internalBlobDesc;
@@ -583,6 +660,7 @@ protected:
     std::vector<MKLDNNMemoryPtr> internalBlobMemory;
     std::vector<PrimitiveDescInfo> supportedPrimitiveDescriptors;
     std::unordered_map<int, mkldnn::memory> primArgs;
+    mkldnn::memory::desc scratchpadDesc;
     MKLDNNPrimitive prim;
     std::vector<MKLDNNDescriptor> descs;
 
@@ -6,12 +6,15 @@
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
+#include "mkldnn_jit_kernel_cache.h"
+#include "mkldnn_primitive_cache.h"
 #include "mkldnn_itt.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
 #include <vector>
 #include <tuple>
 #include <ie_system_conf.h>
@@ -34,6 +37,7 @@
 
 #include <transformations/common_optimizations/common_optimizations.hpp>
 #include <transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp>
+#include <transformations/common_optimizations/mark_weights_decompression.hpp>
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
 #include <transformations/common_optimizations/depth_to_space_fusion.hpp>
 #include <transformations/common_optimizations/softmax_fusion.hpp>
@@ -88,6 +92,7 @@
 
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "utils/cpu_info.h"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -124,6 +129,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8, ngraph::element::i4, ngraph::element::u4 });
+    } else {
+        // Keep weight-only compressed MatMul weights compressed, they are decompressed by FullyConnected node
+        manager.register_pass<ngraph::pass::MarkWeightsDecompression>();
     }
 
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
@@ -293,6 +301,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
             return ngraph::pass::low_precision::NetworkHelper::areQuantizeAndDequantizeSupportedForSubtract(node);
         });
+    } else {
+        pass_config->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+            return ngraph::is_weights_decompression(node);
+        });
     }
 
     manager.run_passes(nGraphFunc);
@@ -356,6 +368,10 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
         return false;
     });
 
+    legacyPassConfig->set_callback<ngraph::pass::ConvertSubtract>([](const_node_ptr &node) -> bool {
+        return ngraph::is_weights_decompression(node);
+    });
+
     legacyPassConfig->set_callback<ngraph::pass::UnrollTensorIterator>([](const_node_ptr &node) -> bool {
         // UnrollTI transformation is disabled by default, is turned on by LowLatency transformation
         return node->get_rt_info().count("UNROLL_TI") == 0;
@@ -446,6 +462,10 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
+    MKLDNNPrimitiveCache::getInstance().setCapacity(engConfig.primitiveCacheCapacity);
+    // the budget is a process wide setting, so it is taken from the engine config only and not from per network configs
+    ExecutorManager::getInstance()->setCPUThreadsBudget(engConfig.threadsBudget);
+    MKLDNNJitKernelCache::getInstance().setPersistentDirectory(engConfig.jitKernelCacheDir);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -483,26 +503,16 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(CPU_METRIC_KEY(JIT_KERNEL_CACHE_HITS));
+        metrics.push_back(CPU_METRIC_KEY(JIT_KERNEL_CACHE_MISSES));
+        metrics.push_back(CPU_METRIC_KEY(JIT_KERNEL_CACHE_LOADS));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES));
+        metrics.push_back(CPU_METRIC_KEY(PRIMITIVE_CACHE_EVICTIONS));
+        metrics.push_back(CPU_METRIC_KEY(THREADS_ALLOCATION));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
-        std::string brand_string;
-#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
-        unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
-        unsigned int regs[4];
-        for (auto addr : addr_list) {
-            regs[0] = addr;
-#ifdef _WIN32
-            __cpuid(reinterpret_cast<int*>(regs), regs[0]);
-#else
-            __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
-#endif
-            char *ch = reinterpret_cast<char*>(&regs[0]);
-            for (size_t j = 0; j < sizeof(regs); j++)
-                brand_string += ch[j];
-        }
-#else
-        brand_string = "Non Intel Architecture";
-#endif
+        std::string brand_string = getCPUBrandString();
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, brand_string);
     } else if (name == METRIC_KEY(AVAILABLE_DEVICES)) {
         std::vector<std::string> availableDevices = { "" };
@@ -529,6 +539,29 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == CPU_METRIC_KEY(JIT_KERNEL_CACHE_HITS)) {
+        auto statistics = MKLDNNJitKernelCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_JIT_KERNEL_CACHE_HITS, static_cast<uint64_t>(statistics.hits));
+    } else if (name == CPU_METRIC_KEY(JIT_KERNEL_CACHE_MISSES)) {
+        auto statistics = MKLDNNJitKernelCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_JIT_KERNEL_CACHE_MISSES, static_cast<uint64_t>(statistics.misses));
+    } else if (name == CPU_METRIC_KEY(JIT_KERNEL_CACHE_LOADS)) {
+        auto statistics = MKLDNNJitKernelCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_JIT_KERNEL_CACHE_LOADS, static_cast<uint64_t>(statistics.loads));
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_HITS)) {
+        auto statistics = MKLDNNPrimitiveCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_HITS, static_cast<uint64_t>(statistics.hits));
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_MISSES)) {
+        auto statistics = MKLDNNPrimitiveCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_MISSES, static_cast<uint64_t>(statistics.misses));
+    } else if (name == CPU_METRIC_KEY(PRIMITIVE_CACHE_EVICTIONS)) {
+        auto statistics = MKLDNNPrimitiveCache::getInstance().getStatistics();
+        IE_SET_METRIC_RETURN(CPU_PRIMITIVE_CACHE_EVICTIONS, static_cast<uint64_t>(statistics.evictions));
+    } else if (name == CPU_METRIC_KEY(THREADS_ALLOCATION)) {
+        std::map<std::string, int> allocation;
+        for (const auto& reservation : ExecutorManager::getInstance()->getCPUThreadsReservations())
+            allocation[reservation._name + "#" + std::to_string(reservation._id)] = reservation._threads;
+        IE_SET_METRIC_RETURN(CPU_THREADS_ALLOCATION, allocation);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
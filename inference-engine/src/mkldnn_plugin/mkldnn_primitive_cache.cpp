@@ -0,0 +1,79 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitive_cache.h"
+
+namespace MKLDNNPlugin {
+
+constexpr size_t MKLDNNPrimitiveCache::defaultCapacity;
+
+MKLDNNPrimitiveCache& MKLDNNPrimitiveCache::getInstance() {
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+MKLDNNPrimitiveCache::PrimitivePtr MKLDNNPrimitiveCache::getOrCreate(const std::string& key,
+                                                                    const std::function<PrimitivePtr()>& create) {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = index.find(key);
+        if (found != index.end()) {
+            entries.splice(entries.begin(), entries, found->second);
+            statistics.hits++;
+            return found->second->second;
+        }
+        statistics.misses++;
+    }
+
+    // primitive creation generates the code, so it is done without the lock
+    auto primitive = create();
+
+    std::lock_guard<std::mutex> lock(guard);
+    if (capacity == 0)
+        return primitive;
+
+    // other thread may have created the same primitive in the meantime, keep the stored one
+    auto found = index.find(key);
+    if (found != index.end()) {
+        entries.splice(entries.begin(), entries, found->second);
+        return found->second->second;
+    }
+
+    entries.emplace_front(key, primitive);
+    index[key] = entries.begin();
+    evictAbove(capacity);
+    return primitive;
+}
+
+void MKLDNNPrimitiveCache::setCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(guard);
+    capacity = newCapacity;
+    evictAbove(capacity);
+}
+
+size_t MKLDNNPrimitiveCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return capacity;
+}
+
+size_t MKLDNNPrimitiveCache::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return entries.size();
+}
+
+MKLDNNPrimitiveCache::Statistics MKLDNNPrimitiveCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return statistics;
+}
+
+void MKLDNNPrimitiveCache::evictAbove(size_t maxSize) {
+    // nodes keep references to the evicted primitives, so they are released together with the last network using them
+    while (entries.size() > maxSize) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+        statistics.evictions++;
+    }
+}
+
+}  // namespace MKLDNNPlugin
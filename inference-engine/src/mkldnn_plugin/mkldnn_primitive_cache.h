@@ -0,0 +1,77 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Process wide LRU storage of oneDNN primitives
+ *
+ * Primitives are identified by a key built from the operation descriptor, memory formats, attributes and implementation
+ * name, see MKLDNNNode::getPrimitiveCacheKey(). A primitive is created once and shared by nodes of all graphs with the
+ * same key: graphs of all streams, different networks and networks loaded again after reshape. The cache keeps
+ * primitives alive after the networks are released, so the number of stored primitives is bounded by the capacity and
+ * the least recently used primitive is evicted first. Zero capacity disables the cache.
+ *
+ * Shared primitives are executed concurrently, so they must be created with the user scratchpad mode.
+ *
+ * Is a thread safe
+ */
+class MKLDNNPrimitiveCache {
+public:
+    using PrimitivePtr = std::shared_ptr<mkldnn::primitive>;
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
+    static constexpr size_t defaultCapacity = 1024;
+
+    explicit MKLDNNPrimitiveCache(size_t capacity = defaultCapacity) : capacity(capacity) {}
+
+    static MKLDNNPrimitiveCache& getInstance();
+
+    /**
+     * @brief Returns the primitive stored with the key, or creates and stores a new one
+     * @param key unique primitive identifier
+     * @param create function which creates the primitive
+     */
+    PrimitivePtr getOrCreate(const std::string& key, const std::function<PrimitivePtr()>& create);
+
+    /**
+     * @brief Sets the maximal number of stored primitives, evicts the least recently used primitives above it
+     */
+    void setCapacity(size_t newCapacity);
+    size_t getCapacity() const;
+    size_t size() const;
+
+    Statistics getStatistics() const;
+
+private:
+    using Entry = std::pair<std::string, PrimitivePtr>;
+
+    void evictAbove(size_t maxSize);
+
+    // the most recently used primitive is the first one
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    size_t capacity;
+    Statistics statistics;
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,244 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_primitive_tuner.h"
+#include "mkldnn_extension_utils.h"
+#include "utils/cpu_info.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <ie_common.h>
+#include "ie_parallel.hpp"
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const char header[] = "# CPU plugin tuning cache v1";
+
+// Number of timed runs, the fastest one is taken
+constexpr int benchmarkRuns = 5;
+// Timing stops earlier when the body is slow enough for the measurement to be reliable
+constexpr double benchmarkBudgetMs = 100.0;
+
+}  // namespace
+
+double measureExecutionTime(const std::function<void()>& body) {
+    auto run = [&]() {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // the first run includes jit code generation and page faults
+    run();
+    double best = std::numeric_limits<double>::max();
+    double total = 0.0;
+    for (int i = 0; i < benchmarkRuns && total < benchmarkBudgetMs; i++) {
+        double time = run();
+        best = std::min(best, time);
+        total += time;
+    }
+    return best;
+}
+
+MKLDNNTuningCache::Ptr MKLDNNTuningCache::get(const std::string& file) {
+    static std::mutex registryGuard;
+    static std::map<std::string, std::weak_ptr<MKLDNNTuningCache>> registry;
+
+    if (file.empty())
+        return Ptr(new MKLDNNTuningCache(file));
+
+    std::lock_guard<std::mutex> lock(registryGuard);
+    auto cache = registry[file].lock();
+    if (!cache) {
+        cache.reset(new MKLDNNTuningCache(file));
+        registry[file] = cache;
+    }
+    return cache;
+}
+
+std::string MKLDNNTuningCache::platformKey() {
+    static const std::string platform = [] {
+        std::string brand = getCPUBrandString();
+        // brand string reported by cpuid is padded with zeros
+        brand = brand.substr(0, brand.find('\0'));
+        // the same descriptors may be implemented differently by other versions of the libraries
+        return brand + ";" + getCPUIsaName() + ";" + getLibrariesVersion();
+    }();
+    // timings depend on the number of threads the primitives are executed with, so it's taken in the stream of the caller
+    return platform + ";threads=" + std::to_string(parallel_get_max_threads());
+}
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string& file) : file(file) {
+    load();
+}
+
+void MKLDNNTuningCache::load() {
+    if (file.empty())
+        return;
+
+    std::ifstream stream(file);
+    if (!stream.is_open())
+        return;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != header)
+        IE_THROW() << "File " << file << " is not a CPU plugin tuning cache";
+
+    while (std::getline(stream, line)) {
+        auto pos = line.find('\t');
+        if (line.empty() || pos == std::string::npos)
+            continue;
+        records[line.substr(0, pos)] = line.substr(pos + 1);
+    }
+}
+
+bool MKLDNNTuningCache::find(const std::string& key, std::string& value) const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto it = records.find(key);
+    if (it == records.end())
+        return false;
+    value = it->second;
+    return true;
+}
+
+void MKLDNNTuningCache::update(const std::string& key, const std::string& value) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto& record = records[key];
+    if (record != value) {
+        record = value;
+        dirty = true;
+    }
+}
+
+void MKLDNNTuningCache::save() {
+    std::lock_guard<std::mutex> lock(guard);
+    if (file.empty() || !dirty)
+        return;
+
+    // write to a temporary file first, so concurrent readers never see a partially written cache
+    const std::string tmpFile = file + ".tmp";
+    {
+        std::ofstream stream(tmpFile, std::ios::trunc);
+        if (!stream.is_open())
+            IE_THROW() << "Cannot open file " << tmpFile << " for writing";
+        stream << header << "\n";
+        for (const auto& record : records)
+            stream << record.first << "\t" << record.second << "\n";
+        if (!stream.good())
+            IE_THROW() << "Cannot write tuning cache to " << tmpFile;
+    }
+    std::remove(file.c_str());
+    if (std::rename(tmpFile.c_str(), file.c_str()) != 0)
+        IE_THROW() << "Cannot save tuning cache to " << file;
+    dirty = false;
+}
+
+MKLDNNPrimitiveTuner::MKLDNNPrimitiveTuner(const Config& config, const mkldnn::engine& eng)
+        : tuningMode(config.tuningMode)
+        , eng(eng)
+        , cache(MKLDNNTuningCache::get(config.tuningCacheFile)) {}
+
+void MKLDNNPrimitiveTuner::tune(const MKLDNNNodePtr& node) {
+    const auto& supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+    if (supportedPrimitiveDescriptors.size() < 2)
+        return;
+
+    std::lock_guard<std::mutex> lock(guard);
+    const std::string key = MKLDNNTuningCache::platformKey() + ";" + node->getTuningSignature();
+    int selected = -1;
+
+    std::string cached;
+    if (cache->find(key, cached)) {
+        for (size_t i = 0; i < supportedPrimitiveDescriptors.size() && selected < 0; i++) {
+            if (node->getPrimitiveDescriptorSignature(i) == cached)
+                selected = static_cast<int>(i);
+        }
+    }
+
+    if (selected < 0 && tuningMode) {
+        double bestTime = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+            double time = node->benchmarkPrimitiveDescriptor(i);
+            if (time < 0)
+                continue;
+            time += inducedReordersTime(node, i);
+            if (time < bestTime) {
+                bestTime = time;
+                selected = static_cast<int>(i);
+            }
+        }
+        if (selected >= 0)
+            cache->update(key, node->getPrimitiveDescriptorSignature(selected));
+    }
+
+    if (selected >= 0)
+        node->selectPrimitiveDescriptorByIndex(selected);
+}
+
+void MKLDNNPrimitiveTuner::save() {
+    cache->save();
+}
+
+double MKLDNNPrimitiveTuner::inducedReordersTime(const MKLDNNNodePtr& node, size_t idx) {
+    const auto& config = node->getSupportedPrimitiveDescriptors()[idx].getConfig();
+    double time = 0.0;
+    for (size_t i = 0; i < config.inConfs.size() && i < node->getParentEdges().size(); i++) {
+        auto parentEdge = node->getParentEdgeAt(i);
+        auto parent = parentEdge->getParent();
+        auto parentPd = parent->getSelectedPrimitiveDescriptor();
+        // reorders on constant paths are executed only once
+        if (parentPd == nullptr || parentPd->getConfig().outConfs.empty() || parent->isConstant())
+            continue;
+
+        int inNum = parentEdge->getInputNum();
+        if (inNum < 0 || static_cast<size_t>(inNum) >= parentPd->getConfig().outConfs.size())
+            inNum = 0;
+        time += reorderTime(parentPd->getConfig().outConfs[inNum].desc, config.inConfs[i].desc);
+    }
+    return time;
+}
+
+double MKLDNNPrimitiveTuner::reorderTime(const TensorDesc& from, const TensorDesc& to) {
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(from, to))
+        return 0.0;
+
+    const std::string key = MKLDNNExtensionUtils::getLayoutSignature(from) + "->" + MKLDNNExtensionUtils::getLayoutSignature(to);
+    auto it = reorderTimes.find(key);
+    if (it != reorderTimes.end())
+        return it->second;
+
+    // descriptors are not initialized at this point, so the reorder is timed between dense tensors
+    auto dense = [](const TensorDesc& desc) {
+        return MKLDNNMemoryDesc(TensorDesc(desc.getPrecision(), desc.getDims(),
+                                           {desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder()}));
+    };
+
+    double time = 0.0;
+    try {
+        mkldnn::memory src(dense(from), eng);
+        mkldnn::memory dst(dense(to), eng);
+        std::memset(src.get_data_handle(), 0, src.get_desc().get_size());
+        mkldnn::reorder reorder(src, dst);
+        mkldnn::stream strm(eng);
+        time = measureExecutionTime([&]() {
+            reorder.execute(strm, src, dst);
+            strm.wait();
+        });
+    } catch (const std::exception&) {
+        // the reorder isn't supported by oneDNN and is done by the plugin itself, it's assumed to be free
+    }
+
+    reorderTimes[key] = time;
+    return time;
+}
+
+}  // namespace MKLDNNPlugin
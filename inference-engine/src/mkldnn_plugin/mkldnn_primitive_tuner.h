@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "config.h"
+#include "mkldnn_node.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Persistent storage of primitive tuning results
+ *
+ * Maps node signature to the signature of the fastest primitive descriptor. Keys are prefixed with CPU model, ISA and
+ * versions of the plugin and oneDNN, so a single file may be shared between different machines and results measured with
+ * other library code are not used. The file is plain text with one "key<TAB>value" record per line. Instances are shared
+ * between all networks loaded with the same cache file.
+ *
+ * Is a thread safe
+ */
+class MKLDNNTuningCache {
+public:
+    typedef std::shared_ptr<MKLDNNTuningCache> Ptr;
+
+    /**
+     * @brief Returns cache bound to the file. Records are loaded from the file on first access
+     * @param file path to the cache file, empty path means in-memory cache which is never saved
+     */
+    static Ptr get(const std::string& file);
+
+    /**
+     * @brief Returns prefix which identifies the current platform in cache keys
+     */
+    static std::string platformKey();
+
+    bool find(const std::string& key, std::string& value) const;
+    void update(const std::string& key, const std::string& value);
+
+    /**
+     * @brief Writes all records to the file if some of them were updated since the last save
+     */
+    void save();
+
+private:
+    explicit MKLDNNTuningCache(const std::string& file);
+    void load();
+
+    const std::string file;
+    std::map<std::string, std::string> records;
+    bool dirty = false;
+    mutable std::mutex guard;
+};
+
+/**
+ * Benchmark-driven selection of primitive descriptors
+ *
+ * Supported primitive descriptors of the node are timed on scratch buffers of the node shapes, time of the reorders
+ * which the descriptor induces on non-constant inputs is added, and the fastest descriptor is selected.
+ * Nodes must be tuned in topological order after parents have selected their descriptors, so consumers
+ * are able to adapt to the tuned layouts by the usual selection logic.
+ *
+ * Is a thread safe. One tuner is shared by the graphs of all streams of a network. Nodes are tuned one at a time, so
+ * benchmarks of different streams do not disturb each other, and the streams which come later take the results measured
+ * by the first one from the cache.
+ */
+class MKLDNNPrimitiveTuner {
+public:
+    MKLDNNPrimitiveTuner(const Config& config, const mkldnn::engine& eng);
+
+    /**
+     * @brief Selects the fastest supported primitive descriptor of the node. Cached result is used if present,
+     * otherwise the node is benchmarked if tuning mode is enabled. Otherwise selection is left intact.
+     */
+    void tune(const MKLDNNNodePtr& node);
+
+    /**
+     * @brief Persists results of tuning
+     */
+    void save();
+
+private:
+    double inducedReordersTime(const MKLDNNNodePtr& node, size_t idx);
+    double reorderTime(const InferenceEngine::TensorDesc& from, const InferenceEngine::TensorDesc& to);
+
+    bool tuningMode;
+    mkldnn::engine eng;
+    MKLDNNTuningCache::Ptr cache;
+    std::map<std::string, double> reorderTimes;
+    std::mutex guard;
+};
+
+/**
+ * @brief Executes the body several times after warm up run
+ * @return The shortest execution time in milliseconds
+ */
+double measureExecutionTime(const std::function<void()>& body);
+
+}  // namespace MKLDNNPlugin
@@ -5,7 +5,15 @@
 #pragma once
 
 #include <cstring>
+#include <cstdint>
+#include <algorithm>
 #include "ie_api.h"
+#include "ie_parallel.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CPU_MEMCPY_STREAMING_STORES
+#endif
 
 /**
  * @brief Copies bytes between buffers with security enhancements
@@ -47,3 +55,54 @@ inline int cpu_memcpy_s(void* dst, size_t dst_size, const void* src, size_t coun
 #endif
     return 0;
 }
+
+/**
+ * @brief Copies large buffers in parallel. Buffers which do not fit the last level cache are written
+ * with non-temporal stores: the copy is not read back soon and would evict the working set of the
+ * network otherwise.
+ * @param dst
+ * pointer to the object to copy to
+ * @param src
+ * pointer to the object to copy from
+ * @param count
+ * number of bytes to copy
+ */
+inline void cpu_parallel_memcpy(void* dst, const void* src, size_t count) {
+    // Smaller buffers are copied by the calling thread
+    constexpr size_t parallelThreshold = 1024 * 1024;
+    // Larger buffers are written around the cache
+    constexpr size_t streamingThreshold = 16 * 1024 * 1024;
+
+    if (count < parallelThreshold) {
+        cpu_memcpy(dst, src, count);
+        return;
+    }
+
+    auto dstBytes = static_cast<uint8_t*>(dst);
+    auto srcBytes = static_cast<const uint8_t*>(src);
+
+    InferenceEngine::parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(count, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+#ifdef CPU_MEMCPY_STREAMING_STORES
+        if (count >= streamingThreshold) {
+            constexpr size_t vlen = sizeof(__m128i);
+            const size_t head = std::min(end - start,
+                                         (vlen - reinterpret_cast<uintptr_t>(dstBytes + start) % vlen) % vlen);
+            cpu_memcpy(dstBytes + start, srcBytes + start, head);
+            start += head;
+
+            for (; start + vlen <= end; start += vlen) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes + start));
+                _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes + start), v);
+            }
+            // non-temporal stores are weakly ordered
+            _mm_sfence();
+        }
+#endif
+        cpu_memcpy(dstBytes + start, srcBytes + start, end - start);
+    });
+}
@@ -9,6 +9,7 @@
 #include <ie_parallel.hpp>
 #include <mkldnn_extension_utils.h>
 #include "cpu_memcpy.h"
+#include "mkldnn_jit_kernel_cache.h"
 #include "utils/bfloat16.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
@@ -138,6 +139,16 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(0);
 };
 
+// the same permutations repeat across layers, streams and networks, so kernels are shared
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_permute_kernel> getOrCreatePermuteKernel(const jit_permute_config_params &jcp) {
+    auto key = MKLDNNJitKernelCache::makeKey("permute", static_cast<int>(isa), jcp.ndims, jcp.dst_block_dims, jcp.src_strides,
+                                             jcp.dst_strides, jcp.n, jcp.data_size, jcp.supported_dynamic_batch);
+    return MKLDNNJitKernelCache::getInstance().getOrCreate<jit_uni_permute_kernel>(key, [&jcp]() -> jit_uni_permute_kernel* {
+        return new jit_uni_permute_kernel_f32<isa>(jcp);
+    });
+}
+
 PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
     prepareParams();
 }
@@ -255,15 +266,12 @@ void PermuteKernel::prepareParams() {
     jcp.data_size = params.data_size;
 
     if (mayiuse(cpu::x64::avx512_common)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_common>(jcp));
+        permute_kernel = getOrCreatePermuteKernel<cpu::x64::avx512_common>(jcp);
     } else if (mayiuse(cpu::x64::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx2>(jcp));
+        permute_kernel = getOrCreatePermuteKernel<cpu::x64::avx2>(jcp);
     } else if (mayiuse(cpu::x64::sse41)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::sse41>(jcp));
+        permute_kernel = getOrCreatePermuteKernel<cpu::x64::sse41>(jcp);
     }
-
-    if (permute_kernel)
-        permute_kernel->create_ker();
 }
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
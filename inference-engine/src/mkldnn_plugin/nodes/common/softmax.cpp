@@ -10,6 +10,7 @@
 #include <mkldnn.hpp>  // TODO: just to replace mkldnn->dnnl via macros
 #include "utils/bfloat16.hpp"
 #include "emitters/jit_bf16_emitters.hpp"
+#include "mkldnn_jit_kernel_cache.h"
 
 #include <algorithm>
 #include <cassert>
@@ -228,6 +229,15 @@ private:
     }
 };
 
+// kernel depends on precisions only, so it is shared between all softmax layers of the process
+template <cpu_isa_t isa>
+static std::shared_ptr<jit_uni_softmax_kernel> getOrCreateSoftmaxKernel(const jit_softmax_config_params &jcp) {
+    auto key = MKLDNNJitKernelCache::makeKey("softmax", static_cast<int>(isa), jcp.src_dt, jcp.dst_dt);
+    return MKLDNNJitKernelCache::getInstance().getOrCreate<jit_uni_softmax_kernel>(key, [&jcp]() -> jit_uni_softmax_kernel* {
+        return new jit_uni_softmax_kernel_f32<isa>(jcp);
+    });
+}
+
 SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     : input_prec(inpPrc), output_prec(outPrc) {
     if (Precision::BF16 == output_prec) {
@@ -242,17 +252,15 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     jcp.dst_dt = outPrc;
 
     if (mayiuse(x64::avx512_common)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(jcp));
+        softmax_kernel = getOrCreateSoftmaxKernel<x64::avx512_common>(jcp);
         block_size = 16;
     } else if (mayiuse(x64::avx2)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(jcp));
+        softmax_kernel = getOrCreateSoftmaxKernel<x64::avx2>(jcp);
         block_size = 8;
     } else if (mayiuse(x64::sse41)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(jcp));
+        softmax_kernel = getOrCreateSoftmaxKernel<x64::sse41>(jcp);
         block_size = 4;
     }
-    if (softmax_kernel)
-        softmax_kernel->create_ker();
 }
 
 template<typename in_data_t, typename out_data_t>
@@ -0,0 +1,232 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_decompression.h"
+#include "cpu_convert.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mkldnn.hpp>
+#include <ie_common.h>
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+
+using namespace InferenceEngine;
+using namespace MKLDNNPlugin;
+
+namespace {
+
+// Starting from this number of rows it's cheaper to decompress a panel of weights once and call sgemm on it
+constexpr size_t largeBatchThreshold = 16;
+// Number of rows processed by one task of the small batch kernel, all of them reuse one decompressed weights row
+constexpr size_t rowsPerTask = 4;
+// Number of output channel blocks decompressed at once by the large batch kernel
+constexpr size_t panelBlocks = 16;
+
+template <bool is4bit, bool isSigned>
+inline void decodeBlock(const int8_t* codes, float* q) {
+    constexpr size_t B = CompressedWeightsKernel::blockSize;
+    if (is4bit) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(codes);
+        for (size_t j = 0; j < B / 2; j++) {
+            int32_t lo = bytes[j] & 0x0F;
+            int32_t hi = bytes[j] >> 4;
+            if (isSigned) {
+                lo = (lo ^ 0x08) - 0x08;
+                hi = (hi ^ 0x08) - 0x08;
+            }
+            q[2 * j] = static_cast<float>(lo);
+            q[2 * j + 1] = static_cast<float>(hi);
+        }
+    } else {
+        for (size_t j = 0; j < B; j++) {
+            q[j] = isSigned ? static_cast<float>(codes[j]) : static_cast<float>(static_cast<uint8_t>(codes[j]));
+        }
+    }
+}
+
+using DecodeFunc = void (*)(const int8_t*, float*);
+
+DecodeFunc getDecodeFunc(bool is4bit, bool isSigned) {
+    if (is4bit)
+        return isSigned ? decodeBlock<true, true> : decodeBlock<true, false>;
+    return isSigned ? decodeBlock<false, true> : decodeBlock<false, false>;
+}
+
+}  // namespace
+
+constexpr size_t CompressedWeightsKernel::blockSize;
+
+CompressedWeightsKernel::CompressedWeightsKernel(const Params& params) : params(params) {
+    if (params.N == 0 || params.K == 0 || params.groupSize == 0 || params.K % params.groupSize != 0)
+        IE_THROW() << "Incorrect compressed weights parameters: N = " << params.N << " K = " << params.K
+                   << " group size = " << params.groupSize;
+
+    NB = (params.N + blockSize - 1) / blockSize;
+    groups = params.K / params.groupSize;
+    blockBytes = params.is4bit ? blockSize / 2 : blockSize;
+
+    const size_t codesBytes = NB * params.K * blockBytes;
+    scalesOffset = (codesBytes + 63) / 64 * 64;
+}
+
+size_t CompressedWeightsKernel::packedSize() const {
+    return scalesOffset + 2 * NB * groups * blockSize * sizeof(float);
+}
+
+void CompressedWeightsKernel::pack(const CodeGetter& code, const ScaleGetter& scale, const ScaleGetter& zeroPoint, uint8_t* dst) const {
+    const size_t N = params.N, K = params.K;
+    auto* dstScales = reinterpret_cast<float*>(dst + scalesOffset);
+    auto* dstOffsets = dstScales + NB * groups * blockSize;
+
+    parallel_for(NB, [&](size_t nb) {
+        uint8_t* dstCodes = dst + nb * K * blockBytes;
+        std::memset(dstCodes, 0, K * blockBytes);
+        for (size_t j = 0; j < blockSize; j++) {
+            const size_t n = nb * blockSize + j;
+            for (size_t k = 0; k < K; k++) {
+                if (n >= N)
+                    break;
+                const int32_t value = code(n, k);
+                if (params.is4bit) {
+                    const uint8_t nibble = static_cast<uint8_t>(value) & 0x0F;
+                    dstCodes[k * blockBytes + j / 2] |= (j % 2) ? static_cast<uint8_t>(nibble << 4) : nibble;
+                } else {
+                    dstCodes[k * blockBytes + j] = static_cast<uint8_t>(value);
+                }
+            }
+            for (size_t g = 0; g < groups; g++) {
+                const size_t idx = (nb * groups + g) * blockSize + j;
+                // w = (q - zp) * scale = q * scale + offset
+                const float s = n < N ? scale(n, g) : 0.f;
+                dstScales[idx] = s;
+                dstOffsets[idx] = n < N ? -zeroPoint(n, g) * s : 0.f;
+            }
+        }
+    });
+}
+
+template <typename in_data_t, typename out_data_t>
+void CompressedWeightsKernel::executeSmallBatch(const uint8_t* packed, const in_data_t* src, out_data_t* dst,
+                                                const float* bias, size_t M) const {
+    const size_t N = params.N, K = params.K, G = params.groupSize;
+    const auto decode = getDecodeFunc(params.is4bit, params.isSigned);
+    const int8_t* codesPtr = codes(packed);
+    const float* scalesPtr = scales(packed);
+    const float* offsetsPtr = offsets(packed);
+
+    const size_t MB = (M + rowsPerTask - 1) / rowsPerTask;
+    parallel_for2d(MB, NB, [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * rowsPerTask;
+        const size_t rows = std::min(rowsPerTask, M - m0);
+
+        float acc[rowsPerTask][blockSize] = {};
+        for (size_t g = 0; g < groups; g++) {
+            float accGroup[rowsPerTask][blockSize] = {};
+            float srcSum[rowsPerTask] = {};
+            for (size_t k = g * G; k < (g + 1) * G; k++) {
+                float q[blockSize];
+                decode(codesPtr + (nb * K + k) * blockBytes, q);
+                for (size_t r = 0; r < rows; r++) {
+                    const float x = static_cast<float>(src[(m0 + r) * K + k]);
+                    srcSum[r] += x;
+                    for (size_t j = 0; j < blockSize; j++)
+                        accGroup[r][j] += x * q[j];
+                }
+            }
+
+            const float* s = scalesPtr + (nb * groups + g) * blockSize;
+            const float* o = offsetsPtr + (nb * groups + g) * blockSize;
+            for (size_t r = 0; r < rows; r++) {
+                for (size_t j = 0; j < blockSize; j++)
+                    acc[r][j] += accGroup[r][j] * s[j] + srcSum[r] * o[j];
+            }
+        }
+
+        const size_t n0 = nb * blockSize;
+        const size_t cols = std::min(blockSize, N - n0);
+        for (size_t r = 0; r < rows; r++) {
+            out_data_t* d = dst + (m0 + r) * N + n0;
+            for (size_t j = 0; j < cols; j++)
+                d[j] = static_cast<out_data_t>(acc[r][j] + (bias ? bias[n0 + j] : 0.f));
+        }
+    });
+}
+
+void CompressedWeightsKernel::executeLargeBatch(const uint8_t* packed, const float* src, float* dst, const float* bias, size_t M) {
+    const size_t N = params.N, K = params.K, G = params.groupSize;
+    const auto decode = getDecodeFunc(params.is4bit, params.isSigned);
+    const int8_t* codesPtr = codes(packed);
+    const float* scalesPtr = scales(packed);
+    const float* offsetsPtr = offsets(packed);
+
+    const size_t ldPanel = panelBlocks * blockSize;
+    panel.resize(K * ldPanel);
+    float* panelPtr = panel.data();
+
+    for (size_t nb0 = 0; nb0 < NB; nb0 += panelBlocks) {
+        const size_t blocks = std::min(panelBlocks, NB - nb0);
+        parallel_for2d(blocks, K, [&](size_t b, size_t k) {
+            const size_t nb = nb0 + b;
+            const size_t g = k / G;
+            const float* s = scalesPtr + (nb * groups + g) * blockSize;
+            const float* o = offsetsPtr + (nb * groups + g) * blockSize;
+            float* w = panelPtr + k * ldPanel + b * blockSize;
+            decode(codesPtr + (nb * K + k) * blockBytes, w);
+            for (size_t j = 0; j < blockSize; j++)
+                w[j] = w[j] * s[j] + o[j];
+        });
+
+        const size_t n0 = nb0 * blockSize;
+        const size_t cols = std::min(blocks * blockSize, N - n0);
+        mkldnn_sgemm('N', 'N', M, cols, K, 1.f, src, K, panelPtr, ldPanel, 0.f, dst + n0, N);
+    }
+
+    if (bias) {
+        parallel_for(M, [&](size_t m) {
+            float* d = dst + m * N;
+            for (size_t n = 0; n < N; n++)
+                d[n] += bias[n];
+        });
+    }
+}
+
+void CompressedWeightsKernel::execute(const uint8_t* packed, const uint8_t* src, Precision srcPrc,
+                                      uint8_t* dst, Precision dstPrc, const float* bias, size_t M) {
+    if (M == 0)
+        return;
+
+    if (M < largeBatchThreshold) {
+        if (srcPrc == Precision::FP32 && dstPrc == Precision::FP32) {
+            executeSmallBatch(packed, reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst), bias, M);
+        } else if (srcPrc == Precision::BF16 && dstPrc == Precision::BF16) {
+            executeSmallBatch(packed, reinterpret_cast<const bfloat16_t*>(src), reinterpret_cast<bfloat16_t*>(dst), bias, M);
+        } else if (srcPrc == Precision::BF16 && dstPrc == Precision::FP32) {
+            executeSmallBatch(packed, reinterpret_cast<const bfloat16_t*>(src), reinterpret_cast<float*>(dst), bias, M);
+        } else if (srcPrc == Precision::FP32 && dstPrc == Precision::BF16) {
+            executeSmallBatch(packed, reinterpret_cast<const float*>(src), reinterpret_cast<bfloat16_t*>(dst), bias, M);
+        } else {
+            IE_THROW() << "Compressed weights kernel doesn't support precisions: " << srcPrc << " -> " << dstPrc;
+        }
+        return;
+    }
+
+    const float* srcF32 = reinterpret_cast<const float*>(src);
+    if (srcPrc != Precision::FP32) {
+        srcScratch.resize(M * params.K);
+        cpu_convert(src, srcScratch.data(), srcPrc, Precision::FP32, M * params.K);
+        srcF32 = srcScratch.data();
+    }
+
+    float* dstF32 = reinterpret_cast<float*>(dst);
+    if (dstPrc != Precision::FP32) {
+        dstScratch.resize(M * params.N);
+        dstF32 = dstScratch.data();
+    }
+
+    executeLargeBatch(packed, srcF32, dstF32, bias, M);
+
+    if (dstPrc != Precision::FP32)
+        cpu_convert(dstF32, dst, Precision::FP32, dstPrc, M * params.N);
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include <ie_precision.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Inner product with weight-only compressed weights.
+ * Weights are stored as 8-bit or 4-bit codes blocked by output channels ([N / 16][K][16]) with per-channel
+ * or per-group scale and zero point, and they are decompressed on the fly inside the accumulation loop.
+ * Activations and output stay in FP32 or BF16.
+ */
+class CompressedWeightsKernel {
+public:
+    static constexpr size_t blockSize = 16;
+
+    struct Params {
+        size_t N = 0;           // output channels
+        size_t K = 0;           // input channels
+        size_t groupSize = 0;   // number of input channels sharing the same scale and zero point
+        bool isSigned = false;
+        bool is4bit = false;
+    };
+
+    using CodeGetter = std::function<int32_t(size_t n, size_t k)>;
+    using ScaleGetter = std::function<float(size_t n, size_t group)>;
+
+    explicit CompressedWeightsKernel(const Params& params);
+
+    const Params& getParams() const {
+        return params;
+    }
+
+    /**
+     * @brief Size in bytes of the packed weights buffer
+     */
+    size_t packedSize() const;
+
+    /**
+     * @brief Packs weights into the blocked layout consumed by execute()
+     * @param code returns the quantized value for output channel n and input channel k
+     * @param scale returns the scale for output channel n and group of input channels
+     * @param zeroPoint returns the zero point for output channel n and group of input channels
+     * @param dst buffer of packedSize() bytes
+     */
+    void pack(const CodeGetter& code, const ScaleGetter& scale, const ScaleGetter& zeroPoint, uint8_t* dst) const;
+
+    /**
+     * @brief dst[M, N] = src[M, K] * decompress(W)[N, K]^T + bias[N]
+     */
+    void execute(const uint8_t* packed, const uint8_t* src, InferenceEngine::Precision srcPrc,
+                 uint8_t* dst, InferenceEngine::Precision dstPrc, const float* bias, size_t M);
+
+private:
+    template <typename in_data_t, typename out_data_t>
+    void executeSmallBatch(const uint8_t* packed, const in_data_t* src, out_data_t* dst, const float* bias, size_t M) const;
+    void executeLargeBatch(const uint8_t* packed, const float* src, float* dst, const float* bias, size_t M);
+
+    const int8_t* codes(const uint8_t* packed) const { return reinterpret_cast<const int8_t*>(packed); }
+    const float* scales(const uint8_t* packed) const { return reinterpret_cast<const float*>(packed + scalesOffset); }
+    const float* offsets(const uint8_t* packed) const { return scales(packed) + NB * groups * blockSize; }
+
+    Params params;
+    size_t NB;
+    size_t groups;
+    size_t blockBytes;
+    size_t scalesOffset;
+
+    std::vector<float> panel;
+    std::vector<float> srcScratch;
+    std::vector<float> dstScratch;
+};
+
+}  // namespace MKLDNNPlugin
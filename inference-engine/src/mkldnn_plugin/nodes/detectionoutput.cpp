@@ -179,60 +179,54 @@ public:
         }
 
         if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
+            parallel_for2d(N, _num_priors, [&](int n, int p) {
+                if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
+                    for (int c = 0; c < _num_classes; ++c) {
+                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
+                    }
+                } else {
+                    for (int c = 0; c < _num_classes; ++c) {
+                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
                     }
                 }
-            }
+            });
         } else {
-            for (int n = 0; n < N; ++n) {
+            parallel_for2d(N, _num_priors, [&](int n, int p) {
                 for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                    }
+                    reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
                 }
-            }
+            });
         }
 
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
-        for (int n = 0; n < N; ++n) {
-            int detections_total = 0;
-
-            if (!_decrease_label_id) {
-                // Caffe style
-                parallel_for(_num_classes, [&](int c) {
-                    if (c != _background_label_id) {  // Ignore background class
-                        int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
-                        int *pbuffer     = buffer_data + c*_num_priors;
-                        int *pdetections = detections_data + n*_num_classes + c;
-
-                        const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
-                        const float *pboxes;
-                        const float *psizes;
-                        if (_share_location) {
-                            pboxes = decoded_bboxes_data + n*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_priors;
-                        } else {
-                            pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
-                            psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
-                        }
-
-                        nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+        if (!_decrease_label_id) {
+            // Caffe style, the classes of all images are processed independently
+            parallel_for2d(N, _num_classes, [&](int n, int c) {
+                if (c != _background_label_id) {  // Ignore background class
+                    int *pindices    = indices_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pbuffer     = buffer_data + n*_num_classes*_num_priors + c*_num_priors;
+                    int *pdetections = detections_data + n*_num_classes + c;
+
+                    const float *pconf = reordered_conf_data + n*_num_classes*_num_priors + c*_num_priors;
+                    const float *pboxes;
+                    const float *psizes;
+                    if (_share_location) {
+                        pboxes = decoded_bboxes_data + n*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_priors;
+                    } else {
+                        pboxes = decoded_bboxes_data + n*4*_num_classes*_num_priors + c*4*_num_priors;
+                        psizes = bbox_sizes_data + n*_num_classes*_num_priors + c*_num_priors;
                     }
-                });
-            } else {
-                // MXNet style
+
+                    nms_cf(pconf, pboxes, psizes, pbuffer, pindices, *pdetections, num_priors_actual[n]);
+                }
+            });
+        } else {
+            // MXNet style
+            parallel_for(N, [&](int n) {
                 int *pindices = indices_data + n*_num_classes*_num_priors;
-                int *pbuffer = buffer_data;
+                int *pbuffer = buffer_data + n*_num_classes*_num_priors;
                 int *pdetections = detections_data + n*_num_classes;
 
                 const float *pconf = reordered_conf_data + n*_num_classes*_num_priors;
@@ -240,14 +234,18 @@ public:
                 const float *psizes = bbox_sizes_data + n*_num_loc_classes*_num_priors;
 
                 nms_mx(pconf, pboxes, psizes, pbuffer, pindices, pdetections, _num_priors);
-            }
+            });
+        }
 
+        parallel_for(N, [&](int n) {
+            int detections_total = 0;
             for (int c = 0; c < _num_classes; ++c) {
                 detections_total += detections_data[n*_num_classes + c];
             }
 
             if (_keep_top_k > -1 && detections_total > _keep_top_k) {
                 std::vector<std::pair<float, std::pair<int, int>>> conf_index_class_map;
+                conf_index_class_map.reserve(detections_total);
 
                 for (int c = 0; c < _num_classes; ++c) {
                     int detections = detections_data[n*_num_classes + c];
@@ -261,8 +259,9 @@ public:
                     }
                 }
 
-                std::sort(conf_index_class_map.begin(), conf_index_class_map.end(),
-                          SortScorePairDescend<std::pair<int, int>>);
+                // only the kept detections have to be ordered
+                std::partial_sort(conf_index_class_map.begin(), conf_index_class_map.begin() + _keep_top_k,
+                                  conf_index_class_map.end(), SortScorePairDescend<std::pair<int, int>>);
                 conf_index_class_map.resize(_keep_top_k);
 
                 // Store the new indices.
@@ -276,7 +275,7 @@ public:
                     detections_data[n*_num_classes + label]++;
                 }
             }
-        }
+        });
 
         const int num_results = outputs[0]->getTensorDesc().getDims()[2];
         const int DETECTION_SIZE = outputs[0]->getTensorDesc().getDims()[3];
@@ -390,6 +389,20 @@ private:
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
                       bool decodeType = true); // after ARM = false
 
+    // coordinates of the boxes kept by NMS as a structure of arrays
+    struct KeptBoxes {
+        std::vector<float> xmin;
+        std::vector<float> ymin;
+        std::vector<float> xmax;
+        std::vector<float> ymax;
+        std::vector<float> sizes;
+
+        void reserve(size_t size);
+        void push(const float *bbox, float bbox_size);
+    };
+
+    bool isSuppressed(const float *bbox, float bbox_size, const KeptBoxes &kept) const;
+
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
 
@@ -454,6 +467,44 @@ static inline float JaccardOverlap(const float *decoded_bbox,
     return intersect_size / (bbox1_size + bbox2_size - intersect_size);
 }
 
+void DetectionOutputImpl::KeptBoxes::reserve(size_t size) {
+    xmin.reserve(size);
+    ymin.reserve(size);
+    xmax.reserve(size);
+    ymax.reserve(size);
+    sizes.reserve(size);
+}
+
+void DetectionOutputImpl::KeptBoxes::push(const float *bbox, float bbox_size) {
+    xmin.push_back(bbox[0]);
+    ymin.push_back(bbox[1]);
+    xmax.push_back(bbox[2]);
+    ymax.push_back(bbox[3]);
+    sizes.push_back(bbox_size);
+}
+
+bool DetectionOutputImpl::isSuppressed(const float *bbox, float bbox_size, const KeptBoxes &kept) const {
+    // The same overlap as JaccardOverlap computes, but for a block of kept boxes at once. There is no early exit inside
+    // a block, so the loop over the structure of arrays is vectorized.
+    const int block_size = 16;
+    const int kept_size = static_cast<int>(kept.sizes.size());
+    for (int start = 0; start < kept_size; start += block_size) {
+        const int end = (std::min)(start + block_size, kept_size);
+        int suppressed = 0;
+        for (int k = start; k < end; ++k) {
+            const float intersect_width  = (std::min)(bbox[2], kept.xmax[k]) - (std::max)(bbox[0], kept.xmin[k]);
+            const float intersect_height = (std::min)(bbox[3], kept.ymax[k]) - (std::max)(bbox[1], kept.ymin[k]);
+            const float intersect_size = intersect_width * intersect_height;
+            const float overlap = (intersect_width > 0.0f && intersect_height > 0.0f) ?
+                                  intersect_size / (bbox_size + kept.sizes[k] - intersect_size) : 0.0f;
+            suppressed |= static_cast<int>(overlap > _nms_threshold);
+        }
+        if (suppressed)
+            return true;
+    }
+    return false;
+}
+
 void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        const float *loc_data,
                                        const float *variance_data,
@@ -475,84 +526,102 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
             }
         }
     }
-    parallel_for(num_priors_actual[n], [&](int p) {
-        float new_xmin = 0.0f;
-        float new_ymin = 0.0f;
-        float new_xmax = 0.0f;
-        float new_ymax = 0.0f;
-
-        float prior_xmin = prior_data[p*pr_size + 0 + offs];
-        float prior_ymin = prior_data[p*pr_size + 1 + offs];
-        float prior_xmax = prior_data[p*pr_size + 2 + offs];
-        float prior_ymax = prior_data[p*pr_size + 3 + offs];
-
-        float loc_xmin = loc_data[4*p*_num_loc_classes + 0];
-        float loc_ymin = loc_data[4*p*_num_loc_classes + 1];
-        float loc_xmax = loc_data[4*p*_num_loc_classes + 2];
-        float loc_ymax = loc_data[4*p*_num_loc_classes + 3];
+    // Priors are decoded in blocks. A block is loaded into a structure of arrays and the parameter checks are done once
+    // per block, so the loops over the block have no branches and are vectorized.
+    const int block_size = 64;
+    const int num_blocks = (num_priors_actual[n] + block_size - 1) / block_size;
+
+    parallel_for(num_blocks, [&](int b) {
+        const int start = b * block_size;
+        const int size = (std::min)(block_size, num_priors_actual[n] - start);
+
+        // prior coordinates, which are replaced by the decoded ones
+        float xmin[block_size], ymin[block_size], xmax[block_size], ymax[block_size];
+        // location predictions scaled by the variances
+        float loc_xmin[block_size], loc_ymin[block_size], loc_xmax[block_size], loc_ymax[block_size];
+
+        for (int i = 0; i < size; ++i) {
+            const float *prior = prior_data + (start + i)*pr_size + offs;
+            const float *loc = loc_data + 4*(start + i)*_num_loc_classes;
+            xmin[i] = prior[0];
+            ymin[i] = prior[1];
+            xmax[i] = prior[2];
+            ymax[i] = prior[3];
+            loc_xmin[i] = loc[0];
+            loc_ymin[i] = loc[1];
+            loc_xmax[i] = loc[2];
+            loc_ymax[i] = loc[3];
+        }
 
         if (!_normalized) {
-            prior_xmin /= _image_width;
-            prior_ymin /= _image_height;
-            prior_xmax /= _image_width;
-            prior_ymax /= _image_height;
+            for (int i = 0; i < size; ++i) {
+                xmin[i] /= _image_width;
+                ymin[i] /= _image_height;
+                xmax[i] /= _image_width;
+                ymax[i] /= _image_height;
+            }
+        }
+
+        if (!_variance_encoded_in_target) {
+            // variance is encoded in bbox, we need to scale the offset accordingly.
+            const float *variance = variance_data + start*4;
+            for (int i = 0; i < size; ++i) {
+                loc_xmin[i] *= variance[i*4 + 0];
+                loc_ymin[i] *= variance[i*4 + 1];
+                loc_xmax[i] *= variance[i*4 + 2];
+                loc_ymax[i] *= variance[i*4 + 3];
+            }
         }
 
         if (_code_type == CodeType::CORNER) {
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to add the offset predictions.
-                new_xmin = prior_xmin + loc_xmin;
-                new_ymin = prior_ymin + loc_ymin;
-                new_xmax = prior_xmax + loc_xmax;
-                new_ymax = prior_ymax + loc_ymax;
-            } else {
-                new_xmin = prior_xmin + variance_data[p*4 + 0] * loc_xmin;
-                new_ymin = prior_ymin + variance_data[p*4 + 1] * loc_ymin;
-                new_xmax = prior_xmax + variance_data[p*4 + 2] * loc_xmax;
-                new_ymax = prior_ymax + variance_data[p*4 + 3] * loc_ymax;
+            for (int i = 0; i < size; ++i) {
+                xmin[i] += loc_xmin[i];
+                ymin[i] += loc_ymin[i];
+                xmax[i] += loc_xmax[i];
+                ymax[i] += loc_ymax[i];
             }
         } else if (_code_type == CodeType::CENTER_SIZE) {
-            float prior_width    =  prior_xmax - prior_xmin;
-            float prior_height   =  prior_ymax - prior_ymin;
-            float prior_center_x = (prior_xmin + prior_xmax) / 2.0f;
-            float prior_center_y = (prior_ymin + prior_ymax) / 2.0f;
-
-            float decode_bbox_center_x, decode_bbox_center_y;
-            float decode_bbox_width, decode_bbox_height;
-
-            if (_variance_encoded_in_target) {
-                // variance is encoded in target, we simply need to restore the offset predictions.
-                decode_bbox_center_x = loc_xmin * prior_width  + prior_center_x;
-                decode_bbox_center_y = loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width  = std::exp(loc_xmax) * prior_width;
-                decode_bbox_height = std::exp(loc_ymax) * prior_height;
-            } else {
-                // variance is encoded in bbox, we need to scale the offset accordingly.
-                decode_bbox_center_x = variance_data[p*4 + 0] * loc_xmin * prior_width + prior_center_x;
-                decode_bbox_center_y = variance_data[p*4 + 1] * loc_ymin * prior_height + prior_center_y;
-                decode_bbox_width    = std::exp(variance_data[p*4 + 2] * loc_xmax) * prior_width;
-                decode_bbox_height   = std::exp(variance_data[p*4 + 3] * loc_ymax) * prior_height;
+            for (int i = 0; i < size; ++i) {
+                const float prior_width    =  xmax[i] - xmin[i];
+                const float prior_height   =  ymax[i] - ymin[i];
+                const float prior_center_x = (xmin[i] + xmax[i]) / 2.0f;
+                const float prior_center_y = (ymin[i] + ymax[i]) / 2.0f;
+
+                const float decode_bbox_center_x = loc_xmin[i] * prior_width  + prior_center_x;
+                const float decode_bbox_center_y = loc_ymin[i] * prior_height + prior_center_y;
+                const float decode_bbox_width    = std::exp(loc_xmax[i]) * prior_width;
+                const float decode_bbox_height   = std::exp(loc_ymax[i]) * prior_height;
+
+                xmin[i] = decode_bbox_center_x - decode_bbox_width  / 2.0f;
+                ymin[i] = decode_bbox_center_y - decode_bbox_height / 2.0f;
+                xmax[i] = decode_bbox_center_x + decode_bbox_width  / 2.0f;
+                ymax[i] = decode_bbox_center_y + decode_bbox_height / 2.0f;
             }
-
-            new_xmin = decode_bbox_center_x - decode_bbox_width  / 2.0f;
-            new_ymin = decode_bbox_center_y - decode_bbox_height / 2.0f;
-            new_xmax = decode_bbox_center_x + decode_bbox_width  / 2.0f;
-            new_ymax = decode_bbox_center_y + decode_bbox_height / 2.0f;
+        } else {
+            std::fill_n(xmin, size, 0.0f);
+            std::fill_n(ymin, size, 0.0f);
+            std::fill_n(xmax, size, 0.0f);
+            std::fill_n(ymax, size, 0.0f);
         }
 
         if (_clip_before_nms) {
-            new_xmin = (std::max)(0.0f, (std::min)(1.0f, new_xmin));
-            new_ymin = (std::max)(0.0f, (std::min)(1.0f, new_ymin));
-            new_xmax = (std::max)(0.0f, (std::min)(1.0f, new_xmax));
-            new_ymax = (std::max)(0.0f, (std::min)(1.0f, new_ymax));
+            for (int i = 0; i < size; ++i) {
+                xmin[i] = (std::max)(0.0f, (std::min)(1.0f, xmin[i]));
+                ymin[i] = (std::max)(0.0f, (std::min)(1.0f, ymin[i]));
+                xmax[i] = (std::max)(0.0f, (std::min)(1.0f, xmax[i]));
+                ymax[i] = (std::max)(0.0f, (std::min)(1.0f, ymax[i]));
+            }
         }
 
-        decoded_bboxes[p*4 + 0] = new_xmin;
-        decoded_bboxes[p*4 + 1] = new_ymin;
-        decoded_bboxes[p*4 + 2] = new_xmax;
-        decoded_bboxes[p*4 + 3] = new_ymax;
-
-        decoded_bbox_sizes[p] = (new_xmax - new_xmin) * (new_ymax - new_ymin);
+        float *bboxes = decoded_bboxes + start*4;
+        float *sizes = decoded_bbox_sizes + start;
+        for (int i = 0; i < size; ++i) {
+            bboxes[i*4 + 0] = xmin[i];
+            bboxes[i*4 + 1] = ymin[i];
+            bboxes[i*4 + 2] = xmax[i];
+            bboxes[i*4 + 3] = ymax[i];
+            sizes[i] = (xmax[i] - xmin[i]) * (ymax[i] - ymin[i]);
+        }
     });
 }
 
@@ -577,19 +646,12 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    KeptBoxes kept;
+    kept.reserve(num_output_scores);
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!isSuppressed(bboxes + idx*4, sizes[idx], kept)) {
+            kept.push(bboxes + idx*4, sizes[idx]);
             indices[detections] = idx;
             detections++;
         }
@@ -5,14 +5,192 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 #include "list.hpp"
+#include "utils/bfloat16.hpp"
+#include "mkldnn.hpp"
+#include <cpu/x64/jit_generator.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <mutex>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::Extensions::Cpu;
+using namespace MKLDNNPlugin;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
 
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+
+struct jit_emb_bag_call_args {
+    const void* src;
+    const size_t* indices;
+    const float* weights;
+    float* dst;
+    size_t indices_num;
+};
+
+struct jit_emb_bag_config_params {
+    Precision src_dt;
+    // number of leading elements of the row accumulated by the kernel, a multiple of the vector length
+    size_t emb_depth = 0;
+    // distance between the table rows in bytes
+    size_t row_size = 0;
+};
+
+struct jit_uni_embedding_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args *);
+
+    void operator()(const jit_emb_bag_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_embedding_bag_kernel(jit_emb_bag_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_embedding_bag_kernel() {}
+
+    jit_emb_bag_config_params jcp_;
+};
+
+// Accumulates the rows of a single bag. The row is processed by blocks of vector registers, for every block the
+// kernel walks through the bag indices and prefetches the same block of the row that is a few indices ahead.
+template <cpu_isa_t isa>
+struct jit_uni_embedding_bag_kernel_f32 : public jit_uni_embedding_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_kernel_f32)
+
+    explicit jit_uni_embedding_bag_kernel_f32(jit_emb_bag_config_params jcp) : jit_uni_embedding_bag_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+        for (size_t offset = 0; offset < jcp_.emb_depth; offset += unroll * step) {
+            accumulate_block(offset, std::min(unroll, (jcp_.emb_depth - offset) / step));
+        }
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+    const size_t step = vlen / sizeof(float);
+    const size_t unroll = 8;
+    // the number of indices the prefetched row is ahead of the accumulated one
+    const size_t prefetch_distance = 4;
+    const size_t cache_line_size = 64;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_indices = r10;
+    Xbyak::Reg64 reg_weights = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_index_ptr = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_weight_ptr = r15;
+    Xbyak::Reg64 reg_row = rax;
+    Xbyak::Reg64 reg_prefetch_row = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_src = Vmm(8);
+    Vmm vmm_weight = Vmm(9);
+
+    void accumulate_block(size_t offset, size_t vectors) {
+        const size_t src_size = jcp_.src_dt.size();
+        const size_t src_offset = offset * src_size;
+
+        for (size_t v = 0; v < vectors; v++)
+            uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+
+        mov(reg_index_ptr, reg_indices);
+        mov(reg_weight_ptr, reg_weights);
+        mov(reg_work_amount, reg_indices_num);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label skip_prefetch_label;
+        Xbyak::Label no_weights_label;
+        Xbyak::Label accumulated_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_work_amount, 0);
+            je(exit_label, T_NEAR);
+
+            cmp(reg_work_amount, static_cast<int>(prefetch_distance));
+            jle(skip_prefetch_label, T_NEAR);
+            mov(reg_prefetch_row, ptr[reg_index_ptr + prefetch_distance * sizeof(size_t)]);
+            imul(reg_prefetch_row, reg_prefetch_row, static_cast<int>(jcp_.row_size));
+            add(reg_prefetch_row, reg_src);
+            for (size_t line = 0; line < vectors * step * src_size; line += cache_line_size)
+                prefetcht0(ptr[reg_prefetch_row + src_offset + line]);
+            L(skip_prefetch_label);
+
+            mov(reg_row, ptr[reg_index_ptr]);
+            imul(reg_row, reg_row, static_cast<int>(jcp_.row_size));
+            add(reg_row, reg_src);
+
+            cmp(reg_weight_ptr, 0);
+            je(no_weights_label, T_NEAR);
+            uni_vbroadcastss(vmm_weight, ptr[reg_weight_ptr]);
+            add(reg_weight_ptr, sizeof(float));
+            for (size_t v = 0; v < vectors; v++) {
+                load_vector(vmm_src, ptr[reg_row + src_offset + v * step * src_size]);
+                uni_vfmadd231ps(Vmm(v), vmm_src, vmm_weight);
+            }
+            jmp(accumulated_label, T_NEAR);
+
+            L(no_weights_label);
+            for (size_t v = 0; v < vectors; v++) {
+                load_vector(vmm_src, ptr[reg_row + src_offset + v * step * src_size]);
+                uni_vaddps(Vmm(v), Vmm(v), vmm_src);
+            }
+
+            L(accumulated_label);
+            add(reg_index_ptr, sizeof(size_t));
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(exit_label);
+
+        for (size_t v = 0; v < vectors; v++)
+            uni_vmovups(ptr[reg_dst + (offset + v * step) * sizeof(float)], Vmm(v));
+    }
+
+    inline void load_vector(Vmm vmm_src, const Xbyak::Address &op) {
+        switch (jcp_.src_dt) {
+            case Precision::FP32:
+                uni_vmovups(vmm_src, op);
+                break;
+            case Precision::BF16:
+                vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
+            default:
+                assert(!"unknown src_dt");
+        }
+    }
+};
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
 
 const std::set<size_t> MKLDNNEmbeddingBagSum::_supportedIndicesTypeSize = {sizeof(INT32), sizeof(INT64)};
 
@@ -37,7 +215,11 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         if (inData == nullptr || indicesData == nullptr)
             IE_THROW() << logPrefix << "has nullable input data.";
 
-        auto dataPrecision = inData->getTensorDesc().getPrecision();
+        // BF16 table is read as is and accumulated in FP32 precision. FP16 tables never get here, the plugin converts
+        // FP16 constants to FP32 on network load. I8/U8 tables are summed as integers by the reference loop, row-wise
+        // quantized tables (per row scale and shift) are not fused and are dequantized to FP32 by the preceding nodes
+        const auto tablePrecision = inData->getTensorDesc().getPrecision();
+        auto dataPrecision = tablePrecision;
         if (dataPrecision == Precision::BF16)
             dataPrecision = Precision::FP32;
         if (!supportedPrecisions.empty()) {
@@ -67,7 +249,7 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
             if (data == nullptr)
                 IE_THROW() << logPrefix << "has nullable input data";
             auto prc = data->getTensorDesc().getPrecision();
-            if (prc == Precision::BF16)
+            if (prc == Precision::BF16 && i != 0)
                 prc = Precision::FP32;
             config.inConfs[i].desc = TensorDesc(prc,
                 data->getTensorDesc().getDims(),
@@ -89,121 +271,171 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         for (size_t i = 1lu; i < inDataDims.size(); i++) {
             _embDepth *= inDataDims[i];
         }
+
+        if (dataPrecision == Precision::FP32)
+            createKernel(tablePrecision);
     } catch (InferenceEngine::Exception &ex) {
         errorMsg = ex.what();
     }
 }
 
+void MKLDNNEmbeddingBagSum::createKernel(Precision tablePrecision) {
+    jit_emb_bag_config_params jcp;
+    jcp.src_dt = tablePrecision;
+    jcp.row_size = _embDepth * tablePrecision.size();
+    if (jcp.row_size > static_cast<size_t>(std::numeric_limits<int>::max()))
+        return;
+
+    if (mayiuse(x64::avx512_common)) {
+        jcp.emb_depth = _embDepth - _embDepth % (cpu_isa_traits<x64::avx512_common>::vlen / sizeof(float));
+        if (jcp.emb_depth != 0)
+            _kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx512_common>(jcp));
+    } else if (mayiuse(x64::avx2)) {
+        jcp.emb_depth = _embDepth - _embDepth % (cpu_isa_traits<x64::avx2>::vlen / sizeof(float));
+        if (jcp.emb_depth != 0)
+            _kernel.reset(new jit_uni_embedding_bag_kernel_f32<x64::avx2>(jcp));
+    }
+
+    if (_kernel)
+        _kernel->create_ker();
+}
+
+void MKLDNNEmbeddingBagSum::prepareBags(size_t bagsNum) {
+    _bags.resize(bagsNum);
+    _bagsCost.resize(bagsNum + 1lu);
+    _bagsCost[0] = 0lu;
+    for (size_t obi = 0lu; obi < bagsNum; obi++) {
+        auto& bag = _bags[obi];
+        bag = Bag{};
+        bag.withWeights = _withWeights;
+        getIndices(obi, bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+        // the output row is written even for an empty bag, so every bag costs at least one row
+        _bagsCost[obi + 1lu] = _bagsCost[obi] + (bag.indices != nullptr ? bag.size : 0lu) + 1lu;
+    }
+}
+
 StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
-    switch (inputs[0]->getTensorDesc().getPrecision()) {
-        case Precision::FP32: {
-            processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
-            break;
-        }
-        case Precision::I32: {
-            processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
-            break;
-        }
-        default: {
-            if (resp) {
-                std::string errorMsg = "EmbeddingBagSum layer does not support precision '"
-                        + std::string(inputs[0]->getTensorDesc().getPrecision().name()) + "'";
-                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+    try {
+        initFromInputs(inputs);
+        prepareBags(outputs[0]->getTensorDesc().getDims()[0]);
+
+        switch (inputs[0]->getTensorDesc().getPrecision()) {
+            case Precision::FP32: {
+                processData<PrecisionTrait<Precision::FP32>::value_type, float>(inputs, outputs);
+                break;
+            }
+            case Precision::BF16: {
+                processData<MKLDNNPlugin::bfloat16_t, float>(inputs, outputs);
+                break;
+            }
+            case Precision::I8: {
+                processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::U8: {
+                processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+                break;
+            }
+            case Precision::I32: {
+                processData<PrecisionTrait<Precision::I32>::value_type, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
+                break;
             }
-            return GENERAL_ERROR;
+            default: {
+                IE_THROW() << "EmbeddingBagSum layer does not support precision '"
+                           << std::string(inputs[0]->getTensorDesc().getPrecision().name()) << "'";
+            }
+        }
+    } catch (const std::exception& ex) {
+        if (resp) {
+            std::string errorMsg = ex.what();
+            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
         }
+        return GENERAL_ERROR;
     }
 
     return OK;
 }
 
-template<typename T>
+template<typename T, typename D>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
-            std::vector<Blob::Ptr>& outputs) noexcept {
+            std::vector<Blob::Ptr>& outputs) {
     const T* srcData = inputs[0]->cbuffer().as<const T*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    T* dstData = outputs[0]->buffer().as<T*>() +
+    D* dstData = outputs[0]->buffer().as<D*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    const T* weightsData = nullptr;
+    const D* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
-    initFromInputs(inputs);
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
 
-    const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
+    const size_t tableRowsNum = inputs[0]->getTensorDesc().getDims()[0];
+    const bool useKernel = _kernel && std::is_same<D, float>::value &&
+        (std::is_same<T, float>::value || std::is_same<T, MKLDNNPlugin::bfloat16_t>::value);
+    const size_t kernelDepth = useKernel ? _kernel->jcp_.emb_depth : 0lu;
 
-    const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+    std::mutex errorMutex;
+    std::string errorMsg;
 
+    const size_t bagsNum = _bags.size();
+    const size_t totalCost = _bagsCost.back();
     auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
-
-        size_t indicesSize = 0lu;
-        const size_t* indices = nullptr;
-        size_t weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        // a thread takes the bags which start within its share of the total cost
+        auto firstBag = [&](size_t cost) {
+            return static_cast<size_t>(std::lower_bound(_bagsCost.begin(), _bagsCost.begin() + bagsNum, cost) - _bagsCost.begin());
+        };
+        const size_t start = firstBag(totalCost * ithr / nthr);
+        const size_t end = firstBag(totalCost * (ithr + 1) / nthr);
 
         for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            const Bag& bag = _bags[obi];
+            D* dst = dstData + obi * _embDepth;
+            if (bag.indices == nullptr) {
+                std::fill(dst, dst + _embDepth, static_cast<D>(0));
+                continue;
+            }
 
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                if (bag.indices[inIdx] >= tableRowsNum) {
+                    std::lock_guard<std::mutex> lock{errorMutex};
+                    errorMsg = "EmbeddingBagSum layer '" + _layerName + "' has invalid embedding bag index: "
+                        + std::to_string(bag.indices[inIdx]);
+                    return;
+                }
+            }
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    IE_THROW() << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
+            const D* weights = bag.withWeights ? weightsData + bag.weightsIdx : nullptr;
+            if (useKernel) {
+                auto args = jit_emb_bag_call_args();
+                args.src = srcData;
+                args.indices = bag.indices;
+                args.weights = reinterpret_cast<const float*>(weights);
+                args.dst = reinterpret_cast<float*>(dst);
+                args.indices_num = bag.size;
+                (*_kernel)(&args);
+            }
 
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+            std::fill(dst + kernelDepth, dst + _embDepth, static_cast<D>(0));
+            for (size_t inIdx = 0lu; inIdx < bag.size; inIdx++) {
+                const T* src = srcData + bag.indices[inIdx] * _embDepth;
+                if (weights != nullptr) {
+                    for (size_t i = kernelDepth; i < _embDepth; i++) {
+                        dst[i] += static_cast<D>(src[i]) * weights[inIdx];
                     }
-                    weightsIdx++;
                 } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0])
-                        IE_THROW() << "EmbeddingBagSum layer '" << _layerName
-                            << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
+                    for (size_t i = kernelDepth; i < _embDepth; i++) {
+                        dst[i] += static_cast<D>(src[i]);
                     }
                 }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
             }
         }
     };
 
     parallel_nt(0, threadBody);
+
+    if (!errorMsg.empty())
+        IE_THROW() << errorMsg;
 }
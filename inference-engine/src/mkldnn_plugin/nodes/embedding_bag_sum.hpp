@@ -14,6 +14,8 @@ namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 
+struct jit_uni_embedding_bag_kernel;
+
 class MKLDNNEmbeddingBagSum : public ExtLayerBase {
 public:
     MKLDNNEmbeddingBagSum(
@@ -38,8 +40,18 @@ protected:
         size_t& weightsIdx,
         bool& withWeights) = 0;
 
-    template<typename T>
-    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
+    // T is a type of the embedding table, D is a type of the output and per sample weights
+    template<typename T, typename D>
+    void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs);
+    void prepareBags(size_t bagsNum);
+    void createKernel(Precision tablePrecision);
+
+    struct Bag {
+        const size_t* indices = nullptr;
+        size_t size = 0lu;
+        size_t weightsIdx = 0lu;
+        bool withWeights = false;
+    };
 
     std::set<Precision> _supportedPrecisions;
 
@@ -51,6 +63,11 @@ protected:
     size_t _embDepth = 0;
     std::string _layerName;
 
+    std::vector<Bag> _bags;
+    // prefix sums of the bags cost, used to split the bags between threads evenly when the bag sizes are skewed
+    std::vector<size_t> _bagsCost;
+    std::shared_ptr<jit_uni_embedding_bag_kernel> _kernel;
+
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
     using INT64 = PrecisionTrait<Precision::I64>::value_type;
     using UINT64 = PrecisionTrait<Precision::U64>::value_type;
@@ -75,6 +75,18 @@ public:
             }
         }
 
+        // Group indices by segments, so a bag is found without scanning all segment ids
+        _segmentStarts.assign(_numSegments, 0lu);
+        _segmentSizes.assign(_numSegments, 0lu);
+        for (size_t si = 0lu; si < _segmentIds.size(); si++) {
+            const size_t segmentId = _segmentIds[si];
+            if (segmentId >= _numSegments)
+                continue;
+            if (_segmentSizes[segmentId] == 0lu)
+                _segmentStarts[segmentId] = si;
+            _segmentSizes[segmentId]++;
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -93,17 +105,12 @@ public:
             IE_THROW() << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentSizes[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (size != 0lu) {
+            indices = _indices.data() + _segmentStarts[embIndex];
+            weightsIdx = _segmentStarts[embIndex];
         }
 
         // Empty bag
@@ -125,6 +132,8 @@ protected:
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
     std::vector<size_t> _defaultIndices;
+    std::vector<size_t> _segmentStarts;
+    std::vector<size_t> _segmentSizes;
 };
 
 REG_FACTORY_FOR(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
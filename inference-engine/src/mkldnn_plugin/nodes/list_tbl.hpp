@@ -12,7 +12,6 @@ MKLDNN_EXTENSION_NODE(EmbeddingBagPackedSumImpl, EmbeddingBagPackedSum);
 MKLDNN_EXTENSION_NODE(EmbeddingSegmentsSumImpl, EmbeddingSegmentsSum);
 MKLDNN_EXTENSION_NODE(CTCLossImpl, CTCLoss);
 MKLDNN_EXTENSION_NODE(PriorBoxImpl, PriorBox);
-MKLDNN_EXTENSION_NODE(MathImpl, Abs);
 MKLDNN_EXTENSION_NODE(MathImpl, Acos);
 MKLDNN_EXTENSION_NODE(MathImpl, Acosh);
 MKLDNN_EXTENSION_NODE(MathImpl, Asin);
@@ -26,7 +25,6 @@ MKLDNN_EXTENSION_NODE(MathImpl, Cosh);
 MKLDNN_EXTENSION_NODE(MathImpl, Floor);
 MKLDNN_EXTENSION_NODE(MathImpl, HardSigmoid);
 MKLDNN_EXTENSION_NODE(MathImpl, Log);
-MKLDNN_EXTENSION_NODE(MathImpl, Neg);
 MKLDNN_EXTENSION_NODE(MathImpl, Reciprocal);
 MKLDNN_EXTENSION_NODE(MathImpl, Selu);
 MKLDNN_EXTENSION_NODE(MathImpl, Sign);
@@ -56,7 +54,6 @@ MKLDNN_EXTENSION_NODE(ExperimentalDetectronROIFeatureExtractorImpl, Experimental
 MKLDNN_EXTENSION_NODE(ONNXCustomProposalImpl, ExperimentalDetectronGenerateProposalsSingleImage);
 MKLDNN_EXTENSION_NODE(NonMaxSuppressionImpl, NonMaxSuppression);
 MKLDNN_EXTENSION_NODE(TopKImpl, TopK);
-MKLDNN_EXTENSION_NODE(ShuffleChannelsImpl, ShuffleChannels);
 MKLDNN_EXTENSION_NODE(PowerFileImpl, PowerFile);
 MKLDNN_EXTENSION_NODE(BatchToSpaceImpl, BatchToSpace);
 MKLDNN_EXTENSION_NODE(ExperimentalDetectronPriorGridGeneratorImpl, ExperimentalDetectronPriorGridGenerator);
@@ -66,7 +63,6 @@ MKLDNN_EXTENSION_NODE(SparseFillEmptyRowsImpl, SparseFillEmptyRows);
 MKLDNN_EXTENSION_NODE(BucketizeImpl, Bucketize);
 MKLDNN_EXTENSION_NODE(CTCGreedyDecoderImpl, CTCGreedyDecoder);
 MKLDNN_EXTENSION_NODE(CTCGreedyDecoderSeqLenImpl, CTCGreedyDecoderSeqLen);
-MKLDNN_EXTENSION_NODE(GatherImpl, Gather);
 MKLDNN_EXTENSION_NODE(GatherElementsImpl, GatherElements);
 MKLDNN_EXTENSION_NODE(GatherNDImpl, GatherND);
 MKLDNN_EXTENSION_NODE(ProposalImpl, Proposal);
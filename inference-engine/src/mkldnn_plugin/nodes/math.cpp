@@ -9,6 +9,7 @@
 #include <vector>
 #include <cassert>
 #include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -60,7 +61,6 @@ public:
 
             std::string math_func = layer->type;
             if (math_func == "Erf") mathFunction = Math::Erf;
-            else if (math_func == "Abs") mathFunction = Math::Abs;
             else if (math_func == "Acos") mathFunction = Math::Acos;
             else if (math_func == "Acosh") mathFunction = Math::Acosh;
             else if (math_func == "Asin") mathFunction = Math::Asin;
@@ -74,7 +74,6 @@ public:
             else if (math_func == "Floor") mathFunction = Math::Floor;
             else if (math_func == "HardSigmoid") mathFunction = Math::HardSigmoid;
             else if (math_func == "Log") mathFunction = Math::Log;
-            else if (math_func == "Neg") mathFunction = Math::Neg;
             else if (math_func == "Reciprocal") mathFunction = Math::Reciprocal;
             else if (math_func == "Selu") mathFunction = Math::Selu;
             else if (math_func == "Sign") mathFunction = Math::Sign;
@@ -86,17 +85,30 @@ public:
             else
                 IE_THROW() << layer->name << " Incorrect Math layer type!";
 
-            addConfig(layer, {DataConfigurator(ConfLayout::PLN, false, 0, Precision::FP32)}, {DataConfigurator(ConfLayout::PLN, false, 0, Precision::FP32)});
+            // BF16 tensors are converted element-wise inside the kernel instead of by separate reorders
+            if (layer->insData[0].lock()->getTensorDesc().getPrecision() == Precision::BF16)
+                data_precision = Precision::BF16;
+
+            addConfig(layer, {DataConfigurator(ConfLayout::PLN, false, 0, data_precision)},
+                      {DataConfigurator(ConfLayout::PLN, false, 0, data_precision)});
         } catch (InferenceEngine::Exception &ex) {
             errorMsg = ex.what();
         }
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
+        if (data_precision == Precision::BF16)
+            return execImpl<MKLDNNPlugin::bfloat16_t>(inputs, outputs, resp);
+        return execImpl<float>(inputs, outputs, resp);
+    }
+
+private:
+    template <typename data_t>
+    StatusCode execImpl(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept {
         size_t dataSize = outputs[0]->size();
-        const float *src_data = inputs[0]->cbuffer().as<const float *>() +
+        const data_t *src_data = inputs[0]->cbuffer().as<const data_t *>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->cbuffer().as<float *>() +
+        data_t* dst_data = outputs[0]->buffer().as<data_t *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         switch (mathFunction) {
@@ -105,11 +117,6 @@ public:
                 dst_data[i] = error_function(src_data[i]);
             });
             break;
-        case Math::Abs:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = (std::abs)(src_data[i]);
-            });
-            break;
         case Math::Acos:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = acosf(src_data[i]);
@@ -172,11 +179,6 @@ public:
                 dst_data[i] = logf(src_data[i]);
             });
             break;
-        case Math::Neg:
-            parallel_for(dataSize, [&](size_t i) {
-                dst_data[i] = -src_data[i];
-            });
-            break;
         case Math::Reciprocal:
             parallel_for(dataSize, [&](size_t i) {
                 dst_data[i] = 1.0f / src_data[i];
@@ -236,9 +238,7 @@ public:
         return OK;
     }
 
-private:
     enum class Math {
-        Abs,
         Acos,
         Acosh,
         Asin,
@@ -252,7 +252,6 @@ private:
         Floor,
         HardSigmoid,
         Log,
-        Neg,
         Reciprocal,
         Selu,
         Sign,
@@ -264,12 +263,12 @@ private:
     };
 
     Math mathFunction = Math::Erf;
+    Precision data_precision = Precision::FP32;
     float alpha = 0.0f;
     float beta = 0.0f;
     float gamma = 0.0f;
 };
 
-REG_FACTORY_FOR(MathImpl, Abs);
 REG_FACTORY_FOR(MathImpl, Acos);
 REG_FACTORY_FOR(MathImpl, Acosh);
 REG_FACTORY_FOR(MathImpl, Asin);
@@ -284,7 +283,6 @@ REG_FACTORY_FOR(MathImpl, Erf);
 REG_FACTORY_FOR(MathImpl, Floor);
 REG_FACTORY_FOR(MathImpl, HardSigmoid);
 REG_FACTORY_FOR(MathImpl, Log);
-REG_FACTORY_FOR(MathImpl, Neg);
 REG_FACTORY_FOR(MathImpl, Reciprocal);
 REG_FACTORY_FOR(MathImpl, Selu);
 REG_FACTORY_FOR(MathImpl, Sign);
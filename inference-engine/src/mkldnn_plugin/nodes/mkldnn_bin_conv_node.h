@@ -82,6 +82,9 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeInitializedConcurrently() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
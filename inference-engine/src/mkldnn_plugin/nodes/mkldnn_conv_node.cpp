@@ -583,18 +583,48 @@ void MKLDNNConvolutionNode::createPrimitive() {
     addZeroPoints(attr);
     setPostOps(attr, true);
     addScaleToPrimitiveAttr(attr);
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
 
-    prim.reset(new convolution_forward(prim_desc));
-
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     if (withBiases)
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_BIAS, getBias()}, {DNNL_ARG_DST, dst}};
     else
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DST, dst}};
+
+    createPrimitiveFromCache<convolution_forward>(prim_desc, getConvolutionAttrKey(attr));
+}
+
+std::string MKLDNNConvolutionNode::getConvolutionAttrKey(const mkldnn::primitive_attr& attr) const {
+    auto key = getPrimitiveAttrKey(attr);
+    if (key.empty())
+        return key;
+
+    // zero points and the data type of the summed tensor are not reported by the attributes
+    auto appendValues = [&key](const char* name, const void* data, size_t size) {
+        key.append(name);
+        key.append(static_cast<const char*>(data), size);
+    };
+    appendValues(";izp:", inputZeroPoints.data(), inputZeroPoints.size() * sizeof(uint8_t));
+    appendValues(";wzp:", weightsZeroPoints.data(), weightsZeroPoints.size() * sizeof(float));
+    appendValues(";comp:", outputCompensation.data(), outputCompensation.size() * sizeof(int32_t));
+    if (withSum)
+        key += std::string(";sum:") + eltwisePrecision.name();
+    return key;
+}
+
+double MKLDNNConvolutionNode::benchmarkPrimitiveDescriptor(size_t idx) {
+    // fused depthwise convolution reads its weights by raw pointers which are not initialized before memory allocation
+    if (withDWConv)
+        return -1.0;
+
+    // the same holds for the rest of post ops, so only the convolution itself is timed
+    mkldnn::primitive_attr attr;
+    addZeroPoints(attr);
+    return benchmarkPrimitive(idx, attr);
 }
 
 bool MKLDNNConvolutionNode::created() const {
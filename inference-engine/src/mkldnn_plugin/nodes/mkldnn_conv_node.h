@@ -27,8 +27,12 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void filterSupportedPrimitiveDescriptors() override;
     void filterSupportedDescriptors();
+    double benchmarkPrimitiveDescriptor(size_t idx) override;
     bool isPossibleToSkipInitConfig(MKLDNNDescriptor &desc);
     bool created() const override;
+    bool canBeInitializedConcurrently() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
@@ -63,6 +67,7 @@ protected:
 private:
     mkldnn::memory::data_type precisionToDataType(InferenceEngine::Precision prec);
     void addZeroPoints(mkldnn::primitive_attr& attr) const;
+    std::string getConvolutionAttrKey(const mkldnn::primitive_attr& attr) const;
 
     bool withBiases;
     bool withSum;
@@ -185,6 +185,10 @@ void MKLDNNDeconvolutionNode::filterSupportedDescriptors() {
     }
 }
 
+double MKLDNNDeconvolutionNode::benchmarkPrimitiveDescriptor(size_t idx) {
+    return benchmarkPrimitive(idx, attr);
+}
+
 bool MKLDNNDeconvolutionNode::created() const {
     return getType() == Deconvolution;
 }
@@ -193,14 +197,15 @@ void MKLDNNDeconvolutionNode::createPrimitive() {
     if (prim)
         return;
 
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
     auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
             convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
 
-    prim.reset(new convolution_backward_data(prim_desc));
-
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_DIFF_DST, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DIFF_SRC, dst}};
+
+    createPrimitiveFromCache<convolution_backward_data>(prim_desc, getPrimitiveAttrKey(attr));
 }
 
 void MKLDNNDeconvolutionNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
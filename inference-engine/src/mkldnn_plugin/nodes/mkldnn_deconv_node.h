@@ -23,7 +23,11 @@ public:
     void createPrimitive() override;
     void filterSupportedPrimitiveDescriptors() override;
     void filterSupportedDescriptors();
+    double benchmarkPrimitiveDescriptor(size_t idx) override;
     bool created() const override;
+    bool canBeInitializedConcurrently() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
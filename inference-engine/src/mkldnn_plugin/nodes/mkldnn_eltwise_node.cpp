@@ -831,6 +831,12 @@ MKLDNNEltwiseNode::initializers = {
             opType = Sqrt;
             algorithm = mkldnn::algorithm::eltwise_sqrt;
         }},
+        {"neg", [](GenericLayer* activationLayer, EltwiseOpType& opType, mkldnn::algorithm& algorithm, float& alpha, float& beta) {
+            alpha = -1.0f;
+            beta = 0.0f;
+            opType = Linear;
+            algorithm = mkldnn::algorithm::eltwise_linear;
+        }},
         {"linear", [](GenericLayer* activationLayer, EltwiseOpType& opType, mkldnn::algorithm& algorithm, float& alpha, float& beta) {
             alpha = activationLayer->GetParamAsFloat("alpha", 1.0f);
             beta = activationLayer->GetParamAsFloat("beta", 0.0f);
@@ -984,7 +990,9 @@ void MKLDNNEltwiseNode::init() {
                comparator(layerType, "mish") ||
                comparator(layerType, "hsigmoid") ||
                comparator(layerType, "round") ||
-               comparator(layerType, "softplus")) {
+               comparator(layerType, "softplus") ||
+               comparator(layerType, "abs") ||
+               comparator(layerType, "neg")) {
         initializers[layerType](getCnnLayer().get(), eltwiseOp, eltwiseAlgorithm, alpha, beta);
     } else if (comparator(layerType, "erf")) {
         eltwiseOp = Erf;
@@ -53,6 +53,20 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
+    if (withCompressedWeights()) {
+        if (getParentEdges().size() != 1 && getParentEdges().size() != 2)
+            IE_THROW() << "Incorrect number of input edges for layer " << getName();
+        if (getChildEdges().empty())
+            IE_THROW() << "Incorrect number of output edges for layer " << getName();
+
+        MKLDNNDims inDims = getParentEdgesAtPort(0)[0]->getDims();
+        if (!one_of(inDims.ndims(), 2, 3) || static_cast<size_t>(inDims[inDims.ndims() - 1]) != compressedKernel->getParams().K)
+            IE_THROW() << "Unsupported source dims for FC layer " << getName() << " with compressed weights";
+
+        withBiases = getParentEdges().size() == 2;
+        return;
+    }
+
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
     precision = getCnnLayer()->outData[0]->getPrecision();
@@ -139,26 +153,112 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!withCompressedWeights()) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto inputPrecision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (inputPrecision != Precision::BF16)
+        inputPrecision = Precision::FP32;
+    auto outputPrecision = getCnnLayer()->outData[0]->getPrecision();
+    if (outputPrecision != Precision::BF16)
+        outputPrecision = Precision::FP32;
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = true;
+
+    auto createDataConfig = [](const MKLDNNDims& dims, Precision precision) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, MKLDNNExtensionUtils::IEPrecisionToDataType(precision), MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    config.inConfs.push_back(createDataConfig(getParentEdgesAtPort(0)[0]->getDims(), inputPrecision));
+    if (withBiases)
+        config.inConfs.push_back(createDataConfig(getParentEdgesAtPort(1)[0]->getDims(), Precision::FP32));
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), outputPrecision));
+
+    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, impl_desc_type::gemm_any, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
+}
+
+void MKLDNNFullyConnectedNode::initOptimalPrimitiveDescriptor() {
+    // Compressed weights kernel works with planar layouts which are fully defined in initSupportedPrimitiveDescriptors
+    if (withCompressedWeights())
+        return;
+
+    MKLDNNNode::initOptimalPrimitiveDescriptor();
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (withCompressedWeights()) {
+        if (compressedWeights)
+            return;
+
+        auto create = [&] () {
+            MKLDNNMemoryPtr ptr(new MKLDNNMemory(getEngine()));
+            ptr->Create(MKLDNNDims({static_cast<ptrdiff_t>(compressedKernel->packedSize())}), memory::data_type::u8, memory::format_tag::x);
+            compressedKernel->pack(compressedCode, compressedScale, compressedZeroPoint, static_cast<uint8_t*>(ptr->GetData()));
+            return ptr;
+        };
+
+        if (weightCache != nullptr) {
+            std::string string_hash = getName() + "_compressed_" + std::to_string(compressedKernel->packedSize());
+            for (const auto& source : compressedSources) {
+                string_hash += "_" + std::to_string(weightCache->GetHashFunc().hash(source->cbuffer().as<const unsigned char*>(), source->byteSize()));
+            }
+            compressedWeights = *weightCache->findOrCreate(string_hash, create);
+        } else {
+            compressedWeights = create();
+        }
+        return;
+    }
+
     if (prim)
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
+    attr->set_scratchpad_mode(mkldnn::scratchpad_mode::user);
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
             createPrimitiveDescriptor<inner_product_forward::primitive_desc, inner_product_forward::desc>(*attr));
 
-    prim.reset(new inner_product_forward(*prim_desc));
-
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     if (withBiases)
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_BIAS, getBias()}, {DNNL_ARG_DST, dst}};
     else
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getWeights()}, {DNNL_ARG_DST, dst}};
+
+    createPrimitiveFromCache<inner_product_forward>(*prim_desc, getPrimitiveAttrKey(*attr));
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (withCompressedWeights()) {
+        auto& srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
+        auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+        const auto& srcDims = srcMemPtr->GetDims();
+        size_t M = batchToProcess();
+        for (size_t i = 1; i + 1 < srcDims.size(); i++)
+            M *= srcDims[i];
+
+        const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(1)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+        compressedKernel->execute(static_cast<const uint8_t*>(compressedWeights->GetData()),
+                                  reinterpret_cast<const uint8_t*>(srcMemPtr->GetPtr()),
+                                  MKLDNNExtensionUtils::DataTypeToIEPrecision(srcMemPtr->GetDataType()),
+                                  reinterpret_cast<uint8_t*>(dstMemPtr->GetPtr()),
+                                  MKLDNNExtensionUtils::DataTypeToIEPrecision(dstMemPtr->GetDataType()),
+                                  bias, M);
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -395,6 +495,14 @@ const mkldnn::memory& MKLDNNFullyConnectedNode::getBias() const {
 }
 
 InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const {
+    if (withCompressedWeights()) {
+        // Weights are decompressed to the activations precision
+        auto parentEdge = getParentEdgesAtPort(0)[0];
+        if (parentEdge && parentEdge->getStatus() == MKLDNNEdge::Status::Validated)
+            return MKLDNNExtensionUtils::DataTypeToIEPrecision(parentEdge->getMemoryPtr()->GetDataType());
+        return InferenceEngine::Precision::UNSPECIFIED;
+    }
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
     size_t inputsNumLimit = 2;
@@ -408,4 +516,26 @@ InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const
     return MKLDNNExtensionUtils::getMaxPrecision(inputPrecisions);
 }
 
+void MKLDNNFullyConnectedNode::setCompressedWeights(const CompressedWeightsKernel::Params& params,
+                                                    const std::vector<InferenceEngine::Blob::Ptr>& sources,
+                                                    CompressedWeightsKernel::CodeGetter code,
+                                                    CompressedWeightsKernel::ScaleGetter scale,
+                                                    CompressedWeightsKernel::ScaleGetter zeroPoint) {
+    compressedKernel = std::make_shared<CompressedWeightsKernel>(params);
+    compressedSources = sources;
+    compressedCode = std::move(code);
+    compressedScale = std::move(scale);
+    compressedZeroPoint = std::move(zeroPoint);
+}
+
+void MKLDNNFullyConnectedNode::cleanup() {
+    MKLDNNNode::cleanup();
+
+    // Packed weights are kept in compressedWeights, sources aren't needed anymore
+    compressedSources.clear();
+    compressedCode = nullptr;
+    compressedScale = nullptr;
+    compressedZeroPoint = nullptr;
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
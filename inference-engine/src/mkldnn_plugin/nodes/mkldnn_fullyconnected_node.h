@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/weights_decompression.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -19,9 +20,14 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void initOptimalPrimitiveDescriptor() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
+    bool canBeInitializedConcurrently() const override {
+        return true;
+    }
 
     bool canBeInPlace() const override {
         return false;
@@ -43,6 +49,22 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    /**
+     * @brief Replaces weights input with weight-only compressed weights which are decompressed during execution.
+     * Weights are packed on primitive creation, sources are used to build the weights cache key.
+     */
+    void setCompressedWeights(const CompressedWeightsKernel::Params& params,
+                              const std::vector<InferenceEngine::Blob::Ptr>& sources,
+                              CompressedWeightsKernel::CodeGetter code,
+                              CompressedWeightsKernel::ScaleGetter scale,
+                              CompressedWeightsKernel::ScaleGetter zeroPoint);
+
+    bool withCompressedWeights() const {
+        return compressedKernel != nullptr;
+    }
+
+    void cleanup() override;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +77,13 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    std::shared_ptr<CompressedWeightsKernel> compressedKernel;
+    std::vector<InferenceEngine::Blob::Ptr> compressedSources;
+    CompressedWeightsKernel::CodeGetter compressedCode;
+    CompressedWeightsKernel::ScaleGetter compressedScale;
+    CompressedWeightsKernel::ScaleGetter compressedZeroPoint;
+    MKLDNNMemoryPtr compressedWeights;
 };
 
 }  // namespace MKLDNNPlugin
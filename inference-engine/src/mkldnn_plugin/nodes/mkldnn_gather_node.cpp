@@ -0,0 +1,210 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_gather_node.h"
+
+#include <legacy/ie_layers.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "common/cpu_memcpy.h"
+#include "common/fp16_utils.h"
+#include "common/tensor_desc_creator.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+
+#define THROW_ERROR IE_THROW() << "Gather layer with name '" << getName() << "' "
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNGatherNode::MKLDNNGatherNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                   MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNGatherNode::getSupportedDescriptors() {
+    auto* gatherLayer = getCnnLayer().get();
+    if (gatherLayer == nullptr)
+        THROW_ERROR << "cannot convert from CNN layer";
+
+    if (gatherLayer->insData.size() != 2 || gatherLayer->insData[GATHER_DICTIONARY].lock() == nullptr ||
+            gatherLayer->insData[GATHER_INDEXES].lock() == nullptr)
+        THROW_ERROR << "has incorrect number of input edges";
+    if (gatherLayer->outData.empty())
+        THROW_ERROR << "has incorrect number of output edges";
+
+    const SizeVector& dictionaryDims = gatherLayer->insData[GATHER_DICTIONARY].lock()->getTensorDesc().getDims();
+    if (dictionaryDims.empty())
+        THROW_ERROR << "has incorrect input parameters dimension";
+
+    axis = gatherLayer->GetParamAsInt("axis");
+    // Dictionary must be at least rank axis + 1
+    if (axis < -static_cast<int>(dictionaryDims.size()) || axis >= static_cast<int>(dictionaryDims.size()))
+        THROW_ERROR << "has incorrect input parameters dimensions and axis number";
+    if (axis < 0)
+        axis += dictionaryDims.size();
+
+    if (std::find(dictionaryDims.begin() + axis + 1, dictionaryDims.end(), 0) != dictionaryDims.end())
+        THROW_ERROR << "has incorrect input parameters dimension";
+
+    if (getParentEdges().size() != 2)
+        THROW_ERROR << "has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "has incorrect number of output edges";
+}
+
+void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision dataPrecision = getCnnLayer()->insData[GATHER_DICTIONARY].lock()->getPrecision();
+    Precision indexesPrecision = getCnnLayer()->insData[GATHER_INDEXES].lock()->getPrecision();
+    if (indexesPrecision != Precision::FP32 && indexesPrecision != Precision::I32 && indexesPrecision != Precision::FP16)
+        indexesPrecision = Precision::I32;
+
+    const SizeVector dictionaryDims = getParentEdgeAt(GATHER_DICTIONARY)->getDims().ToSizeVector();
+    const SizeVector indexesDims = getParentEdgeAt(GATHER_INDEXES)->getDims().ToSizeVector();
+    const SizeVector dstDims = getChildEdgeAt(0)->getDims().ToSizeVector();
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(2);
+    config.outConfs.resize(1);
+    for (auto& conf : config.inConfs) {
+        conf.inPlace = -1;
+        conf.constant = false;
+    }
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    config.inConfs[GATHER_INDEXES].desc = TensorDesc(indexesPrecision, indexesDims, TensorDesc::getLayoutByDims(indexesDims));
+
+    std::vector<TensorDescCreatorTypes> supportedTypes;
+    // Elements are copied along the outer dimensions of the memory layout, so the same layout can be kept on the input
+    // and the output if the gathered axis is neither the blocked channels dimension nor replaced by several index dimensions
+    if (dictionaryDims.size() > 2 && indexesDims.size() == 1) {
+        supportedTypes.push_back(TensorDescCreatorTypes::nspc);
+        if (axis != 1) {
+            supportedTypes.push_back(TensorDescCreatorTypes::nCsp8c);
+            supportedTypes.push_back(TensorDescCreatorTypes::nCsp16c);
+        }
+    }
+    supportedTypes.push_back(TensorDescCreatorTypes::ncsp);
+    auto creators = TensorDescCreator::getCommonCreators();
+    auto range = TensorDescCreator::makeFilteredRange(creators, dictionaryDims.size(), supportedTypes);
+
+    for (auto itr = range.first; itr != range.second; ++itr) {
+        if (itr->first == TensorDescCreatorTypes::ncsp) {
+            config.inConfs[GATHER_DICTIONARY].desc = TensorDesc(dataPrecision, dictionaryDims, TensorDesc::getLayoutByDims(dictionaryDims));
+            config.outConfs[0].desc = TensorDesc(dataPrecision, dstDims, TensorDesc::getLayoutByDims(dstDims));
+        } else {
+            config.inConfs[GATHER_DICTIONARY].desc = itr->second->createDesc(dataPrecision, dictionaryDims);
+            config.outConfs[0].desc = itr->second->createDesc(dataPrecision, dstDims);
+        }
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+    }
+}
+
+void MKLDNNGatherNode::createPrimitive() {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto &srcMemPtr = getParentEdgeAt(GATHER_DICTIONARY)->getMemoryPtr();
+    auto &idxMemPtr = getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_ERROR << "has not allocated destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_ERROR << "has not allocated input memory";
+    if (!idxMemPtr || !idxMemPtr->GetPrimitivePtr())
+        THROW_ERROR << "has not allocated indexes memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "has unidentified preferable primitive descriptor";
+
+    //  Find number of dictionaries, index range and data length in terms of the selected memory layout.
+    //  The gathered axis appears once in the blocking order, so everything before it is a set of independent
+    //  dictionaries and everything after it is a contiguous piece of data copied for each index.
+    const auto& blockingDesc = getParentEdgeAt(GATHER_DICTIONARY)->getDesc().getBlockingDesc();
+    const SizeVector& blockDims = blockingDesc.getBlockDims();
+    const SizeVector& blockOrder = blockingDesc.getOrder();
+    const size_t axisPos = std::distance(blockOrder.begin(), std::find(blockOrder.begin(), blockOrder.end(), axis));
+
+    numDictionaries = std::accumulate(blockDims.begin(), blockDims.begin() + axisPos, size_t(1), std::multiplies<size_t>());
+    indexRange = blockDims[axisPos];
+    dataLength = std::accumulate(blockDims.begin() + axisPos + 1, blockDims.end(), size_t(1), std::multiplies<size_t>());
+}
+
+namespace {
+struct f32toUi32 {
+    inline unsigned int operator()(const float value) {
+        return static_cast<unsigned int>(value);
+    }
+};
+
+struct f16toUi32 {
+    inline unsigned int operator()(const ie_fp16 value) {
+        return static_cast<unsigned int>(f16tof32(value));
+    }
+};
+
+struct i32toUi32 {
+    inline unsigned int operator()(const int32_t value) {
+        return static_cast<unsigned int>(value);
+    }
+};
+}  // namespace
+
+void MKLDNNGatherNode::execute(mkldnn::stream strm) {
+    switch (getParentEdgeAt(GATHER_INDEXES)->getDesc().getPrecision()) {
+        case Precision::FP32:
+            gather<float, f32toUi32>();
+            break;
+        case Precision::FP16:
+            gather<ie_fp16, f16toUi32>();
+            break;
+        case Precision::I32:
+            gather<int32_t, i32toUi32>();
+            break;
+        default:
+            THROW_ERROR << "has unsupported indexes precision";
+    }
+}
+
+template <typename index_t, class Conversion>
+void MKLDNNGatherNode::gather() {
+    auto &srcMemPtr = getParentEdgeAt(GATHER_DICTIONARY)->getMemoryPtr();
+    auto &idxMemPtr = getParentEdgeAt(GATHER_INDEXES)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const size_t srcIndexSize = static_cast<size_t>(getParentEdgeAt(GATHER_INDEXES)->getDims().size());
+    const index_t *srcIndex = reinterpret_cast<const index_t *>(idxMemPtr->GetPtr());
+    const uint8_t *srcDataDict = reinterpret_cast<const uint8_t *>(srcMemPtr->GetPtr());
+    uint8_t *dstData = reinterpret_cast<uint8_t *>(dstMemPtr->GetPtr());
+    const size_t dstSize = dstMemPtr->GetSize();
+    const size_t len = dataLength * getParentEdgeAt(GATHER_DICTIONARY)->getDesc().getPrecision().size();
+
+    parallel_for(srcIndexSize, [&](size_t i) {
+        unsigned int idx = Conversion()(srcIndex[i]);
+
+        //  Index clipping
+        if (idx < indexRange) {
+            //  Copying data to destination from Dictionary
+            for (size_t j = 0; j < numDictionaries; j++) {
+                cpu_memcpy_s(&dstData[len * (i + j * srcIndexSize)],
+                             dstSize - (len * (i + j * srcIndexSize)),
+                             &srcDataDict[len * (idx + j * indexRange)],
+                             len);
+            }
+        } else {
+            for (size_t j = 0; j < numDictionaries; j++) {
+                memset(&dstData[len * (i + j * srcIndexSize)], 0, len);
+            }
+        }
+    });
+}
+
+bool MKLDNNGatherNode::created() const {
+    return getType() == Gather;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNGatherNode, Gather);
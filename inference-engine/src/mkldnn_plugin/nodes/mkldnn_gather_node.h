@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNGatherNode : public MKLDNNNode {
+public:
+    MKLDNNGatherNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNGatherNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInitializedConcurrently() const override { return true; }
+
+private:
+    template <typename index_t, class Conversion>
+    void gather();
+
+    int axis = 0;
+    size_t numDictionaries = 1;
+    size_t indexRange = 0;
+    size_t dataLength = 1;
+    static const size_t GATHER_DICTIONARY = 0;
+    static const size_t GATHER_INDEXES = 1;
+};
+
+}  // namespace MKLDNNPlugin
@@ -51,7 +51,7 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 }
 
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}), currentStore(dataStore) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -93,11 +93,25 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void MKLDNNMemoryInputNode::bindExternalStore(void* data) {
+    if (!externalStore) {
+        externalStore.reset(new MKLDNNMemory{getEngine()});
+        externalStore->Create(dataStore->GetDescriptor(), data, false);
+    } else {
+        externalStore->GetPrimitivePtr()->set_data_handle_no_pads_proc(data);
+    }
+    currentStore = externalStore;
+}
+
+void MKLDNNMemoryInputNode::releaseExternalStore() {
+    currentStore = dataStore;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*currentStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -105,7 +119,7 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *currentStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
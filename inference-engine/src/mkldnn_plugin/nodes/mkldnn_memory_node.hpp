@@ -98,8 +98,16 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    /**
+     * @brief Makes the node read and update the state directly in external buffer instead of own store
+     * @param data buffer with the same layout and size as the own store
+     */
+    void bindExternalStore(void* data);
+    void releaseExternalStore();
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr externalStore;
+    MKLDNNMemoryPtr currentStore;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -12,6 +12,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.h>
 #include "utils/bfloat16.hpp"
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
@@ -764,6 +765,29 @@ std::tuple<size_t, size_t, size_t, size_t, size_t> MKLDNNMVNNode::get5dShapes(co
     return shapes;
 }
 
+// mean and variance kernels have no post operations, so they are shared between nodes, streams and networks
+template <cpu_isa_t isa>
+static void createMeanVarianceKernels(jit_mvn_config_params jcp, bool normalize_variance,
+                                      std::shared_ptr<jit_uni_mvn_mean_variance_kernel> &mvn_mean_kernel,
+                                      std::shared_ptr<jit_uni_mvn_mean_variance_kernel> &mvn_variance_kernel) {
+    auto& kernelCache = MKLDNNJitKernelCache::getInstance();
+    auto getOrCreate = [&](const jit_mvn_config_params &params) {
+        auto key = MKLDNNJitKernelCache::makeKey("mvn_mean_variance", static_cast<int>(isa), params.planar_layout, params.across_channels,
+                                                 params.normalize_variance, params.src_prc, params.dst_prc,
+                                                 params.C, params.D, params.H, params.W);
+        return kernelCache.getOrCreate<jit_uni_mvn_mean_variance_kernel>(key, [&params]() -> jit_uni_mvn_mean_variance_kernel* {
+            return new jit_uni_mvn_mean_variance_kernel_f32<isa>(params);
+        });
+    };
+
+    jcp.normalize_variance = false;
+    mvn_mean_kernel = getOrCreate(jcp);
+    if (normalize_variance) {
+        jcp.normalize_variance = true;
+        mvn_variance_kernel = getOrCreate(jcp);
+    }
+}
+
 void MKLDNNMVNNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -790,40 +814,19 @@ void MKLDNNMVNNode::createPrimitive() {
     if (mayiuse(cpu::x64::avx512_common)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
 
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
-        if (normalize_variance) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_common>(jcp));
-        }
+        createMeanVarianceKernels<cpu::x64::avx512_common>(jcp, normalize_variance, mvn_mean_kernel, mvn_variance_kernel);
     } else if (mayiuse(cpu::x64::avx2)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
 
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        if (normalize_variance) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        }
+        createMeanVarianceKernels<cpu::x64::avx2>(jcp, normalize_variance, mvn_mean_kernel, mvn_variance_kernel);
     } else if (mayiuse(cpu::x64::sse41)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
 
-        jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        if (normalize_variance) {
-            jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        }
+        createMeanVarianceKernels<cpu::x64::sse41>(jcp, normalize_variance, mvn_mean_kernel, mvn_variance_kernel);
     }
 
     if (mvn_kernel)
         mvn_kernel->create_ker();
-
-    if (mvn_mean_kernel)
-        mvn_mean_kernel->create_ker();
-
-    if (mvn_variance_kernel)
-        mvn_variance_kernel->create_ker();
 }
 
 void MKLDNNMVNNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
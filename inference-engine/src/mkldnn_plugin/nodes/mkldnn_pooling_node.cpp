@@ -136,14 +136,15 @@ void MKLDNNPoolingNode::createPrimitive() {
 
     mkldnn::primitive_attr attr;
     setPostOps(attr, true);
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
 
     auto prim_desc = createPrimitiveDescriptor<pooling_forward::primitive_desc, pooling_forward::desc>(attr);
 
-    prim.reset(new pooling_forward(prim_desc));
-
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+
+    createPrimitiveFromCache<pooling_forward>(prim_desc, getPrimitiveAttrKey(attr));
 }
 
 bool MKLDNNPoolingNode::created() const {
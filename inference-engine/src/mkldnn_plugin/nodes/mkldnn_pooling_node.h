@@ -25,6 +25,9 @@ public:
     void initDescriptor(const InferenceEngine::LayerConfig &config) override;
     void createPrimitive() override;
     bool created() const override;
+    bool canBeInitializedConcurrently() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
@@ -12,6 +12,7 @@
 #include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <mkldnn_jit_kernel_cache.h>
 #include "utils/bfloat16.hpp"
 #include "emitters/jit_bf16_emitters.hpp"
 #include "ie_parallel.hpp"
@@ -1457,6 +1458,21 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
     }
 }
 
+// kernels depend on the config only, so they are shared between nodes, streams and networks
+template <cpu_isa_t isa>
+static void createReduceKernels(const jit_reduce_config_params &jcp, std::shared_ptr<jit_uni_reduce_kernel> &reduce_kernel,
+                                std::shared_ptr<jit_uni_reduce_post_kernel> &reduce_post_kernel) {
+    auto& kernelCache = MKLDNNJitKernelCache::getInstance();
+    auto key = MKLDNNJitKernelCache::makeKey("reduce", static_cast<int>(isa), jcp.planar_layout, static_cast<int>(jcp.reduce_mode),
+                                             static_cast<int>(jcp.src_dt), static_cast<int>(jcp.dst_dt));
+    reduce_kernel = kernelCache.getOrCreate<jit_uni_reduce_kernel>(key, [&jcp]() -> jit_uni_reduce_kernel* {
+        return new jit_uni_reduce_kernel_f32<isa>(jcp);
+    });
+    reduce_post_kernel = kernelCache.getOrCreate<jit_uni_reduce_post_kernel>("post_" + key, [&jcp]() -> jit_uni_reduce_post_kernel* {
+        return new jit_uni_reduce_post_kernel_f32<isa>(jcp);
+    });
+}
+
 void MKLDNNReduceNode::createPrimitive() {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcDataMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
@@ -1480,25 +1496,16 @@ void MKLDNNReduceNode::createPrimitive() {
     jcp.reduce_mode = reduceMode;
 
     if (mayiuse(cpu::x64::avx512_common)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx512_common>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx512_common>(jcp));
+        createReduceKernels<cpu::x64::avx512_common>(jcp, reduce_kernel, reduce_post_kernel);
         blk_size = 16;
     } else if (mayiuse(cpu::x64::avx2)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::avx2>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::avx2>(jcp));
+        createReduceKernels<cpu::x64::avx2>(jcp, reduce_kernel, reduce_post_kernel);
         blk_size = 8;
     } else if (mayiuse(cpu::x64::sse41)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::x64::sse41>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::x64::sse41>(jcp));
+        createReduceKernels<cpu::x64::sse41>(jcp, reduce_kernel, reduce_post_kernel);
         blk_size = 8;
     }
 
-    if (reduce_kernel)
-        reduce_kernel->create_ker();
-
-    if (reduce_post_kernel)
-        reduce_post_kernel->create_ker();
-
     jit_mode = jit_mode && reduce_kernel;
 }
 
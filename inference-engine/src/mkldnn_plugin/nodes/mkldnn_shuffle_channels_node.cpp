@@ -0,0 +1,180 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_shuffle_channels_node.h"
+
+#include <legacy/ie_layers.h>
+#include <cpu/x64/jit_generator.hpp>
+#include <mkldnn_extension_utils.h>
+#include "common/tensor_desc_creator.h"
+
+#include <string>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+
+#define THROW_ERROR IE_THROW() << "ShuffleChannels layer with name '" << getName() << "' "
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+
+MKLDNNShuffleChannelsNode::MKLDNNShuffleChannelsNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                                     MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNShuffleChannelsNode::getSupportedDescriptors() {
+    auto* shuffleChannelsLayer = getCnnLayer().get();
+    if (shuffleChannelsLayer == nullptr)
+        THROW_ERROR << "cannot convert from CNN layer";
+
+    if (shuffleChannelsLayer->insData.size() != 1 || shuffleChannelsLayer->insData[0].lock() == nullptr)
+        THROW_ERROR << "has nullable input data";
+    if (shuffleChannelsLayer->outData.size() != 1 || shuffleChannelsLayer->outData[0] == nullptr)
+        THROW_ERROR << "has nullable output data";
+
+    SizeVector srcDims = shuffleChannelsLayer->insData[0].lock()->getTensorDesc().getDims();
+    SizeVector dstDims = shuffleChannelsLayer->outData[0]->getTensorDesc().getDims();
+    if (srcDims != dstDims)
+        THROW_ERROR << "has different shapes of input and output tensors";
+
+    int axisParam = shuffleChannelsLayer->GetParamAsInt("axis", 1);
+    if (axisParam < 0)
+        axisParam += static_cast<int>(srcDims.size());
+    if (axisParam < 0 || axisParam >= static_cast<int>(srcDims.size()))
+        THROW_ERROR << "has incorrect axis parameter";
+    axis = static_cast<size_t>(axisParam);
+
+    group = shuffleChannelsLayer->GetParamAsUInt("group", 1);
+    if (group == 0 || srcDims[axis] % group)
+        THROW_ERROR << "has group parameter which doesn't evenly divide the channel dimension";
+    groupSize = srcDims[axis] / group;
+
+    if (getParentEdges().size() != 1)
+        THROW_ERROR << "has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "has incorrect number of output edges";
+}
+
+void MKLDNNShuffleChannelsNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
+    auto srcDims = getParentEdgeAt(0)->getDims();
+    const size_t nDims = srcDims.ndims();
+
+    impl_desc_type impl_type;
+    if (mayiuse(impl::cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    InferenceEngine::LayerConfig config;
+    // the batch stays the outermost dimension of the permutation unless it is shuffled itself
+    config.dynBatchSupport = axis != 0;
+    config.inConfs.resize(1);
+    config.outConfs.resize(1);
+    config.inConfs[0].inPlace = -1;
+    config.inConfs[0].constant = false;
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    std::vector<TensorDescCreatorTypes> supportedTypes;
+    if (nDims > 2) {
+        // Shuffling of the blocked channels dimension is a plain permutation only if each group consists of whole blocks
+        // and each block is split evenly between the groups
+        auto canUseBlocked = [=](const size_t block) {
+            return axis != 1 || (groupSize % block == 0 && block % group == 0);
+        };
+
+        supportedTypes.push_back(TensorDescCreatorTypes::nspc);
+        if (canUseBlocked(8lu))
+            supportedTypes.push_back(TensorDescCreatorTypes::nCsp8c);
+        if (canUseBlocked(16lu))
+            supportedTypes.push_back(TensorDescCreatorTypes::nCsp16c);
+    }
+    supportedTypes.push_back(TensorDescCreatorTypes::ncsp);
+    auto creators = TensorDescCreator::getCommonCreators();
+    auto range = TensorDescCreator::makeFilteredRange(creators, nDims, supportedTypes);
+
+    for (auto itr = range.first; itr != range.second; ++itr) {
+        config.inConfs[0].desc = itr->second->createDesc(precision, getParentEdgeAt(0)->getDims().ToSizeVector());
+        config.outConfs[0].desc = itr->second->createDesc(precision, getChildEdgeAt(0)->getDims().ToSizeVector());
+        supportedPrimitiveDescriptors.emplace_back(config, impl_type, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+    }
+}
+
+void MKLDNNShuffleChannelsNode::createPrimitive() {
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_ERROR << "has not allocated destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_ERROR << "has not allocated input memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "has unidentified preferable primitive descriptor";
+
+    const auto& blockingDesc = getParentEdgeAt(0)->getDesc().getBlockingDesc();
+    const SizeVector& blockDims = blockingDesc.getBlockDims();
+    const SizeVector& blockOrder = blockingDesc.getOrder();
+    auto product = [&](size_t begin, size_t end) {
+        return std::accumulate(blockDims.begin() + begin, blockDims.begin() + end, size_t(1), std::multiplies<size_t>());
+    };
+
+    // position of the outer part of the shuffled dimension inside the blocked tensor; the batch dimension is kept
+    // separately as the first dimension of the reshaped tensor to support dynamic batch
+    const size_t axisPos = std::distance(blockOrder.begin(), std::find(blockOrder.begin(), blockOrder.end(), axis));
+    const size_t batch = axis == 0 ? 1 : blockDims[0];
+    const size_t outer = axis == 0 ? 1 : product(1, axisPos);
+
+    PermuteParams params;
+    params.data_size = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision().size();
+
+    const bool isBlockedAxis = std::count(blockOrder.begin(), blockOrder.end(), axis) > 1;
+    if (isBlockedAxis) {
+        // channel c = (j * K / blk + q) * blk + t1 * r + t2, where blk = group * r and K is a group size
+        // new shape: [N, outer, group, K / blk, D1 * D2 * ... * DK, group, r]
+        // order    : [0, 1, 3, 5, 4, 6, 2]
+        const size_t block = blockDims.back();
+        params.src_block_dims = {batch, outer, group, groupSize / block, product(axisPos + 1, blockDims.size() - 1),
+                                 group, block / group};
+        params.order = {0, 1, 3, 5, 4, 6, 2};
+    } else {
+        // new shape: [N, outer, group, K, inner], where K is a group size
+        // order    : [0, 1, 3, 2, 4]
+        params.src_block_dims = {batch, outer, group, groupSize, product(axisPos + 1, blockDims.size())};
+        params.order = {0, 1, 3, 2, 4};
+    }
+
+    const size_t reshapedRank = params.order.size();
+    params.src_block_order.resize(reshapedRank);
+    params.dst_block_order.resize(reshapedRank);
+    params.dst_block_dims.resize(reshapedRank);
+    std::iota(params.src_block_order.begin(), params.src_block_order.end(), 0);
+    std::iota(params.dst_block_order.begin(), params.dst_block_order.end(), 0);
+    for (size_t i = 0; i < reshapedRank; i++)
+        params.dst_block_dims[i] = params.src_block_dims[params.order[i]];
+
+    permuteKernel = std::unique_ptr<PermuteKernel>(new PermuteKernel(params));
+}
+
+void MKLDNNShuffleChannelsNode::execute(mkldnn::stream strm) {
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(this->getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(this->getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    permuteKernel->execute(srcData, dstData, axis == 0 ? 1 : batchToProcess());
+}
+
+bool MKLDNNShuffleChannelsNode::created() const {
+    return getType() == ShuffleChannels;
+}
+REG_MKLDNN_PRIM_FOR(MKLDNNShuffleChannelsNode, ShuffleChannels);
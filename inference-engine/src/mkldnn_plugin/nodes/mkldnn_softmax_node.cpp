@@ -70,8 +70,11 @@ void MKLDNNSoftMaxNode::createPrimitive() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
-    auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, getEngine());
-    primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+    mkldnn::primitive_attr attr;
+    attr.set_scratchpad_mode(mkldnn::scratchpad_mode::user);
+
+    auto prim_desc = softmax_forward::primitive_desc(*selected_desc_ptr, attr, getEngine());
+    primitive_desc_iterator itpd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
 
     while (itpd) {
         impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
@@ -84,11 +87,11 @@ void MKLDNNSoftMaxNode::createPrimitive() {
             break;
     }
 
-    prim.reset(new softmax_forward(prim_desc));
-
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+
+    createPrimitiveFromCache<softmax_forward>(prim_desc, getPrimitiveAttrKey(attr));
 }
 
 bool MKLDNNSoftMaxNode::created() const {
@@ -143,41 +143,82 @@ public:
         }
     }
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (boxEncodingType == boxEncoding::CENTER) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
+    // Boxes of all batches converted to the corner format once, so the encoding is not resolved for every pair
+    // of boxes and the coordinates are shared by all classes.
+    void prepareBoxes(const float *boxes, const SizeVector &boxesStrides) {
+        const size_t size = num_batches * num_boxes;
+        boxesYMin.resize(size);
+        boxesXMin.resize(size);
+        boxesYMax.resize(size);
+        boxesXMax.resize(size);
+        boxesArea.resize(size);
+
+        parallel_for2d(num_batches, num_boxes, [&](size_t batch_idx, size_t box_idx) {
+            const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+            const size_t i = batch_idx * num_boxes + box_idx;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                boxesYMin[i] = box[1] - box[3] / 2.f;
+                boxesXMin[i] = box[0] - box[2] / 2.f;
+                boxesYMax[i] = box[1] + box[3] / 2.f;
+                boxesXMax[i] = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                boxesYMin[i] = (std::min)(box[0], box[2]);
+                boxesXMin[i] = (std::min)(box[1], box[3]);
+                boxesYMax[i] = (std::max)(box[0], box[2]);
+                boxesXMax[i] = (std::max)(box[1], box[3]);
+            }
+            boxesArea[i] = (boxesYMax[i] - boxesYMin[i]) * (boxesXMax[i] - boxesXMin[i]);
+        });
+    }
 
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
+    // i and j are indices of the prepared boxes
+    float intersectionOverUnion(size_t i, size_t j) const {
+        const float areaI = boxesArea[i];
+        const float areaJ = boxesArea[j];
         if (areaI <= 0.f || areaJ <= 0.f)
             return 0.f;
 
         float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
+            (std::max)((std::min)(boxesYMax[i], boxesYMax[j]) - (std::max)(boxesYMin[i], boxesYMin[j]), 0.f) *
+            (std::max)((std::min)(boxesXMax[i], boxesXMax[j]) - (std::max)(boxesXMin[i], boxesXMin[j]), 0.f);
         return intersection_area / (areaI + areaJ - intersection_area);
     }
 
+    // prepared coordinates of the selected boxes of one class
+    struct selectedBoxes {
+        std::vector<float> ymin;
+        std::vector<float> xmin;
+        std::vector<float> ymax;
+        std::vector<float> xmax;
+        std::vector<float> area;
+    };
+
+    // Checks IoU of the box with all selected boxes. Selected boxes are processed by blocks without an early exit
+    // inside a block, so the loop over the structure of arrays is vectorized.
+    bool isSuppressed(size_t i, const selectedBoxes &selected) const {
+        const float yminI = boxesYMin[i], xminI = boxesXMin[i], ymaxI = boxesYMax[i], xmaxI = boxesXMax[i];
+        const float areaI = boxesArea[i];
+        const size_t blockSize = 16;
+        const size_t selectedNum = selected.area.size();
+        for (size_t start = 0; start < selectedNum; start += blockSize) {
+            const size_t end = (std::min)(start + blockSize, selectedNum);
+            int suppressed = 0;
+            for (size_t j = start; j < end; j++) {
+                const float intersection_area =
+                    (std::max)((std::min)(ymaxI, selected.ymax[j]) - (std::max)(yminI, selected.ymin[j]), 0.f) *
+                    (std::max)((std::min)(xmaxI, selected.xmax[j]) - (std::max)(xminI, selected.xmin[j]), 0.f);
+                const float iou = (areaI <= 0.f || selected.area[j] <= 0.f) ?
+                                  0.f : intersection_area / (areaI + selected.area[j] - intersection_area);
+                suppressed |= static_cast<int>(iou >= iou_threshold);
+            }
+            if (suppressed)
+                return true;
+        }
+        return false;
+    }
+
     struct filteredBoxes {
         float score;
         int batch_index;
@@ -194,8 +235,7 @@ public:
         int suppress_begin_index;
     };
 
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                          std::vector<filteredBoxes> &filtBoxes) {
+    void nmsWithSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
         auto less = [](const boxInfo& l, const boxInfo& r) {
             return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
         };
@@ -207,14 +247,16 @@ public:
 
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
             std::vector<filteredBoxes> fb;
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const size_t boxesOffset = batch_idx * num_boxes;
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
+            std::vector<boxInfo> candidates;
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                 if (scoresPtr[box_idx] > score_threshold)
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
+                    candidates.push_back({scoresPtr[box_idx], box_idx, 0});
             }
+            // the heap is built at once instead of pushing the candidates one by one
+            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less, std::move(candidates));
 
             fb.reserve(sorted_boxes.size());
             if (sorted_boxes.size() > 0) {
@@ -225,7 +267,7 @@ public:
 
                     bool box_is_selected = true;
                     for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
+                        float iou = intersectionOverUnion(boxesOffset + currBox.idx, boxesOffset + fb[idx].box_index);
                         currBox.score *= coeff(iou);
                         if (iou >= iou_threshold) {
                             box_is_selected = false;
@@ -242,6 +284,12 @@ public:
                             continue;
                         }
                         if (currBox.score > score_threshold) {
+                            // the decayed box is still ahead of all candidates, so it would be popped and selected
+                            // right away without any new box to check against
+                            if (sorted_boxes.empty() || less(sorted_boxes.top(), currBox)) {
+                                fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                                continue;
+                            }
                             sorted_boxes.push(currBox);
                         }
                     }
@@ -255,11 +303,15 @@ public:
         });
     }
 
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
-                             std::vector<filteredBoxes> &filtBoxes) {
+    void nmsWithoutSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
         int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        // max-heap order: higher score first, lower index first for equal scores
+        auto less = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+            return l.first < r.first || ((l.first == r.first) && (l.second > r.second));
+        };
+
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const size_t boxesOffset = batch_idx * num_boxes;
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::vector<std::pair<float, int>> sorted_boxes;
@@ -268,29 +320,27 @@ public:
                     sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
             }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                                });
-                int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
+            // The candidates are taken from the heap in the descending order only as long as they are needed, the
+            // selection usually stops after max_output_boxes_per_class boxes, far before the full sort completes.
+            std::make_heap(sorted_boxes.begin(), sorted_boxes.end(), less);
+            auto heapEnd = sorted_boxes.end();
 
-                    if (box_is_selected) {
-                        filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+            selectedBoxes selected;
+            int io_selection_size = 0;
+            int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
+            while (heapEnd != sorted_boxes.begin() && io_selection_size < max_out_box) {
+                std::pop_heap(sorted_boxes.begin(), heapEnd, less);
+                --heapEnd;
+                const size_t i = boxesOffset + heapEnd->second;
+                if (!isSuppressed(i, selected)) {
+                    filtBoxes[offset + io_selection_size] = filteredBoxes(heapEnd->first, batch_idx, class_idx, heapEnd->second);
+                    io_selection_size++;
+
+                    selected.ymin.push_back(boxesYMin[i]);
+                    selected.xmin.push_back(boxesXMin[i]);
+                    selected.ymax.push_back(boxesYMax[i]);
+                    selected.xmax.push_back(boxesXMax[i]);
+                    selected.area.push_back(boxesArea[i]);
                 }
             }
             numFiltBox[batch_idx][class_idx] = io_selection_size;
@@ -298,7 +348,6 @@ public:
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        const float *boxes = inputs[NMS_BOXES]->cbuffer().as<const float *>() + inputs[NMS_BOXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         const float *scores = inputs[NMS_SCORES]->cbuffer().as<const float *>() + inputs[NMS_SCORES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         max_output_boxes_per_class = outputs.size() > NMS_SELECTEDSCORES ? 0 : num_boxes;
@@ -347,10 +396,13 @@ public:
 
         std::vector<filteredBoxes> filtBoxes(max_output_boxes_per_class * num_batches * num_classes);
 
+        const float *boxes = inputs[NMS_BOXES]->cbuffer().as<const float *>() + inputs[NMS_BOXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        prepareBoxes(boxes, boxesStrides);
+
         if (soft_nms_sigma == 0.0f) {
-            nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+            nmsWithoutSoftSigma(scores, scoresStrides, filtBoxes);
         } else {
-            nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+            nmsWithSoftSigma(scores, scoresStrides, filtBoxes);
         }
 
         size_t startOffset = numFiltBox[0][0];
@@ -440,6 +492,12 @@ private:
     float scale = 1.f;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    // boxes in the corner format, [num_batches, num_boxes]
+    std::vector<float> boxesYMin;
+    std::vector<float> boxesXMin;
+    std::vector<float> boxesYMax;
+    std::vector<float> boxesXMax;
+    std::vector<float> boxesArea;
     const std::string inType = "input", outType = "output";
     std::string logPrefix;
 
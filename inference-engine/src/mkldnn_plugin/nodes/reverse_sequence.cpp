@@ -10,6 +10,7 @@
 #include <cassert>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -61,115 +62,86 @@ public:
             srcStrides = layer->insData[REVERSESEQUENCE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
             work_amount_dst = srcStrides[0] * src_dims[0];
 
+            // elements are only moved, so BF16 data is processed as is
+            if (layer->insData[REVERSESEQUENCE_DATA].lock()->getTensorDesc().getPrecision() == Precision::BF16)
+                data_precision = Precision::BF16;
+
             addConfig(layer,
-                    { DataConfigurator(ConfLayout::PLN, Precision::FP32), DataConfigurator(ConfLayout::PLN, lengthsPrecision) },
-                    { DataConfigurator(ConfLayout::PLN, Precision::FP32) });
+                    { DataConfigurator(ConfLayout::PLN, data_precision), DataConfigurator(ConfLayout::PLN, lengthsPrecision) },
+                    { DataConfigurator(ConfLayout::PLN, data_precision) });
         } catch (InferenceEngine::Exception &ex) {
             errorMsg = ex.what();
         }
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        size_t i;
-        const float *src_data = inputs[REVERSESEQUENCE_DATA]->cbuffer().as<const float *>() +
-                                inputs[REVERSESEQUENCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->cbuffer().as<float *>() +
-                          outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
         switch (inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getPrecision()) {
-            case Precision::FP32: {
-                float *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<float *>() +
-                                          inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
-                }
-
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
+            case Precision::FP32:
+                return data_precision == Precision::BF16 ? reverse<MKLDNNPlugin::bfloat16_t, float>(inputs, outputs, resp)
+                                                         : reverse<float, float>(inputs, outputs, resp);
+            case Precision::I32:
+                return data_precision == Precision::BF16 ? reverse<MKLDNNPlugin::bfloat16_t, int32_t>(inputs, outputs, resp)
+                                                         : reverse<float, int32_t>(inputs, outputs, resp);
+            default:
+                return GENERAL_ERROR;
+        }
+    }
 
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
-                                idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
-            }
-            break;
-            case Precision::I32: {
-                int32_t *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<int32_t *>() +
+private:
+    template <typename data_t, typename lengths_t>
+    StatusCode reverse(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept {
+        const data_t *src_data = inputs[REVERSESEQUENCE_DATA]->cbuffer().as<const data_t *>() +
+                                 inputs[REVERSESEQUENCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        data_t* dst_data = outputs[0]->buffer().as<data_t *>() +
+                           outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const lengths_t *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<const lengths_t *>() +
                                             inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (seq_lengths_data[i] > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
+
+        for (size_t i = 0; i < src_dims[batch_axis]; i++) {
+            if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis])) {
+                if (resp) {
+                    std::string errorMsg = "Incorrect input 'seq_lengths' values!";
+                    errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
                 }
+                return PARAMETER_MISMATCH;
+            }
+        }
 
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t i, start = 0, end = 0, src_idx = 0;
+            SizeVector counters(src_dims.size(), 0);
+            splitter(work_amount_dst, nthr, ithr, start, end);
+            for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
+                counters[j] = i % src_dims[j];
+                i /= src_dims[j];
+            }
 
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < seq_lengths_data[counters[batch_axis]]) {
-                                idx = seq_lengths_data[counters[batch_axis]] - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
+            for (size_t iwork = start; iwork < end; ++iwork) {
+                for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
+                    size_t idx = counters[i];
+                    if (static_cast<int>(i) == seq_axis &&
+                            static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
+                        idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
                     }
-                });
+                    src_idx += idx * srcStrides[i];
+                }
+                dst_data[iwork] = src_data[src_idx];
+                for (int j = src_dims.size() - 1; j >= 0; j--) {
+                    counters[j] = (counters[j] + 1) % src_dims[j];
+                    if (counters[j] != 0) break;
+                }
             }
-            break;
-            default:
-                return GENERAL_ERROR;
-        }
+        });
 
         return OK;
     }
 
-private:
     const size_t REVERSESEQUENCE_DATA = 0;
     const size_t REVERSESEQUENCE_LENGTHS = 1;
 
     int seq_axis;
     int batch_axis;
+    Precision data_precision = Precision::FP32;
     SizeVector src_dims;
     SizeVector srcStrides;
     size_t work_amount_dst;
@@ -11,7 +11,9 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <type_traits>
 #include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
@@ -89,12 +91,18 @@ public:
             dim = static_cast<int>(src_dims[axis]);
             before_num = count(src_dims, 0, axis);
 
+            // values are only selected and copied, so BF16 is processed natively without conversion to FP32
+            data_precision = layer->insData[TOPK_DATA].lock()->getTensorDesc().getPrecision() == Precision::BF16 ?
+                             Precision::BF16 : Precision::FP32;
+
             if (layer->outData.size() == 1) {
-                addConfig(layer, { DataConfigurator(ConfLayout::PLN, Precision::FP32), DataConfigurator(ConfLayout::PLN, Precision::I32) },
+                addConfig(layer, { DataConfigurator(ConfLayout::PLN, data_precision), DataConfigurator(ConfLayout::PLN, Precision::I32) },
                     { DataConfigurator(ConfLayout::PLN) });
+                if (confs.back().outConfs[0].desc.getPrecision() != Precision::I32)
+                    confs.back().outConfs[0].desc.setPrecision(data_precision);
             } else {
-                addConfig(layer, { DataConfigurator(ConfLayout::PLN, Precision::FP32), DataConfigurator(ConfLayout::PLN, Precision::I32) },
-                    { DataConfigurator(ConfLayout::PLN, Precision::FP32), DataConfigurator(ConfLayout::PLN) });
+                addConfig(layer, { DataConfigurator(ConfLayout::PLN, data_precision), DataConfigurator(ConfLayout::PLN, Precision::I32) },
+                    { DataConfigurator(ConfLayout::PLN, data_precision), DataConfigurator(ConfLayout::PLN) });
 
                 // TODO: WA... While ICNNNetwork has no clear rule to fill tensor precision
                 //       it use precision of parent layer. So each output tensor Data object has
@@ -147,41 +155,46 @@ public:
         }
     };
 
-    template <class Compare1, template <typename> class Compare2>
-    void top1_axis(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    template <class Compare1, template <typename> class Compare2, typename data_t>
+    void top1_axis(const data_t* src_data, data_t* dst_data, int* dst_idx, SizeVector in_dims) {
         int after_num = count(in_dims, axis + 1, in_dims.size());
         int first_index = 0;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-        parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
-            int s_index = i0 * dim * after_num + ib1 * block_size;
-            vec_type_f vmax_val = _mm_uni_loadu_ps(src_data + s_index);
-            vec_type_i vindex_max_val = _mm_uni_setzero_si();
-            for (int i2 = 1; i2 < dim; i2++) {
-                s_index += after_num;
-                vec_type_f vsrc = _mm_uni_loadu_ps(src_data + s_index);
-                vmask_type vmask = Compare1::cmp_ps(vsrc, vmax_val);
-                vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
+        // vectorized part handles FP32 only, BF16 goes through the scalar loop
+        const float* src_f = reinterpret_cast<const float*>(src_data);
+        float* dst_f = reinterpret_cast<float*>(dst_data);
+        if (std::is_same<data_t, float>::value) {
+            parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
+                int s_index = i0 * dim * after_num + ib1 * block_size;
+                vec_type_f vmax_val = _mm_uni_loadu_ps(src_f + s_index);
+                vec_type_i vindex_max_val = _mm_uni_setzero_si();
+                for (int i2 = 1; i2 < dim; i2++) {
+                    s_index += after_num;
+                    vec_type_f vsrc = _mm_uni_loadu_ps(src_f + s_index);
+                    vmask_type vmask = Compare1::cmp_ps(vsrc, vmax_val);
+                    vmax_val = _mm_uni_blendv_ps(vmax_val, vsrc, vmask);
 
-                vec_type_i vindex_cur_val = _mm_uni_set1_epi32(i2);
+                    vec_type_i vindex_cur_val = _mm_uni_set1_epi32(i2);
 #if defined(HAVE_AVX512F)
-                vindex_max_val = _mm512_mask_blend_epi32(vmask, vindex_max_val, vindex_cur_val);
+                    vindex_max_val = _mm512_mask_blend_epi32(vmask, vindex_max_val, vindex_cur_val);
 #else
-                vindex_max_val = _mm_uni_blendv_epi8(vindex_max_val, vindex_cur_val, _mm_uni_castps_si(vmask));
+                    vindex_max_val = _mm_uni_blendv_epi8(vindex_max_val, vindex_cur_val, _mm_uni_castps_si(vmask));
 #endif
-            }
-            if (dst_data)
-                _mm_uni_storeu_ps(dst_data + i0 * after_num + ib1 * block_size, vmax_val);
-            if (dst_idx)
-                _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + i0 * after_num + ib1 * block_size), vindex_max_val);
-        });
-        first_index = after_num / block_size * block_size;
+                }
+                if (dst_f)
+                    _mm_uni_storeu_ps(dst_f + i0 * after_num + ib1 * block_size, vmax_val);
+                if (dst_idx)
+                    _mm_uni_storeu_si(reinterpret_cast<vec_type_i*>(dst_idx + i0 * after_num + ib1 * block_size), vindex_max_val);
+            });
+            first_index = after_num / block_size * block_size;
+        }
 #endif
         int rest = after_num - first_index;
         parallel_for2d(before_num, rest, [&](int i0, int i1) {
             int index_max_val = 0;
             int s_index = i0 * dim * after_num + first_index + i1;
-            float max_val = src_data[s_index];
+            data_t max_val = src_data[s_index];
             for (int i2 = 1; i2 < dim; i2++) {
                 s_index += after_num;
                 if (Compare2<float>()(src_data[s_index], max_val)) {
@@ -196,12 +209,12 @@ public:
         });
     }
 
-    template <template <typename> class Compare>
-    void top1(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    template <template <typename> class Compare, typename data_t>
+    void top1(const data_t* src_data, data_t* dst_data, int* dst_idx, SizeVector in_dims) {
         parallel_for(before_num, [&](int i0) {
             int index_max_val = 0;
             int s_index = i0 * dim;
-            float max_val = src_data[s_index];
+            data_t max_val = src_data[s_index];
             for (int i1 = 1; i1 < dim; i1++) {
                 s_index++;
                 if (Compare<float>()(src_data[s_index], max_val)) {
@@ -216,13 +229,16 @@ public:
         });
     }
 
-    template <class Compare1, template <typename> class Compare2>
-    void topk_axis(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    template <class Compare1, template <typename> class Compare2, typename data_t>
+    void topk_axis(const data_t* src_data, data_t* dst_data, int* dst_idx, SizeVector in_dims) {
         int after_num = count(in_dims, axis + 1, in_dims.size());
         int first_index = 0;
 
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-        if (src_k < count_vec) {
+        // vectorized part handles FP32 only, BF16 goes through the scalar loop
+        const float* src_f = reinterpret_cast<const float*>(src_data);
+        float* dst_f = reinterpret_cast<float*>(dst_data);
+        if (std::is_same<data_t, float>::value && src_k < count_vec) {
             parallel_for2d(before_num, after_num / block_size, [&](int i0, int ib1) {
 #if defined(HAVE_AVX512F)
                 const int N = 32;
@@ -254,7 +270,7 @@ public:
                 };
 
                 for (int i2 = 0; i2 < src_k; i2++) {
-                    vmax_values[i2] = _mm_uni_loadu_ps(src_data + s_index);
+                    vmax_values[i2] = _mm_uni_loadu_ps(src_f + s_index);
                     vmax_indexes[i2] = _mm_uni_set1_epi32(i2);
                     s_index += after_num;
                 }
@@ -272,7 +288,7 @@ public:
                     }
                 }
                 for (int i2 = src_k; i2 < dim; i2++) {
-                    vmax_values[src_k] = _mm_uni_loadu_ps(src_data + s_index);
+                    vmax_values[src_k] = _mm_uni_loadu_ps(src_f + s_index);
                     vmax_indexes[src_k] = _mm_uni_set1_epi32(i2);
                     for (int i3 = src_k; i3 > 0; i3--) {
                         vmask = Compare1::cmp_ps(vmax_values[i3], vmax_values[i3 - 1]);
@@ -310,9 +326,9 @@ public:
                         }
                     }
                 }
-                if (dst_data) {
+                if (dst_f) {
                     for (int i2 = 0; i2 < src_k; i2++)
-                        _mm_uni_storeu_ps(dst_data + (i0 * src_k + i2) * after_num + ib1 * block_size, vmax_values[i2]);
+                        _mm_uni_storeu_ps(dst_f + (i0 * src_k + i2) * after_num + ib1 * block_size, vmax_values[i2]);
                 }
                 if (dst_idx) {
                     for (int i2 = 0; i2 < src_k; i2++)
@@ -324,9 +340,9 @@ public:
 #endif
         int rest = after_num - first_index;
         parallel_for2d(before_num, rest, [&](int i0, int i1) {
-            std::vector<float> max_values(src_k + 1);
+            std::vector<data_t> max_values(src_k + 1);
             std::vector<int> max_indexes(src_k + 1);
-            float tmp_value;
+            data_t tmp_value;
             int tmp_index;
             int s_index = i0 * dim * after_num + first_index + i1;
 
@@ -383,12 +399,12 @@ public:
         });
     }
 
-    template <template <typename> class Compare>
-    void topk(const float* src_data, float* dst_data, int* dst_idx, SizeVector in_dims) {
+    template <template <typename> class Compare, typename data_t>
+    void topk(const data_t* src_data, data_t* dst_data, int* dst_idx, SizeVector in_dims) {
         parallel_for(before_num, [&](int i0) {
-            std::vector<float> max_values(src_k + 1);
+            std::vector<data_t> max_values(src_k + 1);
             std::vector<int> max_indexes(src_k + 1);
-            float tmp_value;
+            data_t tmp_value;
             int tmp_index;
             int s_index = i0 * dim;
 
@@ -446,17 +462,17 @@ public:
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
-            inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+        const uint8_t *src = inputs[TOPK_DATA]->cbuffer().as<const uint8_t *>() +
+            inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding() * data_precision.size();
         src_k = (inputs[TOPK_K]->cbuffer().as<int *>() +
             inputs[TOPK_K]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0];
-        float* dst_data = nullptr;
+        uint8_t* dst_data = nullptr;
         int* dst_idx = nullptr;
 
         if (outputs.size() == 1) {
-            if (outputs[0]->getTensorDesc().getPrecision() == Precision::FP32) {
-                dst_data = outputs[0]->cbuffer().as<float *>() +
-                    outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            if (outputs[0]->getTensorDesc().getPrecision() != Precision::I32) {
+                dst_data = outputs[0]->buffer().as<uint8_t *>() +
+                    outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * data_precision.size();
             } else {
                 dst_idx = outputs[0]->cbuffer().as<int *>() +
                     outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -471,8 +487,8 @@ public:
                 return PARAMETER_MISMATCH;
             }
         } else if (outputs.size() == 2) {
-            dst_data = outputs[TOPK_VALUE]->cbuffer().as<float *>() +
-                outputs[TOPK_VALUE]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+            dst_data = outputs[TOPK_VALUE]->buffer().as<uint8_t *>() +
+                outputs[TOPK_VALUE]->getTensorDesc().getBlockingDesc().getOffsetPadding() * data_precision.size();
             SizeVector dst_data_dims = outputs[TOPK_VALUE]->getTensorDesc().getDims();
 
             dst_idx = outputs[TOPK_INDEX]->cbuffer().as<int *>() +
@@ -499,6 +515,19 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
+        if (data_precision == Precision::BF16) {
+            execImpl(reinterpret_cast<const MKLDNNPlugin::bfloat16_t*>(src), reinterpret_cast<MKLDNNPlugin::bfloat16_t*>(dst_data),
+                     dst_idx, in_dims);
+        } else {
+            execImpl(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst_data), dst_idx, in_dims);
+        }
+
+        return OK;
+    }
+
+private:
+    template <typename data_t>
+    void execImpl(const data_t* src, data_t* dst_data, int* dst_idx, const SizeVector& in_dims) {
         if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
@@ -524,11 +553,8 @@ public:
                     topk_axis<cmplt_ps, std::less>(src, dst_data, dst_idx, in_dims);
             }
         }
-
-        return OK;
     }
 
-private:
     const size_t TOPK_DATA = 0;
     const size_t TOPK_K = 1;
     const size_t TOPK_VALUE = 0;
@@ -544,6 +570,7 @@ private:
 
     bool sort_value = false;
     bool mode_max = true;
+    Precision data_precision = Precision::FP32;
 
     int dim, before_num;
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_info.h"
+
+#include <ie_common.h>
+#include <ie_system_conf.h>
+#include <mkldnn.hpp>
+
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+# ifdef _WIN32
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#endif
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+std::string getCPUBrandString() {
+    std::string brand_string;
+#if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
+    unsigned int addr_list[3] = { 0x80000002, 0x80000003, 0x80000004 };
+    unsigned int regs[4];
+    for (auto addr : addr_list) {
+        regs[0] = addr;
+#ifdef _WIN32
+        __cpuid(reinterpret_cast<int*>(regs), regs[0]);
+#else
+        __get_cpuid(regs[0], &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+        char *ch = reinterpret_cast<char*>(&regs[0]);
+        for (size_t j = 0; j < sizeof(regs); j++)
+            brand_string += ch[j];
+    }
+#else
+    brand_string = "Non Intel Architecture";
+#endif
+    return brand_string;
+}
+
+std::string getCPUIsaName() {
+    if (with_cpu_x86_bfloat16())
+        return "avx512_core_bf16";
+    if (with_cpu_x86_avx512_core())
+        return "avx512_core";
+    if (with_cpu_x86_avx512f())
+        return "avx512_common";
+    if (with_cpu_x86_avx2())
+        return "avx2";
+    if (with_cpu_x86_avx())
+        return "avx";
+    if (with_cpu_x86_sse42())
+        return "sse42";
+    return "any";
+}
+
+std::string getLibrariesVersion() {
+#ifdef CI_BUILD_NUMBER
+    std::string version = std::string("plugin ") + CI_BUILD_NUMBER;
+#else
+    std::string version = "plugin custom";
+#endif
+    const auto onednn = mkldnn_version();
+    version += ";onednn " + std::to_string(onednn->major) + "." + std::to_string(onednn->minor) + "." +
+               std::to_string(onednn->patch) + " " + onednn->hash;
+    return version;
+}
+
+}  // namespace MKLDNNPlugin
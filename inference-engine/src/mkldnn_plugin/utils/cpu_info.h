@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Returns CPU brand string reported by cpuid (e.g. "Intel(R) Xeon(R) Gold 6248 CPU @ 2.50GHz")
+ */
+std::string getCPUBrandString();
+
+/**
+ * @brief Returns name of the most advanced instruction set used by the plugin kernels on the current CPU
+ */
+std::string getCPUIsaName();
+
+/**
+ * @brief Returns build number of the plugin and version of oneDNN. Data persisted by the plugin, which depends on the code
+ * of the libraries, is tagged with it and discarded after an upgrade
+ */
+std::string getLibrariesVersion();
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+const uintptr_t hugePageSize = 2 * 1024 * 1024;
+
+uintptr_t getPageSize() {
+#if defined(__linux__)
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (pageSize > 0)
+        return static_cast<uintptr_t>(pageSize);
+#endif
+    return 4096;
+}
+
+}  // namespace
+
+void firstTouchMemory(void* ptr, size_t size) {
+    if (ptr == nullptr || size == 0)
+        return;
+
+    const size_t pageSize = getPageSize();
+    const size_t pages = (size + pageSize - 1) / pageSize;
+    auto* data = static_cast<volatile uint8_t*>(ptr);
+
+    InferenceEngine::parallel_for(pages, [&](size_t page) {
+        data[page * pageSize] = 0;
+    });
+    // the buffer may start in the middle of a page, so its tail can reach one more page
+    data[size - 1] = 0;
+}
+
+bool adviseHugePages(void* ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + hugePageSize - 1) / hugePageSize * hugePageSize;
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) / hugePageSize * hugePageSize;
+    if (ptr == nullptr || end <= begin)
+        return false;
+    return madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
+std::map<int, uint64_t> getMemoryPlacement(const void* ptr, size_t size) {
+    std::map<int, uint64_t> placement;
+    if (ptr == nullptr || size == 0)
+        return placement;
+
+#if defined(__linux__) && defined(SYS_move_pages)
+    const uintptr_t pageSize = getPageSize();
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    const auto end = begin + size;
+
+    // move_pages without target nodes only reports the node of every page
+    const size_t chunkSize = 4096;
+    std::vector<void*> pages;
+    std::vector<int> status(chunkSize);
+    for (uintptr_t chunk = begin / pageSize * pageSize; chunk < end; chunk += chunkSize * pageSize) {
+        pages.clear();
+        for (uintptr_t page = chunk; page < end && pages.size() < chunkSize; page += pageSize)
+            pages.push_back(reinterpret_cast<void*>(page));
+
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+            return {{-1, size}};
+
+        for (size_t i = 0; i < pages.size(); i++) {
+            // negative status means that the page is not allocated yet
+            if (status[i] < 0)
+                continue;
+            const auto pageBegin = reinterpret_cast<uintptr_t>(pages[i]);
+            placement[status[i]] += std::min(pageBegin + pageSize, end) - std::max(pageBegin, begin);
+        }
+    }
+#else
+    placement[-1] = size;
+#endif
+    return placement;
+}
+
+}  // namespace MKLDNNPlugin
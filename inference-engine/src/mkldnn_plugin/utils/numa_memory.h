@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Writes every memory page of the buffer from the threads of the current task arena, so the OS places the pages
+ * on the NUMA node of the stream which will use the buffer (first-touch policy)
+ */
+void firstTouchMemory(void* ptr, size_t size);
+
+/**
+ * @brief Asks the OS to back the buffer with transparent huge pages. Has to be called before the pages are touched.
+ * Only the part of the buffer aligned to huge pages is advised, so small buffers are left untouched.
+ * @return true if the advice was applied
+ */
+bool adviseHugePages(void* ptr, size_t size);
+
+/**
+ * @brief Returns number of bytes of the buffer placed on each NUMA node. Pages which were not touched yet are not counted.
+ * On systems which can't report page placement the whole buffer is reported for the node -1.
+ */
+std::map<int, uint64_t> getMemoryPlacement(const void* ptr, size_t size);
+
+}  // namespace MKLDNNPlugin
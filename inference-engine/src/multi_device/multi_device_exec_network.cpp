@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -29,13 +31,17 @@ thread_local const char* MultiDeviceExecutableNetwork::_thisPreferredDeviceName
 
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
-                       MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests) :
+                       MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests,
+                       std::atomic_int* busyRequests = nullptr) :
         _workerInferRequestPtr{workerInferRequestPtr},
-        _notBusyWorkerRequests{&notBusyWorkerRequests} {
+        _notBusyWorkerRequests{&notBusyWorkerRequests},
+        _busyRequests{busyRequests} {
     }
     ~IdleGuard() {
         if (nullptr != _notBusyWorkerRequests) {
-            _notBusyWorkerRequests->try_push(_workerInferRequestPtr);
+            if (_notBusyWorkerRequests->try_push(_workerInferRequestPtr) && nullptr != _busyRequests) {
+                --(*_busyRequests);
+            }
         }
     }
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests* Release() {
@@ -45,24 +51,56 @@ struct IdleGuard {
     }
     MultiDeviceExecutableNetwork::WorkerInferRequest*     _workerInferRequestPtr = nullptr;
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
+    std::atomic_int*                                      _busyRequests = nullptr;
 };
 
+void MultiDeviceExecutableNetwork::DeviceStatistics::UpdateServiceTime(std::chrono::microseconds elapsed) {
+    const auto sample = static_cast<std::uint64_t>(std::max<std::chrono::microseconds::rep>(elapsed.count(), 1));
+    auto serviceTime = _serviceTime.load();
+    std::uint64_t updated = 0;
+    do {
+        // the first sample initializes the average, then every sample contributes with the 1/8 weight
+        updated = (0 == serviceTime) ? sample : serviceTime - serviceTime / 8 + sample / 8;
+    } while (!_serviceTime.compare_exchange_weak(serviceTime, updated));
+}
+
+std::chrono::microseconds MultiDeviceExecutableNetwork::DeviceStatistics::ExpectedCompletionTime() const {
+    const auto serviceTime = _serviceTime.load();
+    // number of requests (including the new one) that have to wait for a vacant worker request of the device
+    const auto waiting = std::max(0, _busyRequests.load() + _queuedTasks.load() + 1 - _numRequests);
+    if (0 == waiting)
+        return std::chrono::microseconds(serviceTime);
+    // a device that was not measured yet is not loaded with the queued requests, until the first ones complete
+    if (0 == serviceTime)
+        return std::chrono::microseconds::max();
+    // the worker requests run in parallel, so a vacant one is expected every serviceTime / numRequests
+    return std::chrono::microseconds(serviceTime + serviceTime * waiting / std::max(1, _numRequests));
+}
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != _config.end() && policy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_LATENCY) {
+        _schedulingPolicy = SchedulingPolicy::Latency;
+    }
+    auto deadline = _config.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE);
+    if (deadline != _config.end()) {
+        _requestDeadline = std::chrono::microseconds(std::stoull(deadline->second.as<std::string>()));
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(_devicePrioritiesInitial.cbegin(), _devicePrioritiesInitial.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -73,21 +111,26 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (_devicePrioritiesInitial.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics(static_cast<int>(numRequests)));
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+        auto* statisticsPtr = _deviceStatistics[device].get();
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
-                    IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (InferRequest , StatusCode status) mutable {
+                    IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr, &statisticsPtr->_busyRequests};
+                    statisticsPtr->UpdateServiceTime(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime));
+                    ++statisticsPtr->_completedRequests;
                     workerRequestPtr->_status = status;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -95,12 +138,13 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     }
                     // try to return the request to the idle list (fails if the overall object destruction has began)
                     if (idleGuard.Release()->try_push(workerRequestPtr)) {
+                        --statisticsPtr->_busyRequests;
                         // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         Task t;
                         if (_inferPipelineTasks.try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        else if (PopDeviceSpecificTask(t, device))
                             ScheduleToWorkerInferRequest(std::move(t), device);
                     }
                 });
@@ -108,43 +152,98 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     }
 }
 
-void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+bool MultiDeviceExecutableNetwork::RunOnIdleWorkerInferRequest(Task& inferPipelineTask, const DeviceName& device) {
+    auto& statistics = *_deviceStatistics.at(device);
+    // the request is counted as busy before the pop, so the counter never underestimates the device load
+    ++statistics._busyRequests;
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests.at(device);
+    if (!idleWorkerRequests.try_pop(workerRequestPtr)) {
+        --statistics._busyRequests;
+        return false;
+    }
+    IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests, &statistics._busyRequests};
+    _thisWorkerInferRequest = workerRequestPtr;
+    workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+    {
+        auto capturedTask = std::move(inferPipelineTask);
+        capturedTask();
+    }
+    idleGuard.Release();
+    return true;
+}
+
+bool MultiDeviceExecutableNetwork::PopDeviceSpecificTask(Task& inferPipelineTask, const DeviceName& device) {
+    if (!_inferPipelineTasksDeviceSpecific.at(device)->try_pop(inferPipelineTask))
+        return false;
+    --_deviceStatistics.at(device)->_queuedTasks;
+    return true;
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectDeviceByLatency(const std::vector<DeviceInformation>& devices,
+                                                               std::chrono::microseconds deadline) const {
+    const DeviceInformation* earliestDevice = nullptr;
+    auto earliestTime = std::chrono::microseconds::max();
     for (auto&& device : devices) {
+        const auto expectedTime = _deviceStatistics.at(device.deviceName)->ExpectedCompletionTime();
+        // devices are listed by priority, so the first one meeting the deadline wins over the faster ones
+        if (deadline != std::chrono::microseconds::zero() && expectedTime <= deadline)
+            return device.deviceName;
+        if (nullptr == earliestDevice || expectedTime < earliestTime) {
+            earliestDevice = &device;
+            earliestTime = expectedTime;
+        }
+    }
+    return earliestDevice->deviceName;
+}
+
+std::chrono::microseconds MultiDeviceExecutableNetwork::TimeToDeadline(const TaskScheduling& scheduling) const {
+    if (scheduling.deadline == std::chrono::steady_clock::time_point::max())
+        return _requestDeadline;
+    auto timeLeft = std::chrono::duration_cast<std::chrono::microseconds>(scheduling.deadline - std::chrono::steady_clock::now());
+    // a missed deadline can't be met by any device, zero would disable the deadline instead
+    return std::max(timeLeft, std::chrono::microseconds{1});
+}
+
+void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device,
+                                                                std::chrono::microseconds deadline) {
+    auto devices = std::atomic_load(&_devicePriorities);
+    if (_schedulingPolicy == SchedulingPolicy::Latency && preferred_device.empty() && !devices->empty())
+        preferred_device = SelectDeviceByLatency(*devices, deadline);
+    bool isPreferredDeviceListed = false;
+    for (auto&& device : *devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        WorkerInferRequest* workerRequestPtr = nullptr;
-        NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            _thisWorkerInferRequest = workerRequestPtr;
-            {
-                auto capturedTask = std::move(inferPipelineTask);
-                capturedTask();
-            }
-            idleGuard.Release();
+        isPreferredDeviceListed = true;
+        if (RunOnIdleWorkerInferRequest(inferPipelineTask, device.deviceName))
             return;
-        }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
-        _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    if (!preferred_device.empty()) {
+        auto& statistics = *_deviceStatistics.at(preferred_device);
+        ++statistics._queuedTasks;
+        _inferPipelineTasksDeviceSpecific.at(preferred_device)->push(std::move(inferPipelineTask));
+        // a request of the device might become idle after the check above and miss the task just queued,
+        // so the queue is re-checked to not leave the task waiting for the next completion
+        Task t;
+        if (isPreferredDeviceListed && statistics._busyRequests < statistics._numRequests &&
+            PopDeviceSpecificTask(t, preferred_device))
+            ScheduleToWorkerInferRequest(std::move(t), preferred_device);
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
-    ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
+    ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName, _requestDeadline);
+}
+
+void MultiDeviceExecutableNetwork::runScheduled(Task inferPipelineTask, const TaskScheduling& scheduling) {
+    ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName, TimeToDeadline(scheduling));
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
-    {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
-    }
+    std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>());
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` worker infer requests' threads.
      *       But AsyncInferRequest destructor should wait for all asynchronous tasks by the request
      */
@@ -156,13 +255,10 @@ MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
 }
 
 RemoteContext::Ptr MultiDeviceExecutableNetwork::GetContext() const {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    auto devices = std::atomic_load(&_devicePriorities);
 
     std::string devices_names;
-    for (auto&& device : devices) {
+    for (auto&& device : *devices) {
         devices_names += device.deviceName + " ";
         const auto& n  = _networksPerDevice.at(device.deviceName);
         try {
@@ -226,7 +322,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(metaDevices));
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -267,11 +363,20 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_REQUESTS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                                MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_REQUESTS)) {
+        std::map<std::string, uint64_t> requests;
+        for (auto&& statistics : _deviceStatistics) {
+            requests[statistics.first] = statistics.second->_completedRequests.load();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_REQUESTS, requests);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
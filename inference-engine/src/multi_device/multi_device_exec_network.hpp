@@ -6,6 +6,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -102,8 +105,32 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
+    using DevicePriorities = std::shared_ptr<const std::vector<DeviceInformation>>;
+    enum class SchedulingPolicy {
+        Priority,
+        Latency
+    };
+    /**
+     * @brief Load statistics of a device, updated lock-free by the scheduling and completion paths
+     */
+    struct DeviceStatistics {
+        explicit DeviceStatistics(int numRequests) : _numRequests{numRequests} {}
+        void UpdateServiceTime(std::chrono::microseconds elapsed);
+        std::chrono::microseconds ExpectedCompletionTime() const;
+
+        // exponentially weighted moving average of the request service time in microseconds, 0 if not measured yet
+        std::atomic<std::uint64_t>  _serviceTime = {0};
+        // number of worker requests claimed by the scheduler and not returned to the idle list yet
+        std::atomic_int             _busyRequests = {0};
+        // number of tasks waiting in the device-specific queue
+        std::atomic_int             _queuedTasks = {0};
+        // number of worker requests completed by the device
+        std::atomic<std::uint64_t>  _completedRequests = {0};
+        const int                   _numRequests;
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
@@ -114,13 +141,21 @@ public:
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
     void run(InferenceEngine::Task inferTask) override;
+    void runScheduled(InferenceEngine::Task inferTask, const InferenceEngine::TaskScheduling& scheduling) override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                                                        InferenceEngine::OutputsDataMap networkOutputs) override;
     InferenceEngine::RemoteContext::Ptr GetContext() const override;
     ~MultiDeviceExecutableNetwork() override;
 
-    void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "",
+                                      std::chrono::microseconds deadline = std::chrono::microseconds::zero());
+    bool RunOnIdleWorkerInferRequest(InferenceEngine::Task& inferPipelineTask, const DeviceName& device);
+    bool PopDeviceSpecificTask(InferenceEngine::Task& inferPipelineTask, const DeviceName& device);
+    // zero deadline means the earliest expected completion is the only criterion
+    DeviceName SelectDeviceByLatency(const std::vector<DeviceInformation>& devices, std::chrono::microseconds deadline) const;
+    // time left to the deadline of the request set by InferRequest::SetPriority, or the network deadline if it is not set
+    std::chrono::microseconds TimeToDeadline(const InferenceEngine::TaskScheduling& scheduling) const;
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -128,13 +163,17 @@ public:
     // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=81880
     static thread_local const char*                             _thisPreferredDeviceName;
     mutable std::mutex                                          _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    // the snapshot is replaced as a whole with std::atomic_store, so schedulers read it without locking
+    DevicePriorities                                            _devicePriorities;
     const std::vector<DeviceInformation>                        _devicePrioritiesInitial;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::Priority;
+    std::chrono::microseconds                                   _requestDeadline = std::chrono::microseconds::zero();
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
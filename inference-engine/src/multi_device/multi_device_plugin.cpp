@@ -3,6 +3,11 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <memory>
@@ -104,6 +109,12 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(name);
+        return { it == _config.end() ? std::string{MultiDeviceConfigParams::MULTI_PRIORITY} : it->second };
+    } else if (name == MULTI_CONFIG_KEY(REQUEST_DEADLINE)) {
+        auto it = _config.find(name);
+        return { it == _config.end() ? std::string{"0"} : it->second };
     } else {
         IE_THROW() << "Unsupported config key: " << name;
     }
@@ -135,7 +146,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
         IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
-            MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES};
+            MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+            MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported metric key " << name;
@@ -164,6 +177,35 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
 
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    std::string policyValue = MultiDeviceConfigParams::MULTI_PRIORITY;
+    if (policy != fullConfig.end()) {
+        if (policy->second != MultiDeviceConfigParams::MULTI_PRIORITY &&
+            policy->second != MultiDeviceConfigParams::MULTI_LATENCY) {
+            IE_THROW() << "Unsupported value " << policy->second << " for KEY_MULTI_SCHEDULING_POLICY";
+        }
+        policyValue = policy->second;
+    }
+    multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, policyValue});
+
+    auto deadline = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE);
+    std::string deadlineValue = "0";
+    if (deadline != fullConfig.end()) {
+        bool isValid = !deadline->second.empty() && std::all_of(deadline->second.begin(), deadline->second.end(),
+                                                                [] (char c) { return std::isdigit(c) != 0; });
+        try {
+            isValid = isValid && std::stoull(deadline->second) <= std::numeric_limits<std::int64_t>::max();
+        } catch (const std::out_of_range&) {
+            isValid = false;
+        }
+        if (!isValid) {
+            IE_THROW() << "Wrong value " << deadline->second
+                       << " for KEY_MULTI_REQUEST_DEADLINE, expected a number of microseconds";
+        }
+        deadlineValue = deadline->second;
+    }
+    multiNetworkConfig.insert({MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE, deadlineValue});
+
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     std::mutex load_mutex;
     std::vector<Task> loads;
@@ -11,6 +11,7 @@
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <ie_system_conf.h>
 
+#include <chrono>
 #include <exception>
 #include <future>
 #include <map>
@@ -248,11 +249,31 @@ public:
         _callback = std::move(callback);
     }
 
+    void SetInlineCallback(bool inlineCallback) override {
+        CheckState();
+        _inlineCallback = inlineCallback;
+    }
+
+    void SetPriority(InferRequest::Priority priority, std::chrono::milliseconds deadline) override {
+        CheckState();
+        _priority = priority;
+        _deadline = deadline;
+    }
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
         CheckState();
         return _syncRequest->QueryState();
     }
 
+    StateSession::Ptr CreateStateSession() override {
+        return _syncRequest->CreateStateSession();
+    }
+
+    void SetStateSessions(const std::vector<StateSession::Ptr>& sessions) override {
+        CheckState();
+        _syncRequest->SetStateSessions(sessions);
+    }
+
     void ThrowIfCanceled() const {
         std::lock_guard<std::mutex> lock{_mutex};
         if (_state == InferState::Canceled) {
@@ -289,7 +310,12 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        // public priority classes have the same values as the executor ones
+        _scheduling.priority = static_cast<TaskScheduling::Priority>(_priority);
+        _scheduling.deadline = _deadline == std::chrono::milliseconds::zero()
+                             ? std::chrono::steady_clock::time_point::max()
+                             : std::chrono::steady_clock::now() + _deadline;
+        firstStageExecutor->runScheduled(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)), _scheduling);
     }
 
     /**
@@ -353,9 +379,9 @@ private:
      * @brief Create a task with next pipeline stage.
      * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
      * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
+     * the last stage task is called or passed to callback executor if it is presented and the callback is not inline.
+     * The last stage task call the callback, if it is presented, capture the `_promise` member and use it to forward
+     * completion or exception to the one of `_futures` member
      * @param[in]  itStage Iterator to next stage of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Executor that will run final stage with callback call
@@ -375,7 +401,7 @@ private:
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->runScheduled(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)), _scheduling);
                 }
             } catch (...) {
                 currentException = std::current_exception();
@@ -405,16 +431,17 @@ private:
                     }
                 };
 
-                if (nullptr == callbackExecutor) {
+                if (nullptr == callbackExecutor || _inlineCallback) {
                     lastStageTask();
                 } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+                    callbackExecutor->runScheduled(std::move(lastStageTask), _scheduling);
                 }
             }
         }, std::move(callbackExecutor));
     }
 
     std::promise<void> _promise;
+    TaskScheduling _scheduling;  //!< Priority class and absolute deadline of the current inference
     mutable std::mutex _mutex;
     Futures _futures;
     InferState _state = InferState::Idle;
@@ -10,6 +10,7 @@
 #include <ie_input_info.hpp>
 #include <cpp/ie_infer_request.hpp>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -111,6 +112,18 @@ public:
      */
     virtual std::vector<std::shared_ptr<IVariableStateInternal>> QueryState();
 
+    /**
+     * @brief Creates a state session with default values of variables.
+     * @return A shared pointer to the created session
+     */
+    virtual StateSession::Ptr CreateStateSession();
+
+    /**
+     * @brief Binds state sessions which are used by following inferences instead of the request memory states.
+     * @param sessions - sessions to bind, the i-th session is the i-th batch sample. Empty vector unbinds sessions.
+     */
+    virtual void SetStateSessions(const std::vector<StateSession::Ptr>& sessions);
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      * @note The method returns immediately. Inference starts also immediately.
@@ -150,6 +163,19 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets whether the callback is called directly on the thread which finished inference
+     * @param inlineCallback - if `true` the callback bypasses callback executor of asynchronous request
+     */
+    virtual void SetInlineCallback(bool inlineCallback);
+
+    /**
+     * @brief Sets the priority class and the deadline used by executors to order the tasks of asynchronous request
+     * @param priority - a priority class of the request
+     * @param deadline - a time from the start of each inference until which the request should be finished, zero means no deadline
+     */
+    virtual void SetPriority(InferRequest::Priority priority, std::chrono::milliseconds deadline);
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -217,6 +243,9 @@ protected:
      */
     std::shared_ptr<IExecutableNetworkInternal> _exeNetwork;
     Callback _callback;  //!< A callback
+    bool _inlineCallback = false;  //!< Whether the callback is called on the thread which finished inference
+    InferRequest::Priority _priority = InferRequest::NORMAL;  //!< A priority class of the request
+    std::chrono::milliseconds _deadline = std::chrono::milliseconds::zero();  //!< A deadline relative to the inference start
 
     /**
      * @brief Destroys the object.
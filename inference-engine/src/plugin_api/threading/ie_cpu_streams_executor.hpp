@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -21,6 +24,8 @@ namespace InferenceEngine {
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
  *        It uses custom threads to pull tasks from single queue.
+ *        Queued tasks are picked by priority class, then by the earliest deadline, then in the order they were queued.
+ *        A task which waits longer than Config::_taskStarvationTimeout is picked before all others.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -29,6 +34,15 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Queueing delay statistics of the tasks of one priority class
+     */
+    struct QueueingDelay {
+        uint64_t                 _tasks = 0;  //!< Number of tasks taken from the queue
+        std::chrono::nanoseconds _total{0};   //!< Sum of the times the tasks waited in the queue
+        std::chrono::nanoseconds _max{0};     //!< The longest time a task waited in the queue
+    };
+
     /**
     * @brief Constructor
     * @param config Stream executor parameters
@@ -42,12 +56,20 @@ public:
 
     void run(Task task) override;
 
+    void runScheduled(Task task, const TaskScheduling& scheduling) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Returns queueing delay statistics of the tasks started by run()
+     * @return The statistics indexed by TaskScheduling::Priority
+     */
+    std::vector<QueueingDelay> GetQueueingDelays();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -20,6 +21,20 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Threads of the process wide CPU threads budget reserved by an executable network.
+ * The threads are returned to the budget when the reservation is destroyed.
+ * @ingroup ie_dev_api_threading
+ */
+struct CPUThreadsReservation {
+    using Ptr = std::shared_ptr<CPUThreadsReservation>;  //!< Pointer to the reservation
+
+    std::string _name;          //!< Name of the network which holds the reservation
+    size_t      _id = 0;        //!< Number of the reservation, unique in the process, distinguishes networks of the same name
+    int         _weight = 1;    //!< Share of the budget relative to other networks
+    int         _threads = 0;   //!< Number of threads granted to the network
+};
+
 /**
  * @cond
  */
@@ -29,6 +44,14 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    void setCPUThreadsBudget(int threads);
+
+    int getCPUThreadsBudget();
+
+    CPUThreadsReservation::Ptr reserveCPUThreads(const std::string& name, int threads, int weight);
+
+    std::vector<CPUThreadsReservation> getCPUThreadsReservations();
+
     // for tests purposes
     size_t getExecutorsNumber();
 
@@ -40,8 +63,12 @@ public:
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    std::vector<std::weak_ptr<CPUThreadsReservation>> cpuThreadsReservations;
+    int cpuThreadsBudget = 0;
+    size_t cpuThreadsReservationsNum = 0;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
+    std::mutex cpuThreadsMutex;
 };
 
 /**
@@ -83,6 +110,37 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Sets the number of threads which all executable networks of the process may use together.
+     * Affects only the networks reserving threads after the call.
+     * @param threads The number of threads, 0 disables the budget
+     */
+    void setCPUThreadsBudget(int threads);
+
+    /**
+     * @brief Returns the number of threads which all executable networks of the process may use together
+     * @return The budget, 0 if the budget is disabled
+     */
+    int getCPUThreadsBudget();
+
+    /**
+     * @brief Reserves threads of the budget for an executable network. The network gets no more than the free threads
+     * of the budget and no more than its weighted share of the budget among the networks holding reservations, so the
+     * reserved threads never exceed the budget. The threads already reserved by other networks can't be taken back, they
+     * return to the budget when those networks are released. Throws if the budget has no free threads.
+     * @param name The name of the network
+     * @param threads The number of threads the network would use without the budget
+     * @param weight The share of the budget relative to other networks
+     * @return The reservation with the granted number of threads, the threads are released together with it
+     */
+    CPUThreadsReservation::Ptr reserveCPUThreads(const std::string& name, int threads, int weight = 1);
+
+    /**
+     * @brief Returns copies of all alive reservations
+     * @return The reservations in the order they were made
+     */
+    std::vector<CPUThreadsReservation> getCPUThreadsReservations();
+
     /**
      * @cond
      */
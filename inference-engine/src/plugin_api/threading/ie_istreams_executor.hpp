@@ -93,6 +93,7 @@ public:
             BIG,
             ROUND_ROBIN // used w/multiple streams to populate the Big cores first, then the Little, then wrap around (for large #streams)
         }                  _threadPreferredCoreType = PreferredCoreType::ANY; //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        std::chrono::milliseconds _taskStarvationTimeout = std::chrono::milliseconds{100};  //!< A queued task waiting longer is run before tasks of more urgent priority classes
 
         /**
          * @brief      A constructor with arguments
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,26 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Priority class and deadline of a task. Executors with a task queue use them to pick the next task to run.
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskScheduling {
+    /**
+     * @brief Priority classes, tasks of a more urgent class are run first
+     */
+    enum Priority : int {
+        HIGH = 0,    //!< Interactive tasks
+        NORMAL = 1,  //!< Default priority class
+        LOW = 2,     //!< Background tasks
+    };
+
+    static constexpr int priorities = 3;  //!< Number of priority classes
+
+    Priority priority = NORMAL;  //!< Priority class of the task
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();  //!< No deadline by default
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +82,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context taking into account its priority and deadline.
+     *        Default implementation ignores the scheduling parameters and calls run()
+     * @param task A task to start
+     * @param scheduling Priority class and deadline of the task
+     */
+    virtual void runScheduled(Task task, const TaskScheduling& scheduling);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
@@ -0,0 +1,569 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_parser.hpp"
+#include "ie_ir_binary_itt.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <ngraph/enum_names.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/op/util/variable.hpp>
+#include <ngraph/ops.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph_ops/framework_node.hpp>
+#include <transformations/binary_ir_format.hpp>
+
+namespace InferenceEngine {
+
+namespace {
+
+namespace binary_ir = ngraph::binary_ir;
+
+/**
+ * @brief Little-endian decoder of the binary IR records, every read is checked against the end of the data
+ */
+class BinaryCursor {
+public:
+    BinaryCursor(const char* data, size_t size) : _ptr(data), _end(data + size) {}
+
+    uint8_t readU8() {
+        return static_cast<uint8_t>(*take(1));
+    }
+    uint32_t readU32() {
+        return static_cast<uint32_t>(readLE(sizeof(uint32_t)));
+    }
+    uint64_t readU64() {
+        return readLE(sizeof(uint64_t));
+    }
+    int64_t readI64() {
+        return static_cast<int64_t>(readU64());
+    }
+    float readF32() {
+        const uint32_t bits = readU32();
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    double readF64() {
+        const uint64_t bits = readU64();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    size_t readSize() {
+        return readU32();
+    }
+    std::string readString() {
+        const size_t size = readSize();
+        return std::string(take(size), size);
+    }
+    const char* take(uint64_t size) {
+        if (size > static_cast<uint64_t>(_end - _ptr))
+            IE_THROW() << "Binary IR is truncated or corrupted";
+        const char* ptr = _ptr;
+        _ptr += size;
+        return ptr;
+    }
+
+private:
+    uint64_t readLE(size_t size) {
+        const auto bytes = reinterpret_cast<const uint8_t*>(take(size));
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; i++)
+            value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        return value;
+    }
+
+    const char* _ptr;
+    const char* _end;
+};
+
+struct Attribute {
+    std::string name;
+    binary_ir::AttributeType type;
+    const char* data;
+    uint64_t size;
+};
+
+struct LayerParams {
+    struct Port {
+        ngraph::element::Type precision;
+        ngraph::PartialShape shape;
+        std::unordered_set<std::string> names;
+    };
+    std::string type;
+    std::string opset;
+    std::string name;
+    std::vector<Port> outputs;
+    std::vector<Attribute> attributes;
+    std::vector<std::pair<std::string, std::string>> rtInfo;
+};
+
+ngraph::PartialShape readPartialShape(BinaryCursor& cursor) {
+    const int64_t rank = cursor.readI64();
+    if (rank < 0)
+        return ngraph::PartialShape::dynamic();
+    std::vector<ngraph::Dimension> dims;
+    dims.reserve(rank);
+    for (int64_t i = 0; i < rank; i++) {
+        const int64_t dim = cursor.readI64();
+        dims.push_back(dim < 0 ? ngraph::Dimension::dynamic() : ngraph::Dimension(dim));
+    }
+    return ngraph::PartialShape(dims);
+}
+
+class NetworkBuilder {
+public:
+    NetworkBuilder(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& model,
+                   uint64_t constantsOffset, uint64_t constantsSize,
+                   const std::unordered_map<std::string, ngraph::OpSet>& opsets,
+                   bool useFrameworkNode)
+        : _model(model), _constants(model->get_ptr<char>() + constantsOffset), _constantsSize(constantsSize),
+          _opsets(opsets), _useFrameworkNode(useFrameworkNode) {}
+
+    std::shared_ptr<ngraph::Function> parseFunction(BinaryCursor& cursor);
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> getConstant(uint64_t offset, uint64_t size) {
+        if (offset > _constantsSize || size > _constantsSize - offset)
+            IE_THROW() << "Binary IR: constant is out of the constants section";
+        using SharedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+        return std::make_shared<SharedBuffer>(_constants + offset, size, _model);
+    }
+
+    std::shared_ptr<ngraph::Variable> getVariable(const std::string& id) {
+        auto& variable = _variables[id];
+        if (!variable) {
+            variable = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
+                ngraph::PartialShape::dynamic(), ngraph::element::dynamic, id});
+        }
+        return variable;
+    }
+
+private:
+    LayerParams parseLayerParams(BinaryCursor& cursor, const std::vector<std::shared_ptr<ngraph::Node>>& layers,
+                                 ngraph::OutputVector& inputs);
+    std::shared_ptr<ngraph::Node> createNode(const ngraph::OutputVector& inputs, const LayerParams& params);
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> _model;
+    char* _constants;
+    uint64_t _constantsSize;
+    const std::unordered_map<std::string, ngraph::OpSet>& _opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> _variables;
+    bool _useFrameworkNode;
+};
+
+/**
+ * @brief Sets attributes of a node from its attribute records, an attribute without a record keeps its default value
+ */
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(const LayerParams& params, NetworkBuilder& builder) : _params(params), _builder(builder) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::Bool))
+            adapter.set(value->readU8() != 0);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::String))
+            adapter.set(value->readString());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::Int64))
+            adapter.set(value->readI64());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::Double))
+            adapter.set(value->readF64());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::VecInt32))
+            adapter.set(readVector<int32_t>(*value, [](BinaryCursor& c) { return static_cast<int32_t>(c.readU32()); }));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::VecInt64))
+            adapter.set(readVector<int64_t>(*value, [](BinaryCursor& c) { return c.readI64(); }));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::VecUInt64))
+            adapter.set(readVector<uint64_t>(*value, [](BinaryCursor& c) { return c.readU64(); }));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::VecFloat))
+            adapter.set(readVector<float>(*value, [](BinaryCursor& c) { return c.readF32(); }));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::VecString))
+            adapter.set(readVector<std::string>(*value, [](BinaryCursor& c) { return c.readString(); }));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        if (auto value = find(name, binary_ir::AttributeType::Function))
+            adapter.set(_builder.parseFunction(*value));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override;
+
+private:
+    using InputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::InputDescription>>;
+    using OutputDescriptions = std::vector<std::shared_ptr<ngraph::op::util::SubGraphOp::OutputDescription>>;
+
+    const Attribute* findRecord(const std::string& name) const {
+        for (const auto& attribute : _params.attributes) {
+            if (attribute.name == name)
+                return &attribute;
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<BinaryCursor> find(const std::string& name, binary_ir::AttributeType type) const {
+        auto attribute = findRecord(name);
+        if (!attribute)
+            return nullptr;
+        if (attribute->type != type)
+            IE_THROW() << "Binary IR: attribute " << name << " of " << _params.type << " layer "
+                       << _params.name << " has unexpected type";
+        return std::unique_ptr<BinaryCursor>(new BinaryCursor(attribute->data, attribute->size));
+    }
+
+    template <typename T, typename Reader>
+    static std::vector<T> readVector(BinaryCursor& cursor, Reader&& read) {
+        const size_t size = cursor.readSize();
+        std::vector<T> values;
+        values.reserve(size);
+        for (size_t i = 0; i < size; i++)
+            values.push_back(read(cursor));
+        return values;
+    }
+
+    InputDescriptions readInputDescriptions(BinaryCursor& cursor) const;
+    OutputDescriptions readOutputDescriptions(BinaryCursor& cursor) const;
+
+    const LayerParams& _params;
+    NetworkBuilder& _builder;
+};
+
+BinaryDeserializer::InputDescriptions BinaryDeserializer::readInputDescriptions(BinaryCursor& cursor) const {
+    using namespace ngraph::op::util;
+    InputDescriptions inputs(cursor.readSize());
+    for (auto& input : inputs) {
+        const auto type = static_cast<binary_ir::InputDescriptionType>(cursor.readU8());
+        const uint64_t inputIndex = cursor.readU64();
+        const uint64_t bodyParameterIndex = cursor.readU64();
+        switch (type) {
+        case binary_ir::InputDescriptionType::Slice: {
+            const int64_t start = cursor.readI64();
+            const int64_t stride = cursor.readI64();
+            const int64_t partSize = cursor.readI64();
+            const int64_t end = cursor.readI64();
+            const int64_t axis = cursor.readI64();
+            input = std::make_shared<SubGraphOp::SliceInputDescription>(inputIndex, bodyParameterIndex,
+                                                                        start, stride, partSize, end, axis);
+            break;
+        }
+        case binary_ir::InputDescriptionType::Merged:
+            input = std::make_shared<SubGraphOp::MergedInputDescription>(inputIndex, bodyParameterIndex,
+                                                                         cursor.readU64());
+            break;
+        case binary_ir::InputDescriptionType::Invariant:
+            input = std::make_shared<SubGraphOp::InvariantInputDescription>(inputIndex, bodyParameterIndex);
+            break;
+        default:
+            IE_THROW() << "Binary IR: unknown input description of " << _params.name << " layer";
+        }
+    }
+    return inputs;
+}
+
+BinaryDeserializer::OutputDescriptions BinaryDeserializer::readOutputDescriptions(BinaryCursor& cursor) const {
+    using namespace ngraph::op::util;
+    OutputDescriptions outputs(cursor.readSize());
+    for (auto& output : outputs) {
+        const auto type = static_cast<binary_ir::OutputDescriptionType>(cursor.readU8());
+        const uint64_t bodyValueIndex = cursor.readU64();
+        const uint64_t outputIndex = cursor.readU64();
+        switch (type) {
+        case binary_ir::OutputDescriptionType::Concat: {
+            const int64_t start = cursor.readI64();
+            const int64_t stride = cursor.readI64();
+            const int64_t partSize = cursor.readI64();
+            const int64_t end = cursor.readI64();
+            const int64_t axis = cursor.readI64();
+            output = std::make_shared<SubGraphOp::ConcatOutputDescription>(bodyValueIndex, outputIndex,
+                                                                           start, stride, partSize, end, axis);
+            break;
+        }
+        case binary_ir::OutputDescriptionType::Body:
+            output = std::make_shared<SubGraphOp::BodyOutputDescription>(bodyValueIndex, outputIndex,
+                                                                         cursor.readI64());
+            break;
+        default:
+            IE_THROW() << "Binary IR: unknown output description of " << _params.name << " layer";
+        }
+    }
+    return outputs;
+}
+
+void BinaryDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) {
+    if (auto a = ngraph::as_type<ngraph::AttributeAdapter<InputDescriptions>>(&adapter)) {
+        if (auto value = find(name, binary_ir::AttributeType::InputDescriptions))
+            a->set(readInputDescriptions(*value));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<OutputDescriptions>>(&adapter)) {
+        if (auto value = find(name, binary_ir::AttributeType::OutputDescriptions))
+            a->set(readOutputDescriptions(*value));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+        if (auto value = find(name, binary_ir::AttributeType::SpecialBodyPorts)) {
+            ngraph::op::v5::Loop::SpecialBodyPorts ports;
+            ports.current_iteration_input_idx = value->readI64();
+            ports.body_condition_output_idx = value->readI64();
+            a->set(ports);
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+        if (auto value = find(name, binary_ir::AttributeType::Variable))
+            a->set(_builder.getVariable(value->readString()));
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+        auto attribute = findRecord(name);
+        if (!attribute)
+            return;
+        if (attribute->type == binary_ir::AttributeType::Constant) {
+            BinaryCursor value(attribute->data, attribute->size);
+            const uint64_t offset = value.readU64();
+            const uint64_t size = value.readU64();
+            a->set(_builder.getConstant(offset, size));
+        } else {
+            auto value = find(name, binary_ir::AttributeType::Bytes);
+            auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(attribute->size);
+            std::memcpy(buffer->get_ptr(), value->take(attribute->size), attribute->size);
+            a->set(buffer);
+        }
+    } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::FrameworkNodeAttrs>>(&adapter)) {
+        if (auto value = find(name, binary_ir::AttributeType::FrameworkNodeAttrs)) {
+            ngraph::op::FrameworkNodeAttrs nodeAttrs;
+            nodeAttrs.set_type_name(value->readString());
+            nodeAttrs.set_opset_name(value->readString());
+            std::map<std::string, std::string> attrs;
+            const size_t size = value->readSize();
+            for (size_t i = 0; i < size; i++) {
+                auto attrName = value->readString();
+                attrs[attrName] = value->readString();
+            }
+            nodeAttrs.set_attrs(attrs);
+            a->set(nodeAttrs);
+        }
+    } else {
+        IE_THROW() << "Error binary IR reading. Attribute adapter can not be found for " << name << " parameter";
+    }
+}
+
+LayerParams NetworkBuilder::parseLayerParams(BinaryCursor& cursor,
+                                             const std::vector<std::shared_ptr<ngraph::Node>>& layers,
+                                             ngraph::OutputVector& inputs) {
+    LayerParams params;
+    params.type = cursor.readString();
+    params.opset = cursor.readString();
+    params.name = cursor.readString();
+
+    inputs.resize(cursor.readSize());
+    for (auto& input : inputs) {
+        const size_t layer = cursor.readU32();
+        const size_t port = cursor.readSize();
+        // layers are stored in topological order, so an input always refers to an already created layer
+        if (layer >= layers.size() || port >= layers[layer]->get_output_size())
+            IE_THROW() << params.type << " layer " << params.name << " has incorrect input";
+        input = layers[layer]->output(port);
+    }
+
+    params.outputs.resize(cursor.readSize());
+    for (auto& output : params.outputs) {
+        output.precision = ngraph::as_enum<ngraph::element::Type_t>(cursor.readString());
+        output.shape = readPartialShape(cursor);
+        const size_t namesCount = cursor.readSize();
+        for (size_t i = 0; i < namesCount; i++)
+            output.names.insert(cursor.readString());
+    }
+
+    params.attributes.resize(cursor.readSize());
+    for (auto& attribute : params.attributes) {
+        attribute.name = cursor.readString();
+        attribute.type = static_cast<binary_ir::AttributeType>(cursor.readU8());
+        attribute.size = cursor.readU64();
+        attribute.data = cursor.take(attribute.size);
+    }
+
+    params.rtInfo.resize(cursor.readSize());
+    for (auto& rtInfo : params.rtInfo) {
+        rtInfo.first = cursor.readString();
+        rtInfo.second = cursor.readString();
+    }
+    return params;
+}
+
+std::shared_ptr<ngraph::Node> NetworkBuilder::createNode(const ngraph::OutputVector& inputs, const LayerParams& params) {
+    std::shared_ptr<ngraph::Node> ngraphNode;
+    auto opsetIt = _opsets.find(params.opset);
+    if (opsetIt != _opsets.end()) {
+        ngraphNode = std::shared_ptr<ngraph::Node>(opsetIt->second.create(params.type));
+        if (!ngraphNode) {
+            IE_THROW() << "Opset " << params.opset << " doesn't contain the operation with type: " << params.type;
+        }
+        // Share weights from the model buffer
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+            constant->alloc_buffer_on_visit_attributes(false);
+        }
+        ngraphNode->set_arguments(inputs);
+        BinaryDeserializer visitor(params, *this);
+        if (ngraphNode->visit_attributes(visitor)) {
+            ngraphNode->constructor_validate_and_infer_types();
+        }
+        // To be sure that all default values will be initialized:
+        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+    } else if (_useFrameworkNode) {
+        ngraphNode = std::make_shared<ngraph::op::FrameworkNode>(inputs);
+        BinaryDeserializer visitor(params, *this);
+        ngraphNode->visit_attributes(visitor);
+        for (size_t i = 0; i < params.outputs.size(); ++i) {
+            ngraphNode->set_output_type(i, params.outputs[i].precision, params.outputs[i].shape);
+        }
+    } else {
+        IE_THROW() << "Cannot create " << params.type << " layer " << params.name
+                   << " from unsupported opset: " << params.opset;
+    }
+
+    auto& rtInfo = ngraphNode->get_rt_info();
+    for (const auto& item : params.rtInfo) {
+        rtInfo[item.first] = std::make_shared<::ngraph::VariantWrapper<std::string>>(item.second);
+    }
+
+    ngraphNode->set_friendly_name(params.name);
+    for (size_t i = 0; i < params.outputs.size() && i < ngraphNode->get_output_size(); ++i) {
+        if (!params.outputs[i].names.empty())
+            ngraphNode->get_output_tensor(i).set_names(params.outputs[i].names);
+    }
+    return ngraphNode;
+}
+
+std::shared_ptr<ngraph::Function> NetworkBuilder::parseFunction(BinaryCursor& cursor) {
+    const std::string name = cursor.readString();
+
+    std::vector<std::shared_ptr<ngraph::Node>> layers(cursor.readSize());
+    std::map<std::string, std::shared_ptr<ngraph::Node>> variableIdToReadValue;
+    for (size_t i = 0; i < layers.size(); i++) {
+        ngraph::OutputVector inputs;
+        const auto params = parseLayerParams(cursor, layers, inputs);
+        layers[i] = createNode(inputs, params);
+        if (const auto& readValue = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(layers[i])) {
+            variableIdToReadValue[readValue->get_variable_id()] = readValue;
+        }
+    }
+
+    auto getLayers = [&](std::string kind) {
+        std::vector<std::shared_ptr<ngraph::Node>> nodes(cursor.readSize());
+        for (auto& node : nodes) {
+            const size_t id = cursor.readU32();
+            if (id >= layers.size())
+                IE_THROW() << "Binary IR: function " << name << " refers to unknown " << kind;
+            node = layers[id];
+        }
+        return nodes;
+    };
+
+    ngraph::ParameterVector parameters;
+    for (const auto& node : getLayers("parameter")) {
+        auto parameter = std::dynamic_pointer_cast<ngraph::op::Parameter>(node);
+        if (!parameter)
+            IE_THROW() << "Binary IR: " << node->get_friendly_name() << " layer is not a parameter";
+        parameters.push_back(parameter);
+    }
+    ngraph::ResultVector results;
+    for (const auto& node : getLayers("result")) {
+        auto result = std::dynamic_pointer_cast<ngraph::op::Result>(node);
+        if (!result)
+            IE_THROW() << "Binary IR: " << node->get_friendly_name() << " layer is not a result";
+        results.push_back(result);
+    }
+    ngraph::SinkVector sinks;
+    for (const auto& node : getLayers("sink")) {
+        auto sink = std::dynamic_pointer_cast<ngraph::op::Sink>(node);
+        if (!sink)
+            IE_THROW() << "Binary IR: " << node->get_friendly_name() << " layer is not a sink";
+        sinks.push_back(sink);
+    }
+
+    auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, name);
+    for (const auto& sink : sinks) {
+        if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
+            auto readValue = variableIdToReadValue.find(assign->get_variable_id());
+            if (readValue != variableIdToReadValue.end())
+                assign->add_control_dependency(readValue->second);
+        }
+    }
+    return function;
+}
+
+}  // namespace
+
+BinaryIRParser::BinaryIRParser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+    // Load default opsets
+    _opsets["opset1"] = ngraph::get_opset1();
+    _opsets["opset2"] = ngraph::get_opset2();
+    _opsets["opset3"] = ngraph::get_opset3();
+    _opsets["opset4"] = ngraph::get_opset4();
+    _opsets["opset5"] = ngraph::get_opset5();
+    _opsets["opset6"] = ngraph::get_opset6();
+    _opsets["opset7"] = ngraph::get_opset7();
+
+    // Load custom opsets
+    for (const auto& ext : exts) {
+        for (const auto& it : ext->getOpSets()) {
+            if (_opsets.find(it.first) != _opsets.end())
+                IE_THROW() << "Cannot add opset with name: " << it.first
+                           << ". Opset with the same name already exists.";
+            _opsets[it.first] = it.second;
+        }
+    }
+}
+
+CNNNetwork BinaryIRParser::parse(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& model) {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryReader, "BinaryIRParser::parse");
+
+    const char* data = model->get_ptr<char>();
+    BinaryCursor header(data, model->size());
+    if (std::memcmp(header.take(sizeof(binary_ir::magic)), binary_ir::magic, sizeof(binary_ir::magic)) != 0)
+        IE_THROW() << "The model is not a binary IR";
+    const uint32_t version = header.readU32();
+    if (version != binary_ir::version)
+        IE_THROW() << "Unsupported binary IR version: " << version;
+    header.readU32();  // flags are reserved
+    const uint64_t constantsOffset = header.readU64();
+    const uint64_t constantsSize = header.readU64();
+    if (constantsOffset < binary_ir::header_size || constantsOffset > model->size() ||
+        constantsSize > model->size() - constantsOffset)
+        IE_THROW() << "Binary IR is truncated or corrupted";
+
+    bool useFrameworkNode = false;
+    for (const auto& ext : _exts) {
+        const InferenceEngine::Version* extVersion = nullptr;
+        ext->GetVersion(extVersion);
+        if (extVersion && extVersion->description && strcmp(extVersion->description, "framework_node_ext") == 0) {
+            useFrameworkNode = true;
+            break;
+        }
+    }
+
+    NetworkBuilder builder(model, constantsOffset, constantsSize, _opsets, useFrameworkNode);
+    BinaryCursor graph(data + binary_ir::header_size, constantsOffset - binary_ir::header_size);
+    auto function = builder.parseFunction(graph);
+
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::BinaryReader_RT, "ConstructCNNNetwork");
+    return CNNNetwork(function, _exts);
+}
+
+}  // namespace InferenceEngine
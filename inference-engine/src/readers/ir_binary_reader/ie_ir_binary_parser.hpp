@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_iextension.h>
+
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/runtime/aligned_buffer.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Builds a network from the binary IR
+ *
+ * Constants of the network reference the model buffer, so the buffer lives as long as any of them.
+ */
+class BinaryIRParser {
+public:
+    explicit BinaryIRParser(const std::vector<IExtensionPtr>& exts);
+
+    CNNNetwork parse(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& model);
+
+private:
+    std::unordered_map<std::string, ngraph::OpSet> _opsets;
+    const std::vector<IExtensionPtr> _exts;
+};
+
+}  // namespace InferenceEngine
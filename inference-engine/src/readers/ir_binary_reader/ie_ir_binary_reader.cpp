@@ -0,0 +1,78 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_reader.hpp"
+#include "ie_ir_binary_itt.hpp"
+#include "ie_ir_binary_parser.hpp"
+#include "ie_mapped_file.hpp"
+
+#include <ie_api.h>
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/runtime/shared_buffer.hpp>
+#include <transformations/binary_ir_format.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::string readPathFromStream(std::istream& stream) {
+    if (stream.pword(0) == nullptr) {
+        return {};
+    }
+    // read saved path from extensible array
+    return std::string{static_cast<char*>(stream.pword(0))};
+}
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> loadModel(std::istream& model) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::BinaryReader_RT, "loadModel");
+
+    const auto modelPath = readPathFromStream(model);
+    if (!modelPath.empty()) {
+        auto file = std::make_shared<MappedFile>(modelPath);
+        using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<MappedFile>>;
+        return std::make_shared<MappedBuffer>(file->data(), file->size(), file);
+    }
+
+    // the model is read from memory, so copy it into a buffer aligned as the constants section
+    model.seekg(0, model.end);
+    const auto size = static_cast<size_t>(model.tellg());
+    model.seekg(0, model.beg);
+    auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(size, ngraph::binary_ir::constants_alignment);
+    model.read(buffer->get_ptr<char>(), size);
+    if (static_cast<size_t>(model.gcount()) != size)
+        IE_THROW() << "Cannot read binary IR from the stream";
+    return buffer;
+}
+
+}  // namespace
+
+bool IRBinaryReader::supportModel(std::istream& model) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryReader, "IRBinaryReader::supportModel");
+
+    std::array<char, sizeof(ngraph::binary_ir::magic)> header = {};
+    model.seekg(0, model.beg);
+    model.read(header.data(), header.size());
+    const bool supported = model.gcount() == static_cast<std::streamsize>(header.size()) &&
+                           std::memcmp(header.data(), ngraph::binary_ir::magic, header.size()) == 0;
+    model.clear();
+    model.seekg(0, model.beg);
+    return supported;
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryReader, "IRBinaryReader::read");
+
+    BinaryIRParser parser(exts);
+    return parser.parse(loadModel(model));
+}
+
+INFERENCE_PLUGIN_API(void) InferenceEngine::CreateReader(std::shared_ptr<IReader>& reader) {
+    reader = std::make_shared<IRBinaryReader>();
+}
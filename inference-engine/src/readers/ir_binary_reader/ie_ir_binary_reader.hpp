@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_reader.hpp>
+
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Reader of the binary IR produced by ngraph::pass::Serialize with Version::IR_BINARY
+ *
+ * The weights are embedded into the model file. When the model is read from a file the file is mapped to memory and
+ * Constant nodes share the mapping, otherwise the stream content is copied into an aligned buffer first.
+ */
+class IRBinaryReader: public IReader {
+public:
+    /**
+     * @brief Checks that reader supports format of the model
+     * @param model stream with model
+     * @return true if format is supported
+     */
+    bool supportModel(std::istream& model) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const std::vector<IExtensionPtr>& exts) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param weights blob with binary data
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const override {
+        IE_THROW() << "Binary IR reader cannot read model with weights, the weights are embedded into the model!";
+    }
+
+    std::vector<std::string> getDataFileExtensions() const override {
+        return {};
+    }
+};
+
+}  // namespace InferenceEngine
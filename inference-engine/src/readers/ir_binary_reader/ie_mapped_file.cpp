@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mapped_file.hpp"
+
+#include <ie_common.h>
+
+#include <cerrno>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace InferenceEngine {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        IE_THROW() << "Cannot open file " << path << " for mapping, error: " << GetLastError();
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        IE_THROW() << "Cannot map empty file " << path;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        IE_THROW() << "Cannot map file " << path << ", error: " << GetLastError();
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        IE_THROW() << "Cannot map file " << path << ", error: " << GetLastError();
+    }
+
+    _data = static_cast<char*>(data);
+    _size = static_cast<size_t>(size.QuadPart);
+    _mapping = mapping;
+}
+
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(_data);
+    CloseHandle(static_cast<HANDLE>(_mapping));
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        IE_THROW() << "Cannot open file " << path << " for mapping, errno: " << errno;
+
+    struct stat info = {};
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        IE_THROW() << "Cannot map empty file " << path;
+    }
+
+    // the mapping keeps the file referenced, so the descriptor is not needed after mmap
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        IE_THROW() << "Cannot map file " << path << ", errno: " << errno;
+
+    _data = static_cast<char*>(data);
+    _size = static_cast<size_t>(info.st_size);
+}
+
+MappedFile::~MappedFile() {
+    munmap(_data, _size);
+}
+
+#endif
+
+}  // namespace InferenceEngine
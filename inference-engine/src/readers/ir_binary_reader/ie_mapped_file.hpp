@@ -0,0 +1,42 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Read-only file mapped to memory
+ *
+ * The mapping is private: pages are loaded on the first access, and a write to the memory creates a private copy
+ * of the page instead of changing the file.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char* data() const noexcept {
+        return _data;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+private:
+    char* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void* _mapping = nullptr;
+#endif
+};
+
+}  // namespace InferenceEngine
@@ -7,8 +7,10 @@
 
 #include <algorithm>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/op/util/sub_graph_base.hpp>
 #include <ngraph/op/util/variable.hpp>
@@ -29,6 +31,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -99,8 +102,9 @@ public:
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
-        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
-        : node(node), weights(weights), opsets(opsets), variables(variables) {}
+        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables,
+        std::mutex& variables_mutex)
+        : node(node), weights(weights), opsets(opsets), variables(variables), variables_mutex(variables_mutex) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -205,17 +209,33 @@ private:
 
     V10Parser::GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    struct DecodedNode {
+        std::shared_ptr<ngraph::Node> node;
+        bool visited = false;
+    };
+
+    /// \brief Creates the operation and sets its attributes. Inputs are not needed for this, so
+    /// operations from the default opsets are decoded in parallel. Returns empty node for
+    /// operations from other opsets, they are decoded by createNode.
+    DecodedNode decodeNode(const pugi::xml_node& node, const V10Parser::GenericLayerParams& params);
+
+    /// \brief Connects the decoded operation to its inputs and infers its output types
     std::shared_ptr<ngraph::Node> createNode(
         const ngraph::OutputVector& inputs,
         const pugi::xml_node& node,
-        const Blob::CPtr& weights,
-        const V10Parser::GenericLayerParams& params);
+        const V10Parser::GenericLayerParams& params,
+        DecodedNode decoded);
+
+    using OpsetIterator = std::unordered_map<std::string, ngraph::OpSet>::const_iterator;
+    /// \brief Finds the opset to create the layer from, returns end iterator if there is no such opset
+    OpsetIterator findOpset(const V10Parser::GenericLayerParams& params) const;
 
     // -- DATA --
     const pugi::xml_node node;
     const Blob::CPtr& weights;
     const std::unordered_map<std::string, ngraph::OpSet>& opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
+    std::mutex& variables_mutex;
 
     ///
     /// store information about parameters/results order during function creation
@@ -481,6 +501,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
             &adapter)) {
         std::string variable_id;
         if (!getStrAttribute(node.child("data"), name, variable_id)) return;
+        std::lock_guard<std::mutex> lock(variables_mutex);
         if (!variables.count(variable_id)) {
             variables[variable_id] = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
                 ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
@@ -570,7 +591,7 @@ void XmlDeserializer::on_adapter(
 
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "ParseLayers");
 
     struct FunctionNodes {
         ngraph::ParameterVector parameters;
@@ -587,7 +608,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         V10Parser::GenericLayerParams params;
     };
 
-    std::map<size_t/*layer-id*/, node_params> params;
+    std::unordered_map<size_t/*layer-id*/, node_params> params;
 
     std::vector<size_t/*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
@@ -598,14 +619,14 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const auto layerId = node_param.layerId;
+        params[layerId] = {node, std::move(node_param)};
     }
 
-    std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t/*to-layer-id*/, std::vector<edge>> edges;
 
     // Read all edges and store them for further usage
     FOREACH_CHILD(_ec, root.child("edges"), "edge") {
@@ -616,27 +637,56 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "TopologicalSort");
+
+    // Run DFS starting from outputs to get nodes topological order.
+    // The stack is explicit, as long chains of layers overflow the call stack.
+    std::unordered_set<size_t> used;
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    std::vector<std::pair<size_t/*layer-id*/, size_t/*next edge*/>> stack;
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            const size_t id = stack.back().first;
+            const auto& layer_edges = edges[id];
+            if (stack.back().second < layer_edges.size()) {
+                const size_t from = layer_edges[stack.back().second++].fromLayerId;
+                if (used.insert(from).second) stack.emplace_back(from, 0);
+            } else {
+                order.push_back(id);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "DecodeNgraphNodes");
+
+    // Operations and their attributes don't depend on each other, decode them in parallel
+    std::vector<DecodedNode> decoded(order.size());
+    std::vector<std::exception_ptr> errors(order.size());
+    parallel_for(order.size(), [&](size_t i) {
+        auto found = params.find(order[i]);
+        if (found == params.end()) return;  // reported in the topological pass below
+        try {
+            decoded[i] = decodeNode(found->second.xml, found->second.params);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
 
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
-
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
-    //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
+    //  Following topological order connect nGraph operations and infer their types
+    for (size_t i = 0; i < order.size(); i++) {
+        const auto layer_id = order[i];
         auto& p = params[layer_id];
         ngraph::OutputVector inputs(edges[layer_id].size());
         for (auto& e : edges[layer_id]) {
@@ -654,7 +704,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = createNode(inputs, p.xml, p.params, std::move(decoded[i]));
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -774,25 +824,7 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
     return params;
 }
 
-std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
-    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
-    const pugi::xml_node& node,
-    const Blob::CPtr& weights,
-    const V10Parser::GenericLayerParams& params) {
-    // Check that inputs are correctly defined
-    for (size_t i = 0; i < inputs.size(); i++) {
-        if (!inputs[i].get_node())
-            IE_THROW() << params.type << " layer " << params.name
-                               << " with id: " << params.layerId
-                               << " has incorrect input with index " << i << "!";
-        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
-            IE_THROW() << params.type << " layer " << params.name
-                               << " with id: " << params.layerId
-                               << " has undefined element type for input with index " << i << "!";
-    }
-
-    std::shared_ptr<ngraph::Node> ngraphNode;
-
+XmlDeserializer::OpsetIterator XmlDeserializer::findOpset(const V10Parser::GenericLayerParams& params) const {
     // Find registered opset
     auto opsetIt = opsets.find(params.version);
 
@@ -812,35 +844,90 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         opsetIt = opsets.find("opset6");
     }
 
-    if (!ngraphNode && opsetIt != opsets.end()) {
-        auto const& type = params.type == "Const" ? "Constant" : params.type;
-
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type == "MVN" || type == "ROIPooling" || type == "ReorgYolo") {
-                opsetIt = opsets.find("opset2");
-                if (opsetIt == opsets.end()) {
-                    IE_THROW() << "Cannot create " << params.type << " layer "
-                                       << params.name << " id:" << params.layerId
-                                       << " from unsupported opset: " << params.version;
-                }
+    if (opsetIt == opsets.end())
+        return opsetIt;
+
+    if (params.version == "opset1") {
+        // MVN, ROIPooling and ReorgYolo were missing in opset1
+        if (params.type == "MVN" || params.type == "ROIPooling" || params.type == "ReorgYolo") {
+            opsetIt = opsets.find("opset2");
+            if (opsetIt == opsets.end()) {
+                IE_THROW() << "Cannot create " << params.type << " layer "
+                                   << params.name << " id:" << params.layerId
+                                   << " from unsupported opset: " << params.version;
             }
         }
+    }
+    return opsetIt;
+}
 
-        auto const& opset = opsetIt->second;
+XmlDeserializer::DecodedNode XmlDeserializer::decodeNode(
+    const pugi::xml_node& node,
+    const V10Parser::GenericLayerParams& params) {
+    // Operations from extensions are decoded sequentially, their attributes visitors
+    // are not guaranteed to be thread safe
+    static const std::unordered_set<std::string> default_opsets = {
+        "opset1", "opset2", "opset3", "opset4", "opset5", "opset6", "opset7"};
+
+    DecodedNode decoded;
+    auto opsetIt = findOpset(params);
+    if (opsetIt == opsets.end() || !default_opsets.count(opsetIt->first)) {
+        return decoded;
+    }
 
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
-        if (!ngraphNode) {
-            IE_THROW() << "Opset " << params.version
-                               << " doesn't contain the operation with type: " << type;
-        }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
+    auto const& type = params.type == "Const" ? "Constant" : params.type;
+    decoded.node = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(type));
+    if (!decoded.node) {
+        IE_THROW() << "Opset " << params.version
+                           << " doesn't contain the operation with type: " << type;
+    }
+    // Share Weights form constant blob
+    if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(decoded.node)) {
+        constant->alloc_buffer_on_visit_attributes(false);
+    }
+    XmlDeserializer visitor(node, weights, opsets, variables, variables_mutex);
+    decoded.visited = decoded.node->visit_attributes(visitor);
+    return decoded;
+}
+
+std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
+    const std::vector<ngraph::Output<ngraph::Node>>& inputs,
+    const pugi::xml_node& node,
+    const V10Parser::GenericLayerParams& params,
+    DecodedNode decoded) {
+    // Check that inputs are correctly defined
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (!inputs[i].get_node())
+            IE_THROW() << params.type << " layer " << params.name
+                               << " with id: " << params.layerId
+                               << " has incorrect input with index " << i << "!";
+        if (ngraph::element::Type_t::undefined == inputs[i].get_element_type())
+            IE_THROW() << params.type << " layer " << params.name
+                               << " with id: " << params.layerId
+                               << " has undefined element type for input with index " << i << "!";
+    }
+
+    std::shared_ptr<ngraph::Node> ngraphNode;
+
+    if (!decoded.node) {
+        // Try to create operation from opsets of extensions
+        auto opsetIt = findOpset(params);
+        if (opsetIt != opsets.end()) {
+            auto const& type = params.type == "Const" ? "Constant" : params.type;
+            decoded.node = std::shared_ptr<ngraph::Node>(opsetIt->second.create_insensitive(type));
+            if (!decoded.node) {
+                IE_THROW() << "Opset " << params.version
+                                   << " doesn't contain the operation with type: " << type;
+            }
+            XmlDeserializer visitor(node, weights, opsets, variables, variables_mutex);
+            decoded.visited = decoded.node->visit_attributes(visitor);
         }
+    }
+
+    if (decoded.node) {
+        ngraphNode = decoded.node;
         ngraphNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, opsets, variables);
-        if (ngraphNode->visit_attributes(visitor)) {
+        if (decoded.visited) {
             ngraphNode->constructor_validate_and_infer_types();
         }
 
@@ -850,7 +937,7 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
 
     if (!ngraphNode && m_use_framework_node) {
         ngraphNode = std::make_shared<ngraph::op::FrameworkNode>(inputs);
-        XmlDeserializer visitor(node, weights, opsets, variables);
+        XmlDeserializer visitor(node, weights, opsets, variables, variables_mutex);
         ngraphNode->visit_attributes(visitor);
 
         size_t index{0};
@@ -917,7 +1004,7 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 std::shared_ptr<ICNNNetwork> V10Parser::parse(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
     std::shared_ptr<ngraph::Function> function;
-    XmlDeserializer visitor(root, weights, opsets, variables);
+    XmlDeserializer visitor(root, weights, opsets, variables, variables_mutex);
     bool use_framework_node{false};
     for (const auto & ext : _exts) {
         const InferenceEngine::Version * version = nullptr;
@@ -930,9 +1017,11 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(
     visitor.use_framework_node(use_framework_node);
     visitor.on_attribute("net", function);
 
-    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::V10Reader_RT, "ConstructCNNNetwork");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser::parse", "ConstructCNNNetwork");
 
     CNNNetwork net(function, _exts);
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ParsePreProcess");
     parsePreProcess(net, root, weights);
 
     return net;
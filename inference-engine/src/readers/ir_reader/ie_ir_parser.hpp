@@ -22,6 +22,7 @@
 #include <cctype>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -89,6 +90,7 @@ private:
 
     std::unordered_map<std::string, ngraph::OpSet> opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+    std::mutex variables_mutex;
     const std::vector<IExtensionPtr> _exts;
 };
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines layout of the binary IR file
+ * @file binary_ir_format.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ngraph {
+namespace binary_ir {
+
+/**
+ * @brief The binary IR is a single little-endian file:
+ *
+ *  header:    magic[8], uint32 version, uint32 flags, uint64 constants offset, uint64 constants size
+ *  graph:     function record of the network, written right after the header
+ *  constants: data of all Constant nodes, starts at an aligned offset, every constant is aligned as well
+ *
+ * The constants section is never parsed, a reader maps the file and Constant nodes reference the mapping directly.
+ *
+ * Function record: name, layers, then indices of parameters, results and sinks in the layers list.
+ * Layer record: type, opset, name, inputs as (layer index, output index), outputs as (element type, shape, tensor
+ * names), attribute records and runtime info strings. Layers are stored in topological order, so inputs of a layer
+ * always refer to the previous ones.
+ *
+ * Attribute record: name, AttributeType, uint64 size of the value and the value, so a reader can index attributes
+ * without decoding them. Strings are uint32 length and bytes, vectors are uint32 size and elements, element types are
+ * stored as their names, dynamic rank and dimensions are stored as -1.
+ */
+constexpr char magic[8] = {'O', 'V', 'B', 'I', 'N', 'I', 'R', '\0'};
+constexpr uint32_t version = 1;
+constexpr size_t header_size = 32;
+constexpr size_t constants_alignment = 64;
+
+enum class AttributeType : uint8_t {
+    Bool,
+    String,
+    Int64,
+    Double,
+    VecInt32,
+    VecInt64,
+    VecUInt64,
+    VecFloat,
+    VecString,
+    Function,           // nested function record
+    Constant,           // uint64 offset in the constants section, uint64 size
+    Bytes,              // the data inline
+    Variable,           // variable id
+    InputDescriptions,
+    OutputDescriptions,
+    SpecialBodyPorts,
+    FrameworkNodeAttrs
+};
+
+enum class InputDescriptionType : uint8_t {
+    Slice,
+    Merged,
+    Invariant
+};
+
+enum class OutputDescriptionType : uint8_t {
+    Concat,
+    Body
+};
+
+}  // namespace binary_ir
+}  // namespace ngraph
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/node.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API MarkWeightsDecompression;
+
+}  // namespace pass
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief mark_as_weights_decompression marks the node which produces decompressed weights
+ * so that plugins can consume the compressed Constant directly
+ * @param[in] node The node to be marked
+ */
+TRANSFORMATIONS_API void mark_as_weights_decompression(const std::shared_ptr<Node>& node);
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief is_weights_decompression checks whether the node is the last node of a weights decompression subgraph
+ * @param[in] node The node to be checked
+ */
+TRANSFORMATIONS_API bool is_weights_decompression(const std::shared_ptr<const Node>& node);
+
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MarkWeightsDecompression transformation finds weights decompression subgraphs on the MatMul weights input:
+ *
+ *      Constant (u8/i8/u4/i4) -> Convert (to fp) -> [Subtract (zero point)] -> Multiply (scale) -> [Reshape] -> MatMul
+ *
+ * and keeps them from being folded: Convert is marked with DISABLED_CONSTANT_FOLDING and the last node of the subgraph
+ * is marked as weights decompression. The weights stay compressed until the plugin decides how to execute them.
+ * Subgraphs are skipped when transformation callback returns true for the MatMul node.
+ */
+class ngraph::pass::MarkWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    MarkWeightsDecompression();
+};
@@ -26,10 +26,13 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - Version::IR_BINARY writes the whole network with weights to a single binary
+ * file (see binary_ir_format.hpp) to the xml stream or path, the bin stream or
+ * path is not used
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
-    enum class Version { IR_V10 };
+    enum class Version { IR_V10, IR_BINARY };
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
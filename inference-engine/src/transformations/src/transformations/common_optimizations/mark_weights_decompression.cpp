@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+#include "transformations/common_optimizations/mark_weights_decompression.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/variant.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::MarkWeightsDecompression, "MarkWeightsDecompression", 0);
+
+namespace {
+const char weights_decompression_key[] = "WEIGHTS_DECOMPRESSION";
+
+bool is_compressed_precision(const ngraph::element::Type& type) {
+    return type == ngraph::element::u8 || type == ngraph::element::i8 ||
+           type == ngraph::element::u4 || type == ngraph::element::i4;
+}
+
+bool is_constant_or_converted_constant(const std::shared_ptr<ngraph::Node>& node) {
+    auto constant = ngraph::as_type_ptr<ngraph::opset6::Constant>(node);
+    if (constant)
+        return true;
+    // zero point can be stored in the compressed precision as well
+    auto convert = ngraph::as_type_ptr<ngraph::opset6::Convert>(node);
+    return convert && ngraph::is_type<ngraph::opset6::Constant>(convert->get_input_node_shared_ptr(0));
+}
+}  // namespace
+
+void ngraph::mark_as_weights_decompression(const std::shared_ptr<Node>& node) {
+    node->get_rt_info()[weights_decompression_key] = std::make_shared<VariantWrapper<std::string>>("");
+}
+
+bool ngraph::is_weights_decompression(const std::shared_ptr<const Node>& node) {
+    return node->get_rt_info().count(weights_decompression_key) != 0;
+}
+
+ngraph::pass::MarkWeightsDecompression::MarkWeightsDecompression() {
+    MATCHER_SCOPE(MarkWeightsDecompression);
+    auto matmul = ngraph::pattern::wrap_type<opset6::MatMul>({pattern::any_input(), pattern::any_input()});
+
+    ngraph::matcher_pass_callback callback = [=](pattern::Matcher& m) {
+        auto matmul_node = m.get_match_root();
+        if (transformation_callback(matmul_node)) {
+            return false;
+        }
+
+        auto weights_node = matmul_node->get_input_node_shared_ptr(1);
+        if (is_weights_decompression(weights_node)) {
+            return false;
+        }
+
+        // walk from MatMul weights input up to the compressed Constant
+        auto current = weights_node;
+        while (is_type<opset6::Reshape>(current)) {
+            if (!is_type<opset6::Constant>(current->get_input_node_shared_ptr(1)) || current->get_output_target_inputs(0).size() != 1)
+                return false;
+            current = current->get_input_node_shared_ptr(0);
+        }
+
+        auto multiply = as_type_ptr<opset6::Multiply>(current);
+        if (!multiply || multiply->get_output_target_inputs(0).size() != 1 ||
+            !is_type<opset6::Constant>(multiply->get_input_node_shared_ptr(1)))
+            return false;
+
+        std::shared_ptr<Node> subtract = as_type_ptr<opset6::Subtract>(multiply->get_input_node_shared_ptr(0));
+        if (subtract && (subtract->get_output_target_inputs(0).size() != 1 ||
+                         !is_constant_or_converted_constant(subtract->get_input_node_shared_ptr(1))))
+            return false;
+
+        auto convert = as_type_ptr<opset6::Convert>(subtract ? subtract->get_input_node_shared_ptr(0)
+                                                             : multiply->get_input_node_shared_ptr(0));
+        if (!convert || convert->get_output_target_inputs(0).size() != 1)
+            return false;
+
+        auto weights = as_type_ptr<opset6::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!weights || !is_compressed_precision(weights->get_element_type()) || !convert->get_element_type().is_real())
+            return false;
+
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        if (subtract)
+            mark_as_weights_decompression(subtract);
+        mark_as_weights_decompression(multiply);
+        if (weights_node != multiply)
+            mark_as_weights_decompression(weights_node);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, matcher_name);
+    register_matcher(m, callback);
+}
@@ -3,10 +3,17 @@
 //
 
 #include "itt.hpp"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -16,6 +23,7 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "ngraph_ops/framework_node.hpp"
 #include "pugixml.hpp"
+#include "transformations/binary_ir_format.hpp"
 #include "transformations/serialize.hpp"
 
 using namespace ngraph;
@@ -59,60 +67,218 @@ std::string translate_type_name(const std::string& name) {
     return name;
 }
 
-size_t hash_combine(const void* v, int64_t size) {
-    constexpr auto cel_size = sizeof(size_t);
-    size_t seed = static_cast<size_t>(size);
-    const auto data = static_cast<const size_t*>(v);
-    const auto d_end = std::next(data, size / cel_size);
-    // The constant value used as a magic number has been
-    // traditionally used e.g. in boost library's hash_combine.
-    // It happens to be derived from the golden ratio.
-    for (auto d = data; d != d_end; ++d) {
-        seed ^= *d + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    size_t last_bytes{0};
-    std::memcpy(&last_bytes, d_end, size % cel_size);
-    seed ^= last_bytes + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    return seed;
+// xxHash64 algorithm: four independent lanes over 32-byte stripes, so every input bit
+// affects the whole result. It is used only to select candidates for byte comparison.
+uint64_t hash_constant(const char* data, size_t size) {
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+    constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+    auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    auto round = [&](uint64_t acc, uint64_t input) { return rotl(acc + input * prime2, 31) * prime1; };
+    auto merge = [&](uint64_t acc, uint64_t lane) { return (acc ^ round(0, lane)) * prime1 + prime4; };
+    auto read_u64 = [](const char* p) { uint64_t v; std::memcpy(&v, p, sizeof(v)); return v; };
+
+    const char* p = data;
+    const char* const end = data + size;
+    uint64_t hash;
+    if (size >= 32) {
+        uint64_t v1 = prime1 + prime2, v2 = prime2, v3 = 0, v4 = 0 - prime1;
+        for (; end - p >= 32; p += 32) {
+            v1 = round(v1, read_u64(p));
+            v2 = round(v2, read_u64(p + 8));
+            v3 = round(v3, read_u64(p + 16));
+            v4 = round(v4, read_u64(p + 24));
+        }
+        hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        hash = merge(merge(merge(merge(hash, v1), v2), v3), v4);
+    } else {
+        hash = prime5;
+    }
+    hash += size;
+    for (; end - p >= 8; p += 8)
+        hash = rotl(hash ^ round(0, read_u64(p)), 27) * prime1 + prime4;
+    if (end - p >= 4) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        hash = rotl(hash ^ (v * prime1), 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p)
+        hash = rotl(hash ^ (static_cast<uint8_t>(*p) * prime5), 11) * prime1;
+    hash ^= hash >> 33;
+    hash *= prime2;
+    hash ^= hash >> 29;
+    hash *= prime3;
+    hash ^= hash >> 32;
+    return hash;
 }
 
+using ConstantData = std::pair<const char*, size_t>;
+
+// Gets the same buffers which are passed to the serializer from Constant nodes
+class ConstantCollector : public ngraph::AttributeVisitor {
+public:
+    explicit ConstantCollector(std::vector<ConstantData>& constants) : m_constants(constants) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            if (name == "value" && a->get())
+                m_constants.emplace_back(static_cast<const char*>(a->get()->get_ptr()), a->get()->size());
+        }
+    }
+
+private:
+    std::vector<ConstantData>& m_constants;
+};
+
+void collect_constants(const ngraph::Function& f, std::vector<ConstantData>& constants) {
+    for (const auto& node : f.get_ordered_ops()) {
+        if (ngraph::is_type<ngraph::op::v0::Constant>(node)) {
+            ConstantCollector collector(constants);
+            node->visit_attributes(collector);
+        } else if (const auto& sub_graph = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp>(node)) {
+            if (sub_graph->get_function())
+                collect_constants(*sub_graph->get_function(), constants);
+        }
+    }
+}
+
+// Finds constants with the same content. Hashes of the constants known in advance are computed
+// in parallel, equal hashes are always confirmed by byte comparison.
+class ConstantDeduplicator {
+public:
+    using Position = uint64_t;
+
+    void prepare(const ngraph::Function& f) {
+        std::vector<ConstantData> constants;
+        collect_constants(f, constants);
+        std::sort(constants.begin(), constants.end(), [](const ConstantData& a, const ConstantData& b) {
+            return a.second > b.second;
+        });
+        constants.erase(std::unique(constants.begin(), constants.end()), constants.end());
+
+        std::vector<uint64_t> hashes(constants.size());
+        const size_t total_size = std::accumulate(constants.begin(), constants.end(), size_t{0},
+            [](size_t sum, const ConstantData& c) { return sum + c.second; });
+        // thread start-up costs more than hashing of small models
+        constexpr size_t min_size_per_thread = 4 * 1024 * 1024;
+        const size_t threads_num = std::min<size_t>({std::max(1u, std::thread::hardware_concurrency()),
+                                                     constants.size(), total_size / min_size_per_thread});
+        std::atomic<size_t> next{0};
+        auto hash_constants = [&] {
+            // the largest constants go first, so threads finish at about the same time
+            for (size_t i = next++; i < constants.size(); i = next++)
+                hashes[i] = hash_constant(constants[i].first, constants[i].second);
+        };
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < threads_num; i++)
+            threads.emplace_back(hash_constants);
+        hash_constants();
+        for (auto& thread : threads)
+            thread.join();
+
+        for (size_t i = 0; i < constants.size(); i++)
+            m_precomputed_hashes.insert({constants[i], hashes[i]});
+    }
+
+    uint64_t hash(const char* ptr, size_t size) const {
+        const auto found = m_precomputed_hashes.find({ptr, size});
+        return found != m_precomputed_hashes.end() ? found->second : hash_constant(ptr, size);
+    }
+
+    bool find(const char* ptr, size_t size, uint64_t hash, Position& position) const {
+        const auto candidates = m_hash_to_constants.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second; ++it) {
+            const auto& candidate = it->second;
+            if (candidate.size == size && (candidate.ptr == ptr || std::memcmp(candidate.ptr, ptr, size) == 0)) {
+                position = candidate.position;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void insert(const char* ptr, size_t size, uint64_t hash, Position position) {
+        m_hash_to_constants.insert({hash, {ptr, size, position}});
+    }
+
+private:
+    struct ConstantDataHash {
+        size_t operator()(const ConstantData& c) const {
+            return std::hash<const char*>()(c.first) ^ std::hash<size_t>()(c.second);
+        }
+    };
+    struct Entry {
+        const char* ptr;
+        size_t size;
+        Position position;
+    };
+    std::unordered_map<ConstantData, uint64_t, ConstantDataHash> m_precomputed_hashes;
+    std::unordered_multimap<uint64_t, Entry> m_hash_to_constants;
+};
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
-    using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, FilePosition>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
         : m_binary_output(bin_data)
-        , m_enable_compression(enable_compression) {
+        , m_enable_compression(enable_compression)
+        , m_offset(std::max<FilePosition>(0, static_cast<FilePosition>(bin_data.tellp()))) {
+        m_buffer.reserve(buffer_size);
+    }
+
+    void prepare(const ngraph::Function& f) {
+        if (m_enable_compression)
+            m_constants.prepare(f);
     }
 
     FilePosition write(const char* ptr, size_t size) {
-        const auto offset = m_binary_output.tellp();
-        if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
-        }
-        // The biggest supported models have at maximum 1-2 thousand constant nodes,
-        // with 64 bit hash that gives a probability around 1 in 10 trillion that a
-        // hash collision will appear. Because of this, a choice has been made to
-        // not perform collision detection and keep the hashing quick and seamless.
-        const HashValue hash = hash_combine(ptr, size);
-        const auto found = m_hash_to_file_positions.find(hash);
-        if (found != end(m_hash_to_file_positions)) {
-            return found->second;
-        }
+        if (!m_enable_compression)
+            return append(ptr, size);
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, offset});
+        const auto hash = m_constants.hash(ptr, size);
+        ConstantDeduplicator::Position position;
+        if (m_constants.find(ptr, size, hash, position))
+            return static_cast<FilePosition>(position);
 
+        const auto offset = append(ptr, size);
+        m_constants.insert(ptr, size, hash, static_cast<ConstantDeduplicator::Position>(offset));
         return offset;
     }
 
+    // Writes out the buffered constants
+    void flush() {
+        if (!m_buffer.empty()) {
+            m_binary_output.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
 private:
-    ConstWritePositions m_hash_to_file_positions;
+    // Small constants are gathered to large sequential writes, large ones are written directly
+    static constexpr size_t buffer_size = 4 * 1024 * 1024;
+
+    FilePosition append(const char* ptr, size_t size) {
+        const auto offset = m_offset;
+        if (m_buffer.size() + size > buffer_size)
+            flush();
+        if (size >= buffer_size) {
+            m_binary_output.write(ptr, size);
+        } else {
+            m_buffer.insert(m_buffer.end(), ptr, ptr + size);
+        }
+        m_offset += size;
+        return offset;
+    }
+
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    FilePosition m_offset;
+    std::vector<char> m_buffer;
+    ConstantDeduplicator m_constants;
 };
 
 void ngfunction_2_irv10(pugi::xml_node& node,
@@ -662,18 +828,16 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
-void ngfunction_2_irv10(pugi::xml_node& netXml,
-                        const ngraph::Function& f,
-                        const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                        ConstantWriter& constant_node_write_handler) {
+// Builds <layer> nodes one by one: append_layer provides a node for the next layer and
+// layer_done receives the complete one, so the caller decides whether to keep it in a document.
+void layers_2_irv10(const ngraph::Function& f,
+                    const std::unordered_map<ngraph::Node*, int>& layer_ids,
+                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                    ConstantWriter& constant_node_write_handler,
+                    const std::function<pugi::xml_node()>& append_layer,
+                    const std::function<void(pugi::xml_node&)>& layer_done) {
     const bool exec_graph = is_exec_graph(f);
 
-    netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
-    netXml.append_attribute("version").set_value("10");
-    pugi::xml_node layers = netXml.append_child("layers");
-
-    const std::unordered_map<ngraph::Node*, int> layer_ids =
-        create_layer_ids(f);
     std::unordered_set<std::string> unique_names;
 
     bool has_dynamic_shapes = resolve_dynamic_shapes(f);
@@ -683,7 +847,7 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
 
         NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
         // <layers>
-        pugi::xml_node layer = layers.append_child("layer");
+        pugi::xml_node layer = append_layer();
         layer.append_attribute("id").set_value(layer_ids.find(node)->second);
         layer.append_attribute("name").set_value(
             get_node_unique_name(unique_names, node).c_str());
@@ -775,28 +939,540 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
                 layer.insert_move_after(output, layer.first_child());
             }
         }
+        layer_done(layer);
     }
+    // move back dynamic shapes
+    if (has_dynamic_shapes) {
+        f.validate_nodes_and_infer_types();
+    }
+}
+
+std::vector<Edge> create_serialized_edges(const std::unordered_map<ngraph::Node*, int>& layer_ids,
+                                          const ngraph::Function& f) {
+    std::vector<Edge> edges = create_edge_mapping(layer_ids, f);
+    const auto ordered_ops = f.get_ordered_ops();
+    // WA for LSTMCellv0, peephole input shall not be serialized
+    edges.erase(std::remove_if(edges.begin(), edges.end(), [&](const Edge& e) {
+        if (e.to_port != 6)
+            return false;
+        const auto& type_info = ordered_ops[e.to_layer]->get_type_info();
+        return !strcmp(type_info.name, "LSTMCell") && type_info.version == 0;
+    }), edges.end());
+    return edges;
+}
+
+void ngfunction_2_irv10(pugi::xml_node& netXml,
+                        const ngraph::Function& f,
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                        ConstantWriter& constant_node_write_handler) {
+    netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
+    netXml.append_attribute("version").set_value("10");
+    pugi::xml_node layers = netXml.append_child("layers");
+
+    const std::unordered_map<ngraph::Node*, int> layer_ids =
+        create_layer_ids(f);
+    layers_2_irv10(f, layer_ids, custom_opsets, constant_node_write_handler,
+                   [&] { return layers.append_child("layer"); },
+                   [](pugi::xml_node&) {});
+
     // <edges>
-    const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
     pugi::xml_node edges = netXml.append_child("edges");
-    for (auto e : edge_mapping) {
-        // WA for LSTMCellv0, peephole input shall not be serialized
-        if (e.to_port == 6) {
-            auto type_info = f.get_ordered_ops()[e.to_layer]->get_type_info();
-            if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
-                continue;
-            }
-        }
+    for (const auto& e : create_serialized_edges(layer_ids, f)) {
         pugi::xml_node edge = edges.append_child("edge");
         edge.append_attribute("from-layer").set_value(e.from_layer);
         edge.append_attribute("from-port").set_value(e.from_port);
         edge.append_attribute("to-layer").set_value(e.to_layer);
         edge.append_attribute("to-port").set_value(e.to_port);
     }
-    // move back dynamic shapes
-    if (has_dynamic_shapes) {
-        f.validate_nodes_and_infer_types();
+}
+
+// Escapes an attribute value the same way pugixml does
+std::string escape_xml_attribute(const std::string& value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+        case '&': result += "&amp;"; break;
+        case '<': result += "&lt;"; break;
+        case '>': result += "&gt;"; break;
+        case '"': result += "&quot;"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 32 && c != '\t') {
+                result += "&#";
+                result += static_cast<char>('0' + c / 10);
+                result += static_cast<char>('0' + c % 10);
+                result += ';';
+            } else {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+// Writes the same document as ngfunction_2_irv10 does with pugixml formatting, but only
+// one layer is kept in memory: every layer is printed to the stream as soon as it is built.
+void ngfunction_2_irv10(std::ostream& xml,
+                        const ngraph::Function& f,
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                        ConstantWriter& constant_node_write_handler) {
+    xml << "<?xml version=\"1.0\"?>\n";
+    xml << "<net name=\"" << escape_xml_attribute(f.get_friendly_name()) << "\" version=\"10\">\n";
+    xml << "\t<layers>\n";
+
+    const std::unordered_map<ngraph::Node*, int> layer_ids =
+        create_layer_ids(f);
+    pugi::xml_document layer_doc;
+    layers_2_irv10(f, layer_ids, custom_opsets, constant_node_write_handler,
+                   [&] {
+                       layer_doc.reset();
+                       return layer_doc.append_child("layer");
+                   },
+                   [&](pugi::xml_node& layer) {
+                       layer.print(xml, "\t", pugi::format_default, pugi::encoding_auto, 2);
+                   });
+    xml << "\t</layers>\n";
+
+    // <edges>
+    const std::vector<Edge> edges = create_serialized_edges(layer_ids, f);
+    if (edges.empty()) {
+        xml << "\t<edges />\n";
+    } else {
+        xml << "\t<edges>\n";
+        for (const auto& e : edges) {
+            xml << "\t\t<edge from-layer=\"" << e.from_layer << "\" from-port=\"" << e.from_port
+                << "\" to-layer=\"" << e.to_layer << "\" to-port=\"" << e.to_port << "\" />\n";
+        }
+        xml << "\t</edges>\n";
+    }
+    xml << "</net>\n";
+}
+
+// Little-endian encoder of the binary IR records
+class BinaryWriter {
+public:
+    void write_u8(uint8_t value) {
+        m_data.push_back(static_cast<char>(value));
+    }
+    void write_u32(uint32_t value) {
+        write_le(value, sizeof(value));
+    }
+    void write_u64(uint64_t value) {
+        write_le(value, sizeof(value));
     }
+    void write_i64(int64_t value) {
+        write_u64(static_cast<uint64_t>(value));
+    }
+    void write_f32(float value) {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write_u32(bits);
+    }
+    void write_f64(double value) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write_u64(bits);
+    }
+    void write_size(size_t size) {
+        NGRAPH_CHECK(size <= std::numeric_limits<uint32_t>::max(), "Binary IR: too many elements to serialize: ", size);
+        write_u32(static_cast<uint32_t>(size));
+    }
+    void write_string(const std::string& value) {
+        write_size(value.size());
+        m_data.insert(m_data.end(), value.begin(), value.end());
+    }
+    void write_bytes(const char* data, size_t size) {
+        m_data.insert(m_data.end(), data, data + size);
+    }
+    size_t reserve_u64() {
+        const size_t position = m_data.size();
+        write_u64(0);
+        return position;
+    }
+    void patch_u64(size_t position, uint64_t value) {
+        for (size_t i = 0; i < sizeof(value); i++) {
+            m_data[position + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        }
+    }
+    void append(const BinaryWriter& other) {
+        m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+    }
+    const std::vector<char>& get_data() const {
+        return m_data;
+    }
+
+private:
+    void write_le(uint64_t value, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            m_data.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    std::vector<char> m_data;
+};
+
+// Places constants in the constants section while the graph is encoded, the data itself
+// is copied to the file only after the graph, directly from the nodes.
+class BinaryConstantWriter {
+public:
+    void prepare(const ngraph::Function& f) {
+        m_constants.prepare(f);
+    }
+
+    uint64_t add(const char* ptr, size_t size) {
+        const auto hash = m_constants.hash(ptr, size);
+        uint64_t offset;
+        if (m_constants.find(ptr, size, hash, offset)) {
+            return offset;
+        }
+
+        offset = m_size;
+        m_chunks.push_back({ptr, size});
+        m_size = align(offset + size);
+        m_constants.insert(ptr, size, hash, offset);
+        return offset;
+    }
+
+    uint64_t size() const {
+        return m_size;
+    }
+
+    void write(std::ostream& stream) const {
+        const std::vector<char> padding(binary_ir::constants_alignment, 0);
+        for (const auto& chunk : m_chunks) {
+            stream.write(chunk.first, chunk.second);
+            stream.write(padding.data(), align(chunk.second) - chunk.second);
+        }
+    }
+
+    static uint64_t align(uint64_t offset) {
+        return (offset + binary_ir::constants_alignment - 1) / binary_ir::constants_alignment * binary_ir::constants_alignment;
+    }
+
+private:
+    ConstantDeduplicator m_constants;
+    std::vector<std::pair<const char*, size_t>> m_chunks;
+    uint64_t m_size = 0;
+};
+
+void ngfunction_2_binary_ir(BinaryWriter& writer,
+                            const ngraph::Function& f,
+                            const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                            BinaryConstantWriter& constant_write_handler);
+
+class BinarySerializer : public ngraph::AttributeVisitor {
+    BinaryWriter& m_writer;
+    const std::string& m_node_type_name;
+    const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
+    BinaryConstantWriter& m_constant_write_handler;
+    size_t m_count = 0;
+
+    // the size of the value lets a reader index attributes without decoding them
+    template <typename ValueWriter>
+    void write_attribute(const std::string& name, binary_ir::AttributeType type, ValueWriter&& write_value) {
+        m_writer.write_string(name);
+        m_writer.write_u8(static_cast<uint8_t>(type));
+        const size_t size_position = m_writer.reserve_u64();
+        write_value();
+        m_writer.patch_u64(size_position, m_writer.get_data().size() - size_position - sizeof(uint64_t));
+        m_count++;
+    }
+
+    template <typename T, typename ElementWriter>
+    void write_vector(const std::vector<T>& values, ElementWriter&& write_element) {
+        m_writer.write_size(values.size());
+        for (const auto& value : values)
+            write_element(value);
+    }
+
+    void write_input_descriptions(const std::vector<std::shared_ptr<
+                                  ngraph::op::util::SubGraphOp::InputDescription>>& input_descriptions) {
+        using namespace ngraph::op::util;
+        m_writer.write_size(input_descriptions.size());
+        for (const auto& input_description : input_descriptions) {
+            if (auto slice_input = as_type_ptr<SubGraphOp::SliceInputDescription>(input_description)) {
+                m_writer.write_u8(static_cast<uint8_t>(binary_ir::InputDescriptionType::Slice));
+                m_writer.write_u64(slice_input->m_input_index);
+                m_writer.write_u64(slice_input->m_body_parameter_index);
+                m_writer.write_i64(slice_input->m_start);
+                m_writer.write_i64(slice_input->m_stride);
+                m_writer.write_i64(slice_input->m_part_size);
+                m_writer.write_i64(slice_input->m_end);
+                m_writer.write_i64(slice_input->m_axis);
+            } else if (auto merged_input = as_type_ptr<SubGraphOp::MergedInputDescription>(input_description)) {
+                m_writer.write_u8(static_cast<uint8_t>(binary_ir::InputDescriptionType::Merged));
+                m_writer.write_u64(merged_input->m_input_index);
+                m_writer.write_u64(merged_input->m_body_parameter_index);
+                m_writer.write_u64(merged_input->m_body_value_index);
+            } else {
+                m_writer.write_u8(static_cast<uint8_t>(binary_ir::InputDescriptionType::Invariant));
+                m_writer.write_u64(input_description->m_input_index);
+                m_writer.write_u64(input_description->m_body_parameter_index);
+            }
+        }
+    }
+
+    void write_output_descriptions(const std::vector<std::shared_ptr<
+                                   ngraph::op::util::SubGraphOp::OutputDescription>>& output_descriptions) {
+        using namespace ngraph::op::util;
+        m_writer.write_size(output_descriptions.size());
+        for (const auto& output_description : output_descriptions) {
+            if (auto concat_output = as_type_ptr<SubGraphOp::ConcatOutputDescription>(output_description)) {
+                m_writer.write_u8(static_cast<uint8_t>(binary_ir::OutputDescriptionType::Concat));
+                m_writer.write_u64(concat_output->m_body_value_index);
+                m_writer.write_u64(concat_output->m_output_index);
+                m_writer.write_i64(concat_output->m_start);
+                m_writer.write_i64(concat_output->m_stride);
+                m_writer.write_i64(concat_output->m_part_size);
+                m_writer.write_i64(concat_output->m_end);
+                m_writer.write_i64(concat_output->m_axis);
+            } else if (auto body_output = as_type_ptr<SubGraphOp::BodyOutputDescription>(output_description)) {
+                m_writer.write_u8(static_cast<uint8_t>(binary_ir::OutputDescriptionType::Body));
+                m_writer.write_u64(body_output->m_body_value_index);
+                m_writer.write_u64(body_output->m_output_index);
+                m_writer.write_i64(body_output->m_iteration);
+            } else {
+                throw ngraph_error("Unsupported output description for binary IR serialization");
+            }
+        }
+    }
+
+public:
+    BinarySerializer(BinaryWriter& writer,
+                     const std::string& node_type_name,
+                     const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                     BinaryConstantWriter& constant_write_handler)
+        : m_writer(writer)
+        , m_node_type_name(node_type_name)
+        , m_custom_opsets(custom_opsets)
+        , m_constant_write_handler(constant_write_handler) {
+    }
+
+    size_t get_count() const {
+        return m_count;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        using namespace ngraph::op::util;
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            write_attribute(name, binary_ir::AttributeType::InputDescriptions, [&] {
+                write_input_descriptions(a->get());
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<
+                std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            write_attribute(name, binary_ir::AttributeType::OutputDescriptions, [&] {
+                write_output_descriptions(a->get());
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            write_attribute(name, binary_ir::AttributeType::SpecialBodyPorts, [&] {
+                m_writer.write_i64(a->get().current_iteration_input_idx);
+                m_writer.write_i64(a->get().body_condition_output_idx);
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            write_attribute(name, binary_ir::AttributeType::Variable, [&] {
+                m_writer.write_string(a->get()->get_info().variable_id);
+            });
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            const auto data = static_cast<const char *>(a->get()->get_ptr());
+            const size_t size = a->get()->size();
+            if (name == "value" && m_node_type_name == "Constant") {
+                write_attribute(name, binary_ir::AttributeType::Constant, [&] {
+                    m_writer.write_u64(m_constant_write_handler.add(data, size));
+                    m_writer.write_u64(size);
+                });
+            } else {
+                write_attribute(name, binary_ir::AttributeType::Bytes, [&] {
+                    m_writer.write_bytes(data, size);
+                });
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<op::FrameworkNodeAttrs>>(&adapter)) {
+            const auto & attrs = a->get();
+            write_attribute(name, binary_ir::AttributeType::FrameworkNodeAttrs, [&] {
+                m_writer.write_string(attrs.get_type_name());
+                m_writer.write_string(attrs.get_opset_name());
+                m_writer.write_size(attrs.get_attrs().size());
+                for (const auto & attr : attrs.get_attrs()) {
+                    m_writer.write_string(attr.first);
+                    m_writer.write_string(attr.second);
+                }
+            });
+        } else {
+            throw ngraph_error("Unsupported attribute type for serialization: " + name);
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::Bool, [&] {
+            m_writer.write_u8(adapter.get() ? 1 : 0);
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::String, [&] {
+            m_writer.write_string(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::Int64, [&] {
+            m_writer.write_i64(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::Double, [&] {
+            m_writer.write_f64(adapter.get());
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::VecInt32, [&] {
+            write_vector(adapter.get(), [&](int value) { m_writer.write_u32(static_cast<uint32_t>(value)); });
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::VecInt64, [&] {
+            write_vector(adapter.get(), [&](int64_t value) { m_writer.write_i64(value); });
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::VecUInt64, [&] {
+            write_vector(adapter.get(), [&](uint64_t value) { m_writer.write_u64(value); });
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::VecFloat, [&] {
+            write_vector(adapter.get(), [&](float value) { m_writer.write_f32(value); });
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::VecString, [&] {
+            write_vector(adapter.get(), [&](const std::string& value) { m_writer.write_string(value); });
+        });
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        write_attribute(name, binary_ir::AttributeType::Function, [&] {
+            ngfunction_2_binary_ir(m_writer, *adapter.get(), m_custom_opsets, m_constant_write_handler);
+        });
+    }
+};
+
+void write_partial_shape(BinaryWriter& writer, const ngraph::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        writer.write_i64(-1);
+        return;
+    }
+    writer.write_i64(shape.rank().get_length());
+    for (const auto& dim : shape) {
+        writer.write_i64(dim.is_dynamic() ? -1 : dim.get_length());
+    }
+}
+
+void ngfunction_2_binary_ir(BinaryWriter& writer,
+                            const ngraph::Function& f,
+                            const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                            BinaryConstantWriter& constant_write_handler) {
+    NGRAPH_CHECK(!is_exec_graph(f), "Execution graph can't be serialized to binary IR");
+
+    writer.write_string(f.get_friendly_name());
+
+    const auto ordered_ops = f.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, uint32_t> layer_ids;
+    std::unordered_set<std::string> unique_names;
+
+    writer.write_size(ordered_ops.size());
+    for (const auto& n : ordered_ops) {
+        const ngraph::Node* node = n.get();
+        const auto id = static_cast<uint32_t>(layer_ids.size());
+        layer_ids[node] = id;
+
+        const std::string node_type_name{node->get_type_name()};
+        writer.write_string(node_type_name);
+        writer.write_string(get_opset_name(node, custom_opsets));
+        writer.write_string(get_node_unique_name(unique_names, node));
+
+        writer.write_size(node->get_input_size());
+        for (const auto& i : node->inputs()) {
+            const auto source_output = i.get_source_output();
+            const auto source = layer_ids.find(source_output.get_node());
+            NGRAPH_CHECK(source != layer_ids.end(), "Internal error");
+            writer.write_u32(source->second);
+            writer.write_size(source_output.get_index());
+        }
+
+        writer.write_size(node->get_output_size());
+        for (const auto& o : node->outputs()) {
+            writer.write_string(ngraph::as_string(static_cast<ngraph::element::Type_t>(o.get_element_type())));
+            write_partial_shape(writer, o.get_partial_shape());
+            const auto& names = o.get_tensor().get_names();
+            writer.write_size(names.size());
+            for (const auto& name : names)
+                writer.write_string(name);
+        }
+
+        BinaryWriter attributes;
+        BinarySerializer visitor(attributes, node_type_name, custom_opsets, constant_write_handler);
+        NGRAPH_CHECK(const_cast<ngraph::Node*>(node)->visit_attributes(visitor),
+                     "Visitor API is not supported in ", node);
+        writer.write_size(visitor.get_count());
+        writer.append(attributes);
+
+        std::vector<std::pair<std::string, std::string>> rt_attributes;
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto& found_rt_info = node->get_rt_info().find(rt_info_name);
+            if (found_rt_info == node->get_rt_info().end())
+                continue;
+            if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found_rt_info->second))
+                rt_attributes.emplace_back(rt_info_name, v->get());
+        }
+        writer.write_size(rt_attributes.size());
+        for (const auto& rt_attribute : rt_attributes) {
+            writer.write_string(rt_attribute.first);
+            writer.write_string(rt_attribute.second);
+        }
+    }
+
+    auto write_layer_ids = [&](const std::vector<const ngraph::Node*>& nodes) {
+        writer.write_size(nodes.size());
+        for (const auto node : nodes) {
+            const auto found = layer_ids.find(node);
+            NGRAPH_CHECK(found != layer_ids.end(), "Internal error");
+            writer.write_u32(found->second);
+        }
+    };
+    std::vector<const ngraph::Node*> parameters, results, sinks;
+    for (const auto& parameter : f.get_parameters())
+        parameters.push_back(parameter.get());
+    for (const auto& result : f.get_results())
+        results.push_back(result.get());
+    for (const auto& sink : f.get_sinks())
+        sinks.push_back(sink.get());
+    write_layer_ids(parameters);
+    write_layer_ids(results);
+    write_layer_ids(sinks);
+}
+
+void serialize_binary_ir(std::ostream& model_file,
+                         const ngraph::Function& f,
+                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    BinaryWriter graph;
+    BinaryConstantWriter constant_write_handler;
+    constant_write_handler.prepare(f);
+    ngfunction_2_binary_ir(graph, f, custom_opsets, constant_write_handler);
+
+    const uint64_t graph_end = binary_ir::header_size + graph.get_data().size();
+    const uint64_t constants_offset = BinaryConstantWriter::align(graph_end);
+
+    BinaryWriter header;
+    header.write_bytes(binary_ir::magic, sizeof(binary_ir::magic));
+    header.write_u32(binary_ir::version);
+    header.write_u32(0);
+    header.write_u64(constants_offset);
+    header.write_u64(constant_write_handler.size());
+    NGRAPH_CHECK(header.get_data().size() == binary_ir::header_size, "Internal error");
+
+    const std::vector<char> padding(constants_offset - graph_end, 0);
+    model_file.write(header.get_data().data(), header.get_data().size());
+    model_file.write(graph.get_data().data(), graph.get_data().size());
+    model_file.write(padding.data(), padding.size());
+    constant_write_handler.write(model_file);
 }
 }  // namespace
 
@@ -809,18 +1485,19 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
         switch (m_version) {
         case Version::IR_V10:
             {
-                std::string name = "net";
-                pugi::xml_document xml_doc;
-                pugi::xml_node net_node = xml_doc.append_child(name.c_str());
                 ConstantWriter constant_write_handler(bin_file);
-                XmlSerializer visitor(net_node, name, m_custom_opsets, constant_write_handler);
-                visitor.on_attribute(name, f);
+                constant_write_handler.prepare(*f);
+                ngfunction_2_irv10(xml_file, *f, m_custom_opsets, constant_write_handler);
+                constant_write_handler.flush();
 
-                xml_doc.save(xml_file);
                 xml_file.flush();
                 bin_file.flush();
             }
             break;
+        case Version::IR_BINARY:
+            serialize_binary_ir(xml_file, *f, m_custom_opsets);
+            xml_file.flush();
+            break;
         default:
             NGRAPH_UNREACHABLE("Unsupported version");
             break;
@@ -829,6 +1506,12 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
 
     if (m_xmlFile && m_binFile) {
         serializeFunc(*m_xmlFile, *m_binFile);
+    } else if (m_version == Version::IR_BINARY) {
+        // binary IR is a single file, the weights are stored in it
+        std::ofstream model_file(m_xmlPath, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(model_file, "Can't open binary IR file: \"" + m_xmlPath + "\"");
+
+        serializeFunc(model_file, model_file);
     } else {
         std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
@@ -890,8 +1573,8 @@ pass::Serialize::Serialize(const std::string& xmlPath,
                            std::map<std::string, OpSet> custom_opsets)
     : m_xmlFile{nullptr}
     , m_binFile{nullptr}
-    , m_xmlPath{valid_xml_path(xmlPath)}
-    , m_binPath{provide_bin_path(xmlPath, binPath)}
+    , m_xmlPath{version == Version::IR_BINARY ? xmlPath : valid_xml_path(xmlPath)}
+    , m_binPath{version == Version::IR_BINARY ? binPath : provide_bin_path(xmlPath, binPath)}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
 {
@@ -48,6 +48,11 @@ public:
     static const CompileEnv& get();
     static const CompileEnv* getOrNull();
 
+    // The environment is thread local: worker threads of parallel sections
+    // have to attach the environment of the compiling thread.
+    // Returns the environment previously attached to the current thread.
+    static const CompileEnv* attach(const CompileEnv* env);
+
     static void init(
             Platform platform,
             const CompilationConfig& config,
@@ -11,9 +11,11 @@
 #include <limits>
 #include <algorithm>
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include <vpu/model/data_desc.hpp>
 #include <vpu/middleend/hw/tiling.hpp>
+#include <vpu/middleend/hw/utility.hpp>
 #include <vpu/compile_env.hpp>
 #include <vpu/utils/heap.hpp>
 
@@ -49,6 +51,43 @@ public:
               _paddingTop(paddingTop), _paddingBottom(paddingBottom), _withPool(withPool) {}
 };
 
+// Orders the options by the geometry of the tiling problem, the stage name is ignored
+struct ConvolutionGeometryLess final {
+    bool operator()(const ConvolutionOptions& lhs, const ConvolutionOptions& rhs) const;
+};
+
+// Finds tilers for the stages: the stages with the same geometry share one tiler, the unique problems
+// are solved in parallel. Returns the tilers in the order of the stages and the number of unique problems.
+template <class Tiler, class Solve>
+std::pair<std::vector<std::shared_ptr<const Tiler>>, std::size_t> findTilers(
+        const std::vector<ConvolutionOptions>& stagesOptions, const Solve& solve) {
+    std::map<ConvolutionOptions, std::size_t, ConvolutionGeometryLess> problemIndices;
+    std::vector<const ConvolutionOptions*> problems;
+    std::vector<std::size_t> stageProblems;
+    stageProblems.reserve(stagesOptions.size());
+
+    for (const auto& options : stagesOptions) {
+        const auto inserted = problemIndices.emplace(options, problems.size());
+        if (inserted.second) {
+            problems.push_back(&options);
+        }
+        stageProblems.push_back(inserted.first->second);
+    }
+
+    std::vector<std::shared_ptr<const Tiler>> solutions(problems.size());
+    parallelTilingSearch(static_cast<int>(problems.size()), [&](int problemInd) {
+        solutions[problemInd] = solve(*problems[problemInd]);
+    });
+
+    std::vector<std::shared_ptr<const Tiler>> tilers;
+    tilers.reserve(stageProblems.size());
+    for (const auto problemInd : stageProblems) {
+        tilers.push_back(solutions[problemInd]);
+    }
+
+    return {std::move(tilers), problems.size()};
+}
+
 struct TilingOption final {
     int numWidthTiles;
     int numHeightTiles;
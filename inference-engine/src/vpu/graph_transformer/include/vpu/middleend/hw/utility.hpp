@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 #include <ostream>
+#include <functional>
 
 #include <vpu/model/data.hpp>
 #include <vpu/backend/blob_format.hpp>
@@ -137,4 +138,12 @@ void printTo(DotLabel& lbl, const HwPaddingInfo& hwPad);
 
 int calculateHwBufferSize(const DimValues& dims, const DimsOrder& order = DimsOrder());
 
+//
+// parallelTilingSearch
+//
+
+// Runs `body` for every index in [0, count) on the worker threads with the CompileEnv of the caller attached.
+// The first exception thrown by `body` is rethrown once all the iterations are finished.
+void parallelTilingSearch(int count, const std::function<void(int)>& body);
+
 }  // namespace vpu
@@ -70,6 +70,14 @@ const CompileEnv* CompileEnv::getOrNull() {
     return g_compileEnv;
 }
 
+const CompileEnv* CompileEnv::attach(const CompileEnv* env) {
+    IE_ASSERT(env == nullptr || env->initialized);
+
+    const auto prevEnv = g_compileEnv;
+    g_compileEnv = const_cast<CompileEnv*>(env);
+    return prevEnv;
+}
+
 void CompileEnv::init(Platform platform, const CompilationConfig& config, const Logger::Ptr& log) {
     g_compileEnv = new CompileEnv(platform);
     g_compileEnv->config = config;
@@ -7,12 +7,25 @@
 #include <vector>
 #include <memory>
 #include <utility>
+#include <tuple>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+#include <vpu/middleend/hw/utility.hpp>
 
 namespace vpu {
 
 namespace HWTilingNS {
 
+bool ConvolutionGeometryLess::operator()(const ConvolutionOptions& lhs, const ConvolutionOptions& rhs) const {
+    return std::tie(lhs._inputDims, lhs._outputDims, lhs._origOutputDims,
+                    lhs._kernelSizeX, lhs._kernelSizeY, lhs._kernelStride,
+                    lhs._paddingLeft, lhs._paddingRight, lhs._paddingTop, lhs._paddingBottom,
+                    lhs._withPool) <
+           std::tie(rhs._inputDims, rhs._outputDims, rhs._origOutputDims,
+                    rhs._kernelSizeX, rhs._kernelSizeY, rhs._kernelStride,
+                    rhs._paddingLeft, rhs._paddingRight, rhs._paddingTop, rhs._paddingBottom,
+                    rhs._withPool);
+}
+
 bool operator<(const TilingOption& lhs, const TilingOption& rhs) {
     return lhs.cost < rhs.cost || (isDoubleEqual(lhs.cost, rhs.cost) && lhs.totalNumTiles < rhs.totalNumTiles);
 }
@@ -615,12 +628,13 @@ std::unique_ptr<GraphDataTiling> ConvGraphDataTilingFactory::makeDirTiling(const
 }
 
 //
-// Looks for the optimal tiling accordingly to the cost function. Modifies dimensions in dirTiling during search.
+// Looks for the optimal tiling accordingly to the cost function. Every number of channel tiles is checked
+// in parallel on its own copy of dirTiling.
 //
 std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() const {
     const auto& env = CompileEnv::get();
 
-    auto& dirTiling = *_dirTiling;
+    const auto& initialTiling = *_dirTiling;
     FixedMaxHeap<TilingOption> tilingOptions(_maxTilingOptions);
 
     // TODO: estimate this numbers
@@ -628,8 +642,8 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
     const int maxNumHeightTiles = 15;
     const int maxNumChannelTiles = _convolutionOptions._withPool ? 1 : 15;
 
-    const auto outputTileInitial = dirTiling.getOutputTileDims();
-    const auto inputTileInitial = dirTiling.getInputTileDims();
+    const auto outputTileInitial = initialTiling.getOutputTileDims();
+    const auto inputTileInitial = initialTiling.getInputTileDims();
 
     const int maxInputTileDimW = 2048;
     const int maxInputTileDimH = 2048;
@@ -642,16 +656,25 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
         minInputTileDimH *= 2;
     }
 
-    const auto& splitOver = dirTiling.splitOverTensorDims();
-    const auto direction = dirTiling.getDirection();
+    const auto& splitOver = _dirTiling->splitOverTensorDims();
+    const auto direction = initialTiling.getDirection();
     const auto cmxLimit = env.resources.tilingCMXLimit;
 
+    // valid options for every number of channel tiles in the order they are found
+    std::vector<std::vector<TilingOption>> channelTilesOptions(maxNumChannelTiles);
+
     // split over Input tensor for the Channel dimension always
-    for (int numChannelTiles = 1; numChannelTiles <= maxNumChannelTiles; numChannelTiles++) {
+    parallelTilingSearch(maxNumChannelTiles, [&](int channelTilesInd) {
+        const int numChannelTiles = channelTilesInd + 1;
         const int tileSizeDimC = divUp(_convolutionOptions._inputDims[Dim::C], numChannelTiles);
 
         if (tileSizeDimC > maxInputTileDimC)
-            continue;
+            return;
+
+        const auto dirTilingCopy = ConvGraphDataTilingFactory::makeDirTiling(initialTiling);
+        auto& dirTiling = *dirTilingCopy;
+        auto& options = channelTilesOptions[channelTilesInd];
+
         // here split and iterate either over input tensors or over output tensors depending on the direction.
         for (int numWidthTiles = 1; numWidthTiles <= maxNumWidthTiles; numWidthTiles++) {
             int tileSizeDimW = divUp(splitOver[Dim::W], numWidthTiles);
@@ -835,16 +858,20 @@ std::vector<TilingOption> HWConvolutionTilingSearcher::selectBetterTiling() cons
                 //
 
                 const int totalNumTiles = numWidthTiles * numHeightTiles * numChannelTiles;
-                tilingOptions.push({numWidthTiles, numHeightTiles, numChannelTiles, totalNumTiles, solutionCost});
+                options.push_back({numWidthTiles, numHeightTiles, numChannelTiles, totalNumTiles, solutionCost});
 
                 // Skip smaller SoC tiling.
                 break;
             }
         }
-    }
+    });
 
-    dirTiling.resetInputTileDims(inputTileInitial);
-    dirTiling.resetOutputTileDims(outputTileInitial);
+    // Keep the order of the serial search, so equal options are resolved the same way
+    for (const auto& options : channelTilesOptions) {
+        for (const auto& option : options) {
+            tilingOptions.push(option);
+        }
+    }
 
     return tilingOptions.sorted();
 }
@@ -7,11 +7,15 @@
 #include <string>
 #include <unordered_map>
 #include <algorithm>
+#include <exception>
+#include <vector>
 
 #include <ie_parallel.hpp>
 
 #include <vpu/model/stage.hpp>
+#include <vpu/compile_env.hpp>
 #include <vpu/utils/numeric.hpp>
+#include <vpu/utils/auto_scope.hpp>
 #include <vpu/utils/profiling.hpp>
 #include <vpu/middleend/allocator/structs.hpp>
 
@@ -88,4 +92,39 @@ int calculateHwBufferSize(const DimValues& dims, const DimsOrder& order) {
     return calcTotalByteSize(desc, strides);
 }
 
+//
+// parallelTilingSearch
+//
+
+void parallelTilingSearch(int count, const std::function<void(int)>& body) {
+    if (count <= 1) {
+        for (int i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    const auto& env = CompileEnv::get();
+
+    std::vector<std::exception_ptr> errors(count);
+    ie::parallel_for(count, [&](int i) {
+        const auto prevEnv = CompileEnv::attach(&env);
+        AutoScope restoreEnv([prevEnv] {
+            CompileEnv::attach(prevEnv);
+        });
+
+        try {
+            body(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 }  // namespace vpu
@@ -6,8 +6,12 @@
 
 #include <sstream>
 #include <iomanip>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
 
 #include <vpu/compile_env.hpp>
 
@@ -39,6 +43,14 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    // Passes may be added several times (dumpModel for example), so the statistics is accumulated by name
+    struct PassStatistics final {
+        double durationMs = 0.0;
+        int numRuns = 0;
+    };
+    std::map<std::string, PassStatistics> statistics;
+    double totalDurationMs = 0.0;
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -52,15 +64,39 @@ void PassSet::run(const Model& model) const {
 
         auto endTime = std::chrono::high_resolution_clock::now();
 
+        const auto durationMs = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
+
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, durationMs);
+
+        auto& passStatistics = statistics[p.second];
+        passStatistics.durationMs += durationMs;
+        ++passStatistics.numRuns;
+        totalDurationMs += durationMs;
 
         ++passInd;
     }
 
     model->cleanUp();
+
+    if (env.log->isActive(LogLevel::Info)) {
+        std::vector<std::pair<std::string, PassStatistics>> sortedStatistics(statistics.begin(), statistics.end());
+        std::stable_sort(sortedStatistics.begin(), sortedStatistics.end(),
+            [](const std::pair<std::string, PassStatistics>& lhs, const std::pair<std::string, PassStatistics>& rhs) {
+                return lhs.second.durationMs > rhs.second.durationMs;
+            });
+
+        env.log->info("MiddleEnd : %d passes, total duration : %f ms", _passes.size(), totalDurationMs);
+        VPU_LOGGER_SECTION(env.log);
+
+        for (const auto& passStatistics : sortedStatistics) {
+            env.log->info(
+                "[%s] runs : %d, duration : %f ms (%f %%)",
+                passStatistics.first, passStatistics.second.numRuns, passStatistics.second.durationMs,
+                totalDurationMs > 0.0 ? 100.0 * passStatistics.second.durationMs / totalDurationMs : 0.0);
+        }
+    }
 }
 
 //
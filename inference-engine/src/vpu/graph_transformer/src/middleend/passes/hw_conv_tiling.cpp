@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -31,9 +32,68 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::ConvolutionOptions makeConvolutionOptions(const Stage& origStage) {
+    const HWConvStageOptions stageOptions(origStage);
+    const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutputDesc.dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        stageOptions.withPool
+    };
+}
+
+//
+// Try to find "best" tiling
+//
+
+std::shared_ptr<const HWTilingNS::HWConvolutionTiler> findConvolutionTiler(
+        const HWTilingNS::ConvolutionOptions& convolutionOptions) {
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    auto tiler = std::make_shared<const HWTilingNS::HWConvolutionTiler>(convolutionOptions, direction, tilingsCount);
+
+    if (!tiler->isTilingPossible() && tiler->withPool()) {
+        const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
+            convolutionOptions._stageName,
+            convolutionOptions._inputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._origOutputDims,
+            convolutionOptions._kernelSizeX,
+            convolutionOptions._kernelSizeY,
+            convolutionOptions._kernelStride,
+            convolutionOptions._paddingLeft,
+            convolutionOptions._paddingRight,
+            convolutionOptions._paddingTop,
+            convolutionOptions._paddingBottom,
+            false
+        };
+
+        tiler = std::make_shared<const HWTilingNS::HWConvolutionTiler>(optionsWithoutPool, direction, tilingsCount);
+    }
+
+    return tiler;
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> stagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -44,61 +104,26 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
-        const HWConvStageOptions stageOptions(origStage);
-        const HWConvStageIO stageIO(origStage, origStage->output(0));
+        hwStages.push_back(origStage);
+        stagesOptions.push_back(makeConvolutionOptions(origStage));
+    }
 
-        //
-        // Unsupported paddings
-        //
+    //
+    // Repeated blocks of the network share the tiling, unique problems are solved in parallel
+    //
 
-        //
-        // Try to find "best" tiling
-        //
+    const auto tilers = HWTilingNS::findTilers<HWTilingNS::HWConvolutionTiler>(stagesOptions, findConvolutionTiler);
 
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutputDesc.dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            stageOptions.withPool
-        };
+    env.log->debug("Found tilings for %d HW convolutions, unique tiling problems : %d",
+                   hwStages.size(), tilers.second);
 
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
+
+        const auto& tiler = *tilers.first[stageInd];
 
         //
         // Use SW stage if tiling optimization failed
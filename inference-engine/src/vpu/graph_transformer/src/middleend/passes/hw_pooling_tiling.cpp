@@ -9,7 +9,9 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
+#include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
@@ -29,9 +31,47 @@ private:
     StageBuilder::Ptr _stageBuilder;
 };
 
+HWTilingNS::ConvolutionOptions makePoolingOptions(const Stage& origStage) {
+    const HWPoolStageOptions stageOptions(origStage);
+    const HWPoolStageIO stageIO(origStage, origStage->output(0));
+
+    return HWTilingNS::ConvolutionOptions{
+        origStage->name(),
+        stageIO.origInput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageIO.origOutput->desc().dims(),
+        stageOptions.kernelSizeX,
+        stageOptions.kernelSizeY,
+        stageOptions.kernelStride,
+        stageOptions.padLeft,
+        stageOptions.padRight,
+        stageOptions.padTop,
+        stageOptions.padBottom,
+        false};
+}
+
+//
+// Try to find "best" tiling
+//
+
+std::shared_ptr<const HWTilingNS::HWPoolingTiler> findPoolingTiler(
+        const HWTilingNS::ConvolutionOptions& convolutionOptions) {
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    return std::make_shared<const HWTilingNS::HWPoolingTiler>(convolutionOptions, direction, tilingsCount);
+}
+
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const auto& env = CompileEnv::get();
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> stagesOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -43,33 +83,26 @@ void PassImpl::run(const Model& model) {
             continue;
         }
 
+        hwStages.push_back(origStage);
+        stagesOptions.push_back(makePoolingOptions(origStage));
+    }
+
+    //
+    // Repeated blocks of the network share the tiling, unique problems are solved in parallel
+    //
+
+    const auto tilers = HWTilingNS::findTilers<HWTilingNS::HWPoolingTiler>(stagesOptions, findPoolingTiler);
+
+    env.log->debug("Found tilings for %d HW poolings, unique tiling problems : %d",
+                   hwStages.size(), tilers.second);
+
+    for (size_t stageInd = 0; stageInd < hwStages.size(); ++stageInd) {
+        const auto& origStage = hwStages[stageInd];
+
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
-            origStage->name(),
-            stageIO.origInput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageIO.origOutput->desc().dims(),
-            stageOptions.kernelSizeX,
-            stageOptions.kernelSizeY,
-            stageOptions.kernelStride,
-            stageOptions.padLeft,
-            stageOptions.padRight,
-            stageOptions.padTop,
-            stageOptions.padBottom,
-            false};
-
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+        const auto& tiler = *tilers.first[stageInd];
 
         if (!tiler.isTilingPossible()) {
             origStage->attrs().set<bool>("tryHW", false);
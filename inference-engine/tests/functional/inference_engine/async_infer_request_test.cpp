@@ -73,6 +73,11 @@ TEST(InferRequestCPPTests, throwsOnUninitializedSetCompletionCallback) {
     ASSERT_THROW(req.SetCompletionCallback(f), InferenceEngine::Exception);
 }
 
+TEST(InferRequestCPPTests, throwsOnUninitializedSetCompletionQueue) {
+    InferRequest req;
+    ASSERT_THROW(req.SetCompletionQueue(std::make_shared<CompletionQueue>(), nullptr), InferenceEngine::Exception);
+}
+
 IE_SUPPRESS_DEPRECATED_START
 
 TEST(InferRequestCPPTests, throwsOnUninitializedCast) {
@@ -0,0 +1,92 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <sstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "transformations/binary_ir_format.hpp"
+#include "transformations/serialize.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string, std::string> BinaryIRParams;
+
+class BinaryIRSerializationTest: public CommonTestUtils::TestsCommon,
+                                 public testing::WithParamInterface<BinaryIRParams> {
+public:
+    std::string m_model_path;
+    std::string m_binary_path;
+    std::string m_out_path;
+
+    void SetUp() override {
+        m_model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+        if (!std::get<1>(GetParam()).empty()) {
+            m_binary_path = IR_SERIALIZATION_MODELS_PATH + std::get<1>(GetParam());
+        }
+        m_out_path = GetTestName() + "_" + GetTimestamp() + ".irb";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_path.c_str());
+    }
+
+    void serialize(const InferenceEngine::CNNNetwork& network) {
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::Serialize>(m_out_path, "", ngraph::pass::Serialize::Version::IR_BINARY);
+        manager.run_passes(network.getFunction());
+    }
+};
+
+TEST_P(BinaryIRSerializationTest, CompareFunctions) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+    serialize(expected);
+    auto result = ie.ReadNetwork(m_out_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_P(BinaryIRSerializationTest, CompareFunctionsReadFromMemory) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+    serialize(expected);
+
+    std::ifstream model_file(m_out_path, std::ios::binary);
+    std::stringstream model;
+    model << model_file.rdbuf();
+    auto result = ie.ReadNetwork(model.str(), InferenceEngine::Blob::CPtr());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+INSTANTIATE_TEST_CASE_P(BinaryIRSerialization, BinaryIRSerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                        std::make_tuple("add_abc_f64.xml", ""),
+                        std::make_tuple("split_equal_parts_2d.xml", "split_equal_parts_2d.bin"),
+                        std::make_tuple("addmul_abc.xml", "addmul_abc.bin"),
+                        std::make_tuple("add_abc_initializers_u1_const.xml", "add_abc_initializers_u1_const.bin"),
+                        std::make_tuple("nms5.xml", "nms5.bin"),
+                        std::make_tuple("pad_with_shape_of.xml", ""),
+                        std::make_tuple("conv_with_rt_info.xml", ""),
+                        std::make_tuple("loop_2d_add.xml", "loop_2d_add.bin"),
+                        std::make_tuple("nms5_dynamism.xml", "nms5_dynamism.bin")));
+
+TEST(BinaryIRSerialization, RejectsCorruptedModel) {
+    InferenceEngine::Core ie;
+    std::string model(ngraph::binary_ir::magic, sizeof(ngraph::binary_ir::magic));
+    model += "broken";
+    ASSERT_THROW(ie.ReadNetwork(model, InferenceEngine::Blob::CPtr()), InferenceEngine::Exception);
+}
@@ -229,3 +229,25 @@ TEST_F(SerializatioConstantCompressionTest, IdenticalConstantsDifferentTypesI32I
 
     ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(int32_t));
 }
+
+TEST_F(SerializatioConstantCompressionTest, LargeConstantsDifferentInLastElement) {
+    constexpr int unique_const_count = 2;
+    const ngraph::Shape shape{1024, 1024, 2};
+
+    std::vector<float> values(ngraph::shape_size(shape), 1.f);
+    auto A = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    auto B = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    values.back() = 2.f;
+    auto C = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+    auto D = ngraph::op::Constant::create(ngraph::element::f32, shape, values);
+
+    auto ngraph_a = std::make_shared<ngraph::Function>(ngraph::NodeVector{A, B, C, D},
+        ngraph::ParameterVector{});
+
+    ngraph::pass::Serialize(m_out_xml_path_1, m_out_bin_path_1).run_on_function(ngraph_a);
+
+    std::ifstream xml_1(m_out_xml_path_1, std::ios::binary);
+    std::ifstream bin_1(m_out_bin_path_1, std::ios::binary);
+
+    ASSERT_TRUE(file_size(bin_1) == unique_const_count * ngraph::shape_size(shape) * sizeof(float));
+}
@@ -3,10 +3,13 @@
 //
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
 #include "gtest/gtest.h"
 #include "ie_core.hpp"
+#include "ngraph/opsets/opset6.hpp"
+#include "transformations/serialize.hpp"
 
 #ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
 #define IR_SERIALIZATION_MODELS_PATH ""
@@ -83,3 +86,24 @@ INSTANTIATE_TEST_CASE_P(ONNXSerialization, SerializationTest,
                         std::make_tuple("add_abc_initializers.prototxt", "")));
 
 #endif
+
+TEST(SerializationLongChainTest, ReadLongChainOfLayers) {
+    auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    std::shared_ptr<ngraph::Node> last = input;
+    // the chain is deeper than a recursive traversal of layers can afford
+    for (size_t i = 0; i < 50000; i++) {
+        last = std::make_shared<ngraph::opset6::Relu>(last);
+    }
+    auto expected = std::make_shared<ngraph::Function>(ngraph::NodeVector{last}, ngraph::ParameterVector{input});
+
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(expected);
+
+    InferenceEngine::Core ie;
+    auto result = ie.ReadNetwork(xml.str(), InferenceEngine::Blob::CPtr());
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected);
+    ASSERT_TRUE(success) << message;
+}
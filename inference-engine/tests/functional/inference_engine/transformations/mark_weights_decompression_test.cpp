@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+#include <transformations/common_optimizations/mark_weights_decompression.hpp>
+#include <transformations/init_node_info.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+namespace {
+std::shared_ptr<ngraph::Function> create_compressed_matmul(ngraph::element::Type weights_type, bool with_zero_point, bool grouped) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 64});
+
+    // grouped weights have scale and zero point per 32 input channels and are reshaped to 2D before MatMul
+    const ngraph::Shape weights_shape = grouped ? ngraph::Shape{32, 2, 32} : ngraph::Shape{32, 64};
+    const ngraph::Shape scale_shape = grouped ? ngraph::Shape{32, 2, 1} : ngraph::Shape{32, 1};
+
+    auto weights = ngraph::opset6::Constant::create(weights_type, weights_shape, {3});
+    auto convert = std::make_shared<ngraph::opset6::Convert>(weights, ngraph::element::f32);
+    convert->set_friendly_name("convert");
+
+    std::shared_ptr<ngraph::Node> decompressed = convert;
+    if (with_zero_point) {
+        auto zero_point = ngraph::opset6::Constant::create(ngraph::element::f32, scale_shape, {1});
+        decompressed = std::make_shared<ngraph::opset6::Subtract>(decompressed, zero_point);
+        decompressed->set_friendly_name("subtract");
+    }
+    auto scale = ngraph::opset6::Constant::create(ngraph::element::f32, scale_shape, {0.5});
+    decompressed = std::make_shared<ngraph::opset6::Multiply>(decompressed, scale);
+    decompressed->set_friendly_name("multiply");
+
+    if (grouped) {
+        auto shape = ngraph::opset6::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {32, 64});
+        decompressed = std::make_shared<ngraph::opset6::Reshape>(decompressed, shape, false);
+        decompressed->set_friendly_name("reshape");
+    }
+
+    auto matmul = std::make_shared<ngraph::opset6::MatMul>(data, decompressed, false, true);
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{data});
+}
+
+std::shared_ptr<ngraph::Node> find_node(const std::shared_ptr<ngraph::Function>& f, const std::string& name) {
+    for (const auto& op : f->get_ops()) {
+        if (op->get_friendly_name() == name)
+            return op;
+    }
+    return nullptr;
+}
+}  // namespace
+
+TEST(TransformationTests, MarkWeightsDecompressionU8WithZeroPoint) {
+    auto f = create_compressed_matmul(ngraph::element::u8, true, true);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::MarkWeightsDecompression>();
+    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto convert = find_node(f, "convert");
+    ASSERT_NE(convert, nullptr);
+    ASSERT_TRUE(convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+
+    auto subtract = find_node(f, "subtract");
+    auto multiply = find_node(f, "multiply");
+    auto reshape = find_node(f, "reshape");
+    ASSERT_NE(subtract, nullptr);
+    ASSERT_NE(multiply, nullptr);
+    ASSERT_NE(reshape, nullptr);
+    ASSERT_TRUE(ngraph::is_weights_decompression(subtract));
+    ASSERT_TRUE(ngraph::is_weights_decompression(multiply));
+    ASSERT_TRUE(ngraph::is_weights_decompression(reshape));
+}
+
+TEST(TransformationTests, MarkWeightsDecompressionI8WithoutZeroPoint) {
+    auto f = create_compressed_matmul(ngraph::element::i8, false, false);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::MarkWeightsDecompression>();
+    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto convert = find_node(f, "convert");
+    auto multiply = find_node(f, "multiply");
+    ASSERT_NE(convert, nullptr);
+    ASSERT_NE(multiply, nullptr);
+    ASSERT_TRUE(ngraph::is_weights_decompression(multiply));
+}
+
+TEST(TransformationTests, MarkWeightsDecompressionNegativeFloatWeights) {
+    auto f = create_compressed_matmul(ngraph::element::f16, true, true);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::MarkWeightsDecompression>();
+    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    // f16 weights aren't compressed, the whole subgraph is folded
+    auto matmul = f->get_result()->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset6::Constant>(matmul->get_input_node_shared_ptr(1)));
+}
+
+TEST(TransformationTests, MarkWeightsDecompressionDisabledByCallback) {
+    auto f = create_compressed_matmul(ngraph::element::u8, true, true);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.register_pass<ngraph::pass::MarkWeightsDecompression>();
+    manager.get_pass_config()->set_callback<ngraph::pass::MarkWeightsDecompression>(
+            [](const std::shared_ptr<const ngraph::Node>&) -> bool { return true; });
+    manager.run_passes(f);
+    ASSERT_NO_THROW(check_rt_info(f));
+
+    auto multiply = find_node(f, "multiply");
+    ASSERT_NE(multiply, nullptr);
+    ASSERT_FALSE(ngraph::is_weights_decompression(multiply));
+}
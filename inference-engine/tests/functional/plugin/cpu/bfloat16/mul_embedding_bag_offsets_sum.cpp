@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bfloat16_helpers.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+#include <utility>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+#include "ngraph/opsets/opset3.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+class Mul_EmbeddingBagOffsetsSum : public BasicBF16Test  {
+protected:
+    std::shared_ptr<ngraph::Function> createGraph(InferenceEngine::Precision netPrecision) override {
+//                  Input
+//                    |
+//                   Mul
+//                    |
+// -------------------------------------------
+//       EmbeddingBagOffsetsSum (BF16) --- Const indices, offsets, default index, weights
+
+        // STAGE1: construction of the GRAPH
+        ngraph::element::Type ntype = (netPrecision == Precision::FP32) ? ngraph::element::f32 : ngraph::element::bf16;
+        const size_t tableRows = inputShapes[0];
+
+        auto input1 = std::make_shared<opset1::Parameter>(ntype, ngraph::Shape{inputShapes});
+        input1->set_friendly_name("Input_1");
+
+        // multiply
+        std::shared_ptr<ngraph::opset1::Constant> mulConst = nullptr;
+        if (netPrecision == Precision::FP32) {
+            mulConst = opset1::Constant::create(ntype, Shape{1}, { 2.0f });
+        } else {
+            mulConst = opset1::Constant::create(ntype, Shape{1}, { bfloat16::from_bits(FuncTestUtils::Bf16TestUtils::reducePrecisionBitwiseS(2.0f)) });
+        }
+        auto mulNode = std::make_shared<opset1::Multiply>(input1, mulConst);
+        mulNode->set_friendly_name("Mul_1");
+
+        // embedding bag: a large bag, an empty bag taking the default index and a few small bags
+        const std::vector<int32_t> offsets = {0, 40, 41, 41, 43, 44, 46, 47, 48, 50};
+        const size_t indicesNum = 52;
+        std::vector<int32_t> indices;
+        std::vector<float> weights;
+        for (size_t i = 0; i < indicesNum; i++) {
+            indices.push_back(static_cast<int32_t>((i * 37) % tableRows));
+            // the weights are exact in bfloat16
+            weights.push_back(0.25f * static_cast<float>(1 + i % 4));
+        }
+        auto indicesConst = opset1::Constant::create(ngraph::element::i32, Shape{indicesNum}, indices);
+        auto offsetsConst = opset1::Constant::create(ngraph::element::i32, Shape{offsets.size()}, offsets);
+        auto defaultIndexConst = opset1::Constant::create(ngraph::element::i32, Shape{}, { 1 });
+        auto weightsConst = opset1::Constant::create(ntype, Shape{indicesNum}, weights);
+        auto embBagNode = std::make_shared<opset3::EmbeddingBagOffsetsSum>(mulNode, indicesConst, offsetsConst,
+                                                                            defaultIndexConst, weightsConst);
+        embBagNode->set_friendly_name("EmbeddingBagOffsetsSum_1");
+
+        return std::make_shared<ngraph::Function>(embBagNode, ngraph::ParameterVector{input1});
+    }
+    void SetUp() override {
+        std::tie(inputPrecision, netPrecision, inputShapes, newInputShapes, targetDevice) = this->GetParam();
+        fnPtr = createGraph(netPrecision);
+
+        // STAGE2: set up safe threshold
+        // the table is rounded to bfloat16, but up to 40 of its rows are accumulated in FP32
+        threshold = 0.2f;
+
+        // STAGE3:
+        // filling of expected precision of layer execution defined by precisoin of input tensor to the primitive and reflected in
+        // performance counters
+        expectedPrecisions["EmbeddingBagOffsetsSum_1"] = "BF16";
+    }
+};
+
+TEST_P(Mul_EmbeddingBagOffsetsSum, CompareWithRefImpl) {
+    test();
+};
+
+// the row of 150 elements is accumulated by vector blocks of different size and by the scalar tail
+INSTANTIATE_TEST_CASE_P(smoke_BF16_bfloat16_NoReshape, Mul_EmbeddingBagOffsetsSum,
+                        ::testing::Combine(
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(Precision::BF16),
+                                ::testing::Values(SizeVector({100, 150})),
+                                ::testing::Values(SizeVector()),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        Mul_EmbeddingBagOffsetsSum::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FP32_bfloat16_NoReshape, Mul_EmbeddingBagOffsetsSum,
+                        ::testing::Combine(
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(SizeVector({100, 150})),
+                                ::testing::Values(SizeVector()),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        Mul_EmbeddingBagOffsetsSum::getTestCaseName);
+}  // namespace LayerTestsDefinitions
@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cpu/cpu_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -24,7 +25,19 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TUNING_MODE, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TUNING_MODE, InferenceEngine::PluginConfigParams::NO},
+             {InferenceEngine::CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "16"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_JIT_KERNEL_CACHE_DIR, ""}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, "2"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_THREADS_BUDGET, "0"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_THREADS_WEIGHT, "2"}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -39,7 +52,14 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_PRIORITY}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                     InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE, "500"}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -59,7 +79,13 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_TUNING_MODE, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PRIMITIVE_CACHE_CAPACITY, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_WORKSPACE_HUGE_PAGES, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_THREADS_BUDGET, "-1"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_THREADS_WEIGHT, "0"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -68,7 +94,11 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "OFF"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
@@ -21,7 +21,12 @@ namespace {
     };
 
     const std::vector<std::map<std::string, std::string>> Multiconfigs = {
-            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}},
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+             { MULTI_CONFIG_KEY(SCHEDULING_POLICY) , InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY}},
+            {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU},
+             { MULTI_CONFIG_KEY(SCHEDULING_POLICY) , InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY},
+             { MULTI_CONFIG_KEY(REQUEST_DEADLINE) , "1000"}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, InferRequestTests,
@@ -22,4 +22,10 @@ INSTANTIATE_TEST_CASE_P(nightly_RandomMajorNodes, HeteroSyntheticTest,
                                 ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
                                 ::testing::ValuesIn(HeteroTests::HeteroSyntheticTest::_randomMajorNodeFunctions)),
                         HeteroSyntheticTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_MinLatency, HeteroSyntheticMinLatencyTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<PluginParameter>{{"CPU0", "MKLDNNPlugin"}, {"CPU1", "MKLDNNPlugin"}}),
+                                ::testing::ValuesIn(HeteroTests::HeteroSyntheticMinLatencyTest::_withoutAffinityFunctions)),
+                        HeteroSyntheticTest::getTestCaseName);
 }  // namespace
@@ -22,7 +22,7 @@ const std::vector<InferenceEngine::Precision> indPrecisions = {
         InferenceEngine::Precision::I32
 };
 
-const std::vector<std::vector<size_t>> emb_table_shape = {{5, 6}, {10, 35}, {5, 4, 16}};
+const std::vector<std::vector<size_t>> emb_table_shape = {{5, 6}, {10, 35}, {5, 4, 16}, {20, 200}};
 const std::vector<std::vector<size_t>> indices =
         {{0, 1, 2, 2, 3}, {4, 4, 3, 1, 0}, {1, 2, 1, 2, 1, 2, 1, 2, 1, 2}};
 const std::vector<std::vector<size_t>> offsets = {{0, 2}, {0, 0, 2, 2}, {2, 4}};
@@ -0,0 +1,81 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <shared_test_classes/single_layer/detection_output.hpp>
+
+using namespace InferenceEngine;
+using namespace LayerTestsDefinitions;
+
+namespace CPULayerTestsDefinitions {
+
+/*
+ * Thousands of priors give much more detections than keep_top_k, so only a part of them is selected.
+ * Confidences are distinct to make the selected detections and their order independent of the sort algorithm.
+ */
+class DetectionOutputManyPriorsCPUTest : public DetectionOutputLayerTest {
+public:
+    void GenerateInputs() override {
+        DetectionOutputLayerTest::GenerateInputs();
+
+        auto confidence = InferenceEngine::as<InferenceEngine::MemoryBlob>(inputs[1]);
+        ASSERT_NE(confidence, nullptr);
+        auto lockedMemory = confidence->wmap();
+        float *data = lockedMemory.as<float *>();
+        const size_t size = confidence->size();
+
+        std::vector<size_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937(0));
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<float>(order[i] + 1) / static_cast<float>(size + 1);
+        }
+    }
+};
+
+TEST_P(DetectionOutputManyPriorsCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const int numClasses = 11;
+const int numPriors = 2000;
+
+const auto commonAttributes = ::testing::Combine(
+        ::testing::Values(numClasses),
+        ::testing::Values(0),                       // backgroundLabelId
+        ::testing::Values(400),                     // topK
+        ::testing::Values(std::vector<int>{200}),   // keepTopK
+        ::testing::Values("caffe.PriorBoxParameter.CENTER_SIZE"),
+        ::testing::Values(0.5f),                    // nmsThreshold
+        ::testing::Values(0.3f),                    // confidenceThreshold
+        ::testing::Values(true, false),             // clipAfterNms
+        ::testing::Values(false),                   // clipBeforeNms
+        ::testing::Values(false)                    // decreaseLabelId
+);
+
+const std::vector<ParamsWhichSizeDepends> specificParams = {
+    ParamsWhichSizeDepends{false, true, true, 1, 1, {1, 4 * numPriors}, {1, numClasses * numPriors}, {1, 2, 4 * numPriors}, {}, {}},
+    ParamsWhichSizeDepends{false, false, true, 1, 1, {1, 4 * numClasses * numPriors}, {1, numClasses * numPriors}, {1, 2, 4 * numPriors}, {}, {}}
+};
+
+const auto params = ::testing::Combine(
+        commonAttributes,
+        ::testing::ValuesIn(specificParams),
+        ::testing::Values(1, 2),                    // batch
+        ::testing::Values(0.0f),                    // objectnessScore
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DetectionOutputManyPriors, DetectionOutputManyPriorsCPUTest, params,
+                        DetectionOutputLayerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
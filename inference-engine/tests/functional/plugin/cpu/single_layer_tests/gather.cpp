@@ -0,0 +1,132 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/gather.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        LayerTestsDefinitions::gatherParamsTuple,
+        CPUSpecificParams
+> GatherLayerCPUTestParamSet;
+
+class GatherLayerCPUTest : public testing::WithParamInterface<GatherLayerCPUTestParamSet>,
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<GatherLayerCPUTestParamSet> obj) {
+        LayerTestsDefinitions::gatherParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << LayerTestsDefinitions::GatherLayerTest::getTestCaseName(
+                testing::TestParamInfo<LayerTestsDefinitions::gatherParamsTuple>(basicParamsSet, 0));
+
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::gatherParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        int axis;
+        std::vector<int> indices;
+        std::vector<size_t> indicesShape;
+        std::vector<size_t> inputShape;
+        InferenceEngine::Precision netPrecision;
+        std::tie(indices, indicesShape, axis, inputShape, netPrecision, inPrc, outPrc, inLayout, outLayout, targetDevice) = basicParamsSet;
+
+        inPrc = outPrc = netPrecision;
+        selectedType = std::string("ref_") + netPrecision.name();
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto indicesNode = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape(indicesShape), indices);
+        auto axisNode = ngraph::opset3::Constant::create(ngraph::element::i64, ngraph::Shape({}), {axis});
+        auto gather = std::make_shared<ngraph::opset3::Gather>(paramOuts[0], indicesNode, axisNode);
+        gather->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(gather)};
+        function = std::make_shared<ngraph::Function>(results, params, "Gather");
+    }
+};
+
+TEST_P(GatherLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "Gather");
+}
+
+namespace {
+
+const auto cpuParams_nChw16c = CPUSpecificParams {{nChw16c}, {nChw16c}, {}, {}};
+const auto cpuParams_nChw8c = CPUSpecificParams {{nChw8c}, {nChw8c}, {}, {}};
+const auto cpuParams_nhwc = CPUSpecificParams {{nhwc}, {nhwc}, {}, {}};
+const auto cpuParams_nchw = CPUSpecificParams {{nchw}, {nchw}, {}, {}};
+
+const std::vector<InferenceEngine::Precision> inputPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::BF16,
+        InferenceEngine::Precision::I8
+};
+
+const std::vector<CPUSpecificParams> CPUParamsPlanar4D = {
+        cpuParams_nhwc,
+        cpuParams_nchw
+};
+
+// the channels axis is gathered too, so it also covers the case when the copied piece of data is a single element
+const auto gatherPlanar4DParams = testing::Combine(
+        testing::Combine(
+                testing::Values(std::vector<int>{0, 3, 2, 5, 5}),
+                testing::Values(std::vector<size_t>{5}),
+                testing::Values(0, 1, 2, -1),
+                testing::Values(std::vector<size_t>{6, 7, 8, 9}),
+                testing::ValuesIn(inputPrecisions),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUInfoForDevice(CPUParamsPlanar4D))
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUGatherPlanar4D, GatherLayerCPUTest, gatherPlanar4DParams,
+                        GatherLayerCPUTest::getTestCaseName);
+
+const std::vector<CPUSpecificParams> CPUParamsBlocked4D = {
+        cpuParams_nChw16c,
+        cpuParams_nChw8c
+};
+
+// channels count which is not a multiple of the block size checks that the padded tail of the block is copied too
+const auto gatherBlocked4DParams = testing::Combine(
+        testing::Combine(
+                testing::Values(std::vector<int>{0, 3, 2, 5, 5}),
+                testing::Values(std::vector<size_t>{5}),
+                testing::Values(0, 2, 3),
+                testing::Values(std::vector<size_t>{6, 20, 6, 9}, std::vector<size_t>{6, 32, 7, 6}),
+                testing::ValuesIn(inputPrecisions),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUInfoForDevice(CPUParamsBlocked4D))
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUGatherBlocked4D, GatherLayerCPUTest, gatherBlocked4DParams,
+                        GatherLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
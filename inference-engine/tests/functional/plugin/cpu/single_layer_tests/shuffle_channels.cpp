@@ -0,0 +1,157 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/shuffle_channels.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        LayerTestsDefinitions::shuffleChannelsLayerTestParamsSet,
+        CPUSpecificParams
+> ShuffleChannelsLayerCPUTestParamSet;
+
+class ShuffleChannelsLayerCPUTest : public testing::WithParamInterface<ShuffleChannelsLayerCPUTestParamSet>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ShuffleChannelsLayerCPUTestParamSet> obj) {
+        LayerTestsDefinitions::shuffleChannelsLayerTestParamsSet basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << LayerTestsDefinitions::ShuffleChannelsLayerTest::getTestCaseName(
+                testing::TestParamInfo<LayerTestsDefinitions::shuffleChannelsLayerTestParamsSet>(basicParamsSet, 0));
+
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::shuffleChannelsLayerTestParamsSet basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        LayerTestsDefinitions::shuffleChannelsSpecificParams shuffleChannelsParams;
+        std::vector<size_t> inputShape;
+        InferenceEngine::Precision netPrecision;
+        std::tie(shuffleChannelsParams, netPrecision, inPrc, outPrc, inLayout, outLayout, inputShape, targetDevice) = basicParamsSet;
+        int axis, group;
+        std::tie(axis, group) = shuffleChannelsParams;
+
+        inPrc = outPrc = netPrecision;
+        selectedType = getPrimitiveType() + "_" + inPrc.name();
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto shuffleChannels = ngraph::builder::makeShuffleChannels(paramOuts[0], axis, group);
+        shuffleChannels->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(shuffleChannels)};
+        function = std::make_shared<ngraph::Function>(results, params, "ShuffleChannels");
+    }
+};
+
+TEST_P(ShuffleChannelsLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "ShuffleChannels");
+}
+
+namespace {
+
+const auto cpuParams_nChw16c = CPUSpecificParams {{nChw16c}, {nChw16c}, {"jit_avx512"}, {"jit_avx512"}};
+const auto cpuParams_nChw8c_avx2 = CPUSpecificParams {{nChw8c}, {nChw8c}, {"jit_avx2"}, {"jit_avx2"}};
+const auto cpuParams_nChw8c_sse42 = CPUSpecificParams {{nChw8c}, {nChw8c}, {"jit_sse42"}, {"jit_sse42"}};
+
+const auto cpuParams_nhwc_avx2 = CPUSpecificParams {{nhwc}, {nhwc}, {"jit_avx2"}, {"jit_avx2"}};
+const auto cpuParams_nhwc_sse42 = CPUSpecificParams {{nhwc}, {nhwc}, {"jit_sse42"}, {"jit_sse42"}};
+const auto cpuParams_nhwc_ref = CPUSpecificParams {{nhwc}, {nhwc}, {"ref_any"}, {"ref_any"}};
+
+const auto cpuParams_nchw_avx2 = CPUSpecificParams {{nchw}, {nchw}, {"jit_avx2"}, {"jit_avx2"}};
+const auto cpuParams_nchw_sse42 = CPUSpecificParams {{nchw}, {nchw}, {"jit_sse42"}, {"jit_sse42"}};
+
+const std::vector<InferenceEngine::Precision> inputPrecisions = {
+        InferenceEngine::Precision::FP32,
+        InferenceEngine::Precision::BF16,
+        InferenceEngine::Precision::I8
+};
+
+const std::vector<CPUSpecificParams> CPUParamsPlanar4D = {
+        cpuParams_nhwc_avx2,
+        cpuParams_nhwc_sse42,
+        cpuParams_nhwc_ref,
+        cpuParams_nchw_avx2,
+        cpuParams_nchw_sse42,
+};
+
+const auto shuffleChannelsPlanar4DParams = testing::Combine(
+        testing::Combine(
+                testing::Combine(
+                        testing::Values(0, 1, 2, -1),
+                        testing::Values(1, 2, 3)),
+                testing::ValuesIn(inputPrecisions),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(std::vector<size_t>{6, 6, 6, 6}),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUInfoForDevice(CPUParamsPlanar4D))
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUShuffleChannelsPlanar4D, ShuffleChannelsLayerCPUTest, shuffleChannelsPlanar4DParams,
+                        ShuffleChannelsLayerCPUTest::getTestCaseName);
+
+const std::vector<CPUSpecificParams> CPUParamsBlocked4D = {
+        cpuParams_nChw16c,
+        cpuParams_nChw8c_avx2,
+        cpuParams_nChw8c_sse42,
+};
+
+// channels shuffle inside blocks: group divides the block size and each group consists of whole blocks
+const auto shuffleChannelsBlockedChannelsParams = testing::Combine(
+        testing::Combine(
+                testing::Combine(
+                        testing::Values(1),
+                        testing::Values(1, 2, 4)),
+                testing::ValuesIn(inputPrecisions),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(std::vector<size_t>{1, 64, 3, 5}, std::vector<size_t>{2, 128, 2, 2}),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUInfoForDevice(CPUParamsBlocked4D))
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUShuffleChannelsBlockedChannels4D, ShuffleChannelsLayerCPUTest, shuffleChannelsBlockedChannelsParams,
+                        ShuffleChannelsLayerCPUTest::getTestCaseName);
+
+const auto shuffleChannelsBlockedSpatialParams = testing::Combine(
+        testing::Combine(
+                testing::Combine(
+                        testing::Values(2, 3),
+                        testing::Values(1, 3)),
+                testing::ValuesIn(inputPrecisions),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(std::vector<size_t>{1, 20, 6, 9}),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUInfoForDevice(CPUParamsBlocked4D))
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_CPUShuffleChannelsBlockedSpatial4D, ShuffleChannelsLayerCPUTest, shuffleChannelsBlockedSpatialParams,
+                        ShuffleChannelsLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,96 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu/cpu_config.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ie_system_conf.h"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        SizeVector,     // Input shape
+        std::string     // Device name
+> BF16PrecisionConversionsParams;
+
+/*
+ *        Parameter
+ *            |
+ *          Relu
+ *            |
+ *     ReverseSequence --- Constant
+ *            |
+ *           Sin
+ *            |
+ *          Relu
+ *
+ *  With enforced BF16 the data between the Relu nodes is BF16. ReverseSequence and Sin (Math node) process it
+ *  natively, so BF16 <-> FP32 conversions may appear only at the network input and output.
+ */
+class BF16PrecisionConversionsTest : public testing::WithParamInterface<BF16PrecisionConversionsParams>,
+                                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BF16PrecisionConversionsParams> &obj) {
+        SizeVector inputShape;
+        std::string targetName;
+        std::tie(inputShape, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape)
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        SizeVector inputShape;
+        std::tie(inputShape, targetDevice) = this->GetParam();
+        configuration[PluginConfigParams::KEY_ENFORCE_BF16] = PluginConfigParams::YES;
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto relu1 = std::make_shared<opset1::Relu>(params[0]);
+        relu1->set_friendly_name("Relu_1");
+        std::vector<int32_t> seqLengths(inputShape[0], static_cast<int32_t>(inputShape[1]));
+        auto seqLengthsNode = opset1::Constant::create(element::i32, Shape{inputShape[0]}, seqLengths);
+        auto reverseSequence = std::make_shared<opset1::ReverseSequence>(relu1, seqLengthsNode, 0, 1);
+        reverseSequence->set_friendly_name("ReverseSequence");
+        auto sin = std::make_shared<opset1::Sin>(reverseSequence);
+        sin->set_friendly_name("Sin");
+        auto relu2 = std::make_shared<opset1::Relu>(sin);
+        relu2->set_friendly_name("Relu_2");
+        function = std::make_shared<Function>(relu2, params, "BF16PrecisionConversions");
+    }
+};
+
+TEST_P(BF16PrecisionConversionsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!with_cpu_x86_avx512_core()) {
+        // BF16 is not enforced on platforms without AVX512 ISA
+        GTEST_SKIP();
+    }
+
+    Run();
+
+    ASSERT_EQ("BF16", getRuntimePrecision("ReverseSequence"));
+    ASSERT_EQ("BF16", getRuntimePrecision("Sin"));
+
+    // only the FP32 network input and output may be converted
+    unsigned int conversions = executableNetwork.GetMetric(CPU_METRIC_KEY(PRECISION_CONVERSIONS));
+    ASSERT_LE(conversions, 2u);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_BF16PrecisionConversions, BF16PrecisionConversionsTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{2, 8, 16}, SizeVector{1, 10, 3, 5}),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        BF16PrecisionConversionsTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
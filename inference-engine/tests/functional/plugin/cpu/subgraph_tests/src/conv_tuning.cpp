@@ -0,0 +1,96 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+
+#include "cpu/cpu_config.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        SizeVector,     // Input shape
+        size_t,         // Output channels
+        std::string     // Device name
+> ConvTuningParams;
+
+/*
+ *   Parameter
+ *       |
+ *  Convolution 3x3
+ *       |
+ *     Relu
+ *       |
+ *  Convolution 1x1
+ */
+class ConvTuningTest : public testing::WithParamInterface<ConvTuningParams>,
+                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConvTuningParams> &obj) {
+        SizeVector inputShape;
+        size_t outputChannels;
+        std::string targetName;
+        std::tie(inputShape, outputChannels, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape)
+                << "_OC=" << outputChannels
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    const std::string cacheFile = "cpu_tuning_cache_test.txt";
+
+    void SetUp() override {
+        SizeVector inputShape;
+        size_t outputChannels;
+        std::tie(inputShape, outputChannels, targetDevice) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv1 = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, outputChannels);
+        auto relu = std::make_shared<opset1::Relu>(conv1);
+        auto conv2 = builder::makeConvolution(relu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, outputChannels);
+        function = std::make_shared<Function>(conv2, params, "ConvTuning");
+
+        std::remove(cacheFile.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(cacheFile.c_str());
+    }
+};
+
+TEST_P(ConvTuningTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration = {{CPUConfigParams::KEY_CPU_TUNING_MODE, PluginConfigParams::YES},
+                     {CPUConfigParams::KEY_CPU_TUNING_CACHE_FILE, cacheFile}};
+    Run();
+    ASSERT_TRUE(std::ifstream(cacheFile).good());
+
+    // the second load reuses stored results without tuning
+    configuration[CPUConfigParams::KEY_CPU_TUNING_MODE] = PluginConfigParams::NO;
+    inputs.clear();
+    Run();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ConvTuning, ConvTuningTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 16, 14, 14}, SizeVector{2, 3, 10, 10}),
+                                ::testing::Values(32),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        ConvTuningTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
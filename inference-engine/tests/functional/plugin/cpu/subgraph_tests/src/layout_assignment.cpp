@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <numeric>
+
+#include "cpu/cpu_config.hpp"
+#include "exec_graph_info.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        SizeVector,     // Input shape
+        std::string     // Device name
+> LayoutAssignmentParams;
+
+/*
+ *        Parameter
+ *            |
+ *           Relu
+ *         /      \
+ *  Convolution  Convolution
+ *         \      /
+ *           Add
+ *
+ * Node by node selection keeps the planar layout of the Parameter for Relu, so the output of Relu is reordered to the
+ * blocked layout of the convolutions twice. The layout assignment moves the reorder before Relu, where it is done once.
+ */
+class LayoutAssignmentTest : public testing::WithParamInterface<LayoutAssignmentParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayoutAssignmentParams> &obj) {
+        SizeVector inputShape;
+        std::string targetName;
+        std::tie(inputShape, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape)
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        SizeVector inputShape;
+        std::tie(inputShape, targetDevice) = this->GetParam();
+        // the expected reorder sizes are computed for FP32 tensors
+        configuration.insert({PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO});
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto relu = std::make_shared<opset1::Relu>(params[0]);
+        relu->set_friendly_name("Relu");
+        auto conv1 = builder::makeConvolution(relu, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                              op::PadType::EXPLICIT, inputShape[1]);
+        auto conv2 = builder::makeConvolution(relu, element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                              op::PadType::EXPLICIT, inputShape[1]);
+        auto add = std::make_shared<opset1::Add>(conv1, conv2);
+        function = std::make_shared<Function>(add, params, "LayoutAssignment");
+    }
+};
+
+TEST_P(LayoutAssignmentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::vector<std::string> metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), CPU_METRIC_KEY(ELIMINATED_REORDERS)), metrics.end());
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), CPU_METRIC_KEY(ELIMINATED_REORDER_BYTES)), metrics.end());
+
+    // two reorders of the Relu output are replaced by one reorder of its input, every reorder reads and writes the tensor
+    const auto inputShape = std::get<0>(GetParam());
+    const uint64_t tensorBytes = std::accumulate(inputShape.begin(), inputShape.end(), sizeof(float), std::multiplies<size_t>());
+    unsigned int reorders = executableNetwork.GetMetric(CPU_METRIC_KEY(ELIMINATED_REORDERS));
+    uint64_t bytes = executableNetwork.GetMetric(CPU_METRIC_KEY(ELIMINATED_REORDER_BYTES));
+    ASSERT_EQ(1u, reorders);
+    ASSERT_EQ(2 * tensorBytes, bytes);
+
+    auto function = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, function);
+    auto getLayerType = [](const std::shared_ptr<Node>& node) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        return value->get();
+    };
+    bool reluFound = false;
+    for (const auto& node : function->get_ops()) {
+        if (node->get_friendly_name() != "Relu")
+            continue;
+        reluFound = true;
+        ASSERT_EQ(1u, node->get_input_size());
+        ASSERT_EQ("Reorder", getLayerType(node->get_input_node_shared_ptr(0)));
+        for (const auto& consumer : node->output(0).get_target_inputs())
+            ASSERT_EQ("Convolution", getLayerType(consumer.get_node()->shared_from_this()));
+    }
+    ASSERT_TRUE(reluFound);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_LayoutAssignment, LayoutAssignmentTest,
+                        ::testing::Combine(
+                                ::testing::Values(SizeVector{1, 16, 10, 10}, SizeVector{1, 32, 7, 7}),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LayoutAssignmentTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,193 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <exec_graph_info.hpp>
+
+#include <random>
+
+using namespace ngraph;
+
+namespace CPUSubgraphTestsDefinitions {
+typedef std::tuple<
+        Shape,          // Input shape
+        size_t,         // Output channels
+        element::Type,  // Compressed weights precision
+        bool,           // Weights values fit 4 bits, such weights are packed as 4 bit
+        size_t,         // Group size (0 - per channel scales)
+        bool,           // Weights stored as [K, N] (per channel case only)
+        bool,           // With zero point
+        std::string     // Device name
+> MatMulCompressedWeightsParams;
+
+/*
+ *    Const (u8/i8/u4/i4)
+ *        |
+ *     Convert
+ *        |
+ *    [Subtract]  <- zero point
+ *        |
+ *     Multiply   <- scale
+ *        |
+ *    [Reshape]
+ *        |
+ *      MatMul    <- Parameter
+ */
+class MatMulCompressedWeightsTest : public testing::WithParamInterface<MatMulCompressedWeightsParams>,
+                                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MatMulCompressedWeightsParams> &obj) {
+        Shape inputShape;
+        size_t outputChannels, groupSize;
+        element::Type weightsPrecision;
+        bool is4bit;
+        bool transposeWeights, withZeroPoint;
+        std::string targetName;
+        std::tie(inputShape, outputChannels, weightsPrecision, is4bit, groupSize, transposeWeights, withZeroPoint, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << inputShape
+                << "_OC=" << outputChannels
+                << "_WPRC=" << weightsPrecision
+                << "_4bit=" << is4bit
+                << "_Group=" << groupSize
+                << "_Transpose=" << transposeWeights
+                << "_ZeroPoint=" << withZeroPoint
+                << "_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        threshold = 1e-3f;
+
+        Shape inputShape;
+        size_t outputChannels, groupSize;
+        element::Type weightsPrecision;
+        bool is4bit;
+        bool transposeWeights, withZeroPoint;
+        std::tie(inputShape, outputChannels, weightsPrecision, is4bit, groupSize, transposeWeights, withZeroPoint, targetDevice) = this->GetParam();
+
+        const size_t K = inputShape.back();
+        const auto param = std::make_shared<opset6::Parameter>(element::f32, inputShape);
+
+        Shape weightsShape, scaleShape;
+        if (groupSize) {
+            weightsShape = {outputChannels, K / groupSize, groupSize};
+            scaleShape = {outputChannels, K / groupSize, 1};
+        } else {
+            weightsShape = transposeWeights ? Shape{K, outputChannels} : Shape{outputChannels, K};
+            scaleShape = transposeWeights ? Shape{1, outputChannels} : Shape{outputChannels, 1};
+        }
+
+        // the whole range of the precision, so the lowest negative codes are decompressed as well
+        const int bits = is4bit ? 4 : 8;
+        const int minValue = weightsPrecision.is_signed() ? -(1 << (bits - 1)) : 0;
+        const int maxValue = weightsPrecision.is_signed() ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> dist(minValue, maxValue);
+        weightsValues.resize(shape_size(weightsShape));
+        for (auto& value : weightsValues)
+            value = dist(gen);
+        weights = opset6::Constant::create(weightsPrecision, weightsShape, weightsValues);
+
+        std::shared_ptr<Node> decompressed = std::make_shared<opset6::Convert>(weights, element::f32);
+        if (withZeroPoint) {
+            std::vector<float> zeroPointValues(shape_size(scaleShape));
+            for (size_t i = 0; i < zeroPointValues.size(); i++)
+                zeroPointValues[i] = static_cast<float>(minValue / 2 + static_cast<int>(i % 5));
+            const auto zeroPoint = opset6::Constant::create(element::f32, scaleShape, zeroPointValues);
+            decompressed = std::make_shared<opset6::Subtract>(decompressed, zeroPoint);
+        }
+        std::vector<float> scaleValues(shape_size(scaleShape));
+        for (size_t i = 0; i < scaleValues.size(); i++)
+            scaleValues[i] = 0.01f * static_cast<float>(1 + i % 3);
+        const auto scale = opset6::Constant::create(element::f32, scaleShape, scaleValues);
+        decompressed = std::make_shared<opset6::Multiply>(decompressed, scale);
+        if (groupSize) {
+            decompressed = std::make_shared<opset6::Reshape>(decompressed,
+                opset6::Constant::create(element::i64, Shape{2}, {static_cast<int64_t>(outputChannels), static_cast<int64_t>(K)}), false);
+        }
+
+        const auto matMul = std::make_shared<opset6::MatMul>(param, decompressed, false, !(transposeWeights && !groupSize));
+        ResultVector results{std::make_shared<opset6::Result>(matMul)};
+        function = std::make_shared<Function>(results, ParameterVector{param}, "MatMulCompressedWeights");
+    }
+
+    std::vector<std::vector<std::uint8_t>> CalculateRefs() override {
+        // nGraph interpreter does not convert 4 bit values, the same codes are given to it as 8 bit ones
+        const auto weightsPrecision = weights->get_element_type();
+        if (weightsPrecision == element::u4 || weightsPrecision == element::i4) {
+            const auto refPrecision = weightsPrecision == element::u4 ? element::u8 : element::i8;
+            replace_node(weights, opset6::Constant::create(refPrecision, weights->get_shape(), weightsValues));
+        }
+
+        return LayerTestsCommon::CalculateRefs();
+    }
+
+    // The decompression subgraph must be executed by FullyConnected node, not by separate Convert and Eltwise nodes
+    void CheckDecompressionIsFused() {
+        auto function = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, function);
+
+        size_t fullyConnectedCount = 0;
+        for (const auto& node : function->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, value);
+
+            const auto layerType = value->get();
+            ASSERT_NE("Convert", layerType) << node->get_friendly_name();
+            ASSERT_NE("Eltwise", layerType) << node->get_friendly_name();
+            if (layerType == "FullyConnected")
+                fullyConnectedCount++;
+        }
+        ASSERT_EQ(1u, fullyConnectedCount);
+    }
+
+    std::shared_ptr<opset6::Constant> weights;
+    std::vector<int> weightsValues;
+};
+
+TEST_P(MatMulCompressedWeightsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckDecompressionIsFused();
+}
+
+namespace {
+const std::vector<Shape> inputShapes {
+    {1, 64}, {3, 64}, {32, 64}, {2, 5, 64}, {2, 24, 64}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_MatMulCompressedWeights_8bit, MatMulCompressedWeightsTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(inputShapes),
+        ::testing::Values(40),
+        ::testing::Values(element::u8, element::i8),
+        ::testing::Values(false),
+        ::testing::Values(0, 16),
+        ::testing::Values(true, false),
+        ::testing::Values(true, false),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    MatMulCompressedWeightsTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_MatMulCompressedWeights_4bit, MatMulCompressedWeightsTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(inputShapes),
+        ::testing::Values(33),
+        ::testing::Values(element::u8, element::i8, element::u4, element::i4),
+        ::testing::Values(true),
+        ::testing::Values(0, 32),
+        ::testing::Values(false),
+        ::testing::Values(true, false),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    MatMulCompressedWeightsTest::getTestCaseName);
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu/cpu_config.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+#include <ngraph/ngraph.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/*
+ *   Parameter (U8, per channel mean values)
+ *       |
+ *    Multiply
+ *
+ * The mean values make the plugin convert the U8 input to FP32 in the preprocessing stage.
+ */
+class PreprocessStageTest : public testing::Test {
+protected:
+    static constexpr size_t requestsNum = 4;
+    static constexpr size_t runsNum = 3;
+    const SizeVector inputShape = {1, 3, 32, 32};
+    std::string inputName;
+    std::string outputName;
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    }
+
+    ExecutableNetwork loadNetwork(const std::map<std::string, std::string>& config) {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, Shape(inputShape));
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+        auto multiply = std::make_shared<op::v1::Multiply>(input, scale);
+        auto function = std::make_shared<Function>(multiply, ParameterVector{input}, "PreprocessStage");
+
+        CNNNetwork network(function);
+        auto inputInfo = network.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(Precision::U8);
+        auto& preProcess = inputInfo->getPreProcess();
+        preProcess.init(inputShape[1]);
+        for (size_t c = 0; c < inputShape[1]; c++)
+            preProcess[c]->meanValue = 10.f * static_cast<float>(c + 1);
+        preProcess.setVariant(MEAN_VALUE);
+
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+        return PluginCache::get().ie()->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    }
+
+    void fillInput(InferRequest& request, size_t seed) {
+        auto input = request.GetBlob(inputName);
+        auto data = input->buffer().as<uint8_t*>();
+        for (size_t i = 0; i < input->size(); i++)
+            data[i] = static_cast<uint8_t>((i * 7 + seed * 31) % 256);
+    }
+
+    std::vector<float> getOutput(InferRequest& request) {
+        auto output = request.GetBlob(outputName);
+        auto data = output->cbuffer().as<const float*>();
+        return std::vector<float>(data, data + output->size());
+    }
+};
+
+TEST_F(PreprocessStageTest, pipelinedRequestsMatchDefaultPath) {
+    auto referenceNetwork = loadNetwork({});
+    auto network = loadNetwork({{CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, "2"}});
+
+    auto referenceRequest = referenceNetwork.CreateInferRequest();
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < requestsNum; i++)
+        requests.push_back(network.CreateInferRequest());
+
+    // every run gives the requests new data, so converted inputs kept from the previous run must be overwritten
+    for (size_t run = 0; run < runsNum; run++) {
+        for (size_t i = 0; i < requestsNum; i++) {
+            fillInput(requests[i], run * requestsNum + i);
+            requests[i].StartAsync();
+        }
+        for (size_t i = 0; i < requestsNum; i++) {
+            requests[i].Wait(InferRequest::WaitMode::RESULT_READY);
+
+            fillInput(referenceRequest, run * requestsNum + i);
+            referenceRequest.StartAsync();
+            referenceRequest.Wait(InferRequest::WaitMode::RESULT_READY);
+
+            auto expected = getOutput(referenceRequest);
+            auto actual = getOutput(requests[i]);
+            ASSERT_EQ(expected.size(), actual.size());
+            for (size_t j = 0; j < expected.size(); j++)
+                ASSERT_EQ(expected[j], actual[j]) << "run " << run << ", request " << i << ", element " << j;
+        }
+    }
+
+    // the mean value is subtracted, so the output is not a copy of the input
+    auto output = getOutput(requests[0]);
+    auto input = requests[0].GetBlob(inputName)->cbuffer().as<const uint8_t*>();
+    ASSERT_EQ(0.5f * (static_cast<float>(input[0]) - 10.f), output[0]);
+}
+
+TEST_F(PreprocessStageTest, stageLatenciesAreReported) {
+    auto network = loadNetwork({{CPUConfigParams::KEY_CPU_PREPROCESS_THREADS, "1"}});
+    std::vector<std::string> metrics = network.GetMetric(METRIC_KEY(SUPPORTED_METRICS));
+    ASSERT_NE(std::find(metrics.begin(), metrics.end(), CPU_METRIC_KEY(PIPELINE_STAGE_LATENCIES)), metrics.end());
+
+    auto request = network.CreateInferRequest();
+    for (size_t run = 0; run < runsNum; run++) {
+        fillInput(request, run);
+        request.StartAsync();
+        request.Wait(InferRequest::WaitMode::RESULT_READY);
+    }
+
+    std::map<std::string, float> latencies = network.GetMetric(CPU_METRIC_KEY(PIPELINE_STAGE_LATENCIES));
+    ASSERT_EQ(2u, latencies.size());
+    ASSERT_GT(latencies["PREPROCESS"], 0.f);
+    ASSERT_GT(latencies["INFER"], 0.f);
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
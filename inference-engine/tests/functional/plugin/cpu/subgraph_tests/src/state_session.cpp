@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+#include <ngraph/ngraph.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/*
+ *   Parameter    ReadValue
+ *       |            |
+ *       ---- Add -----
+ *             |
+ *     Assign, Relu
+ */
+class StateSessionTest : public testing::Test {
+protected:
+    static constexpr size_t channels = 8;
+    std::string inputName;
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    }
+
+    ExecutableNetwork loadAccumulator(size_t batch) {
+        Shape shape{batch, channels};
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+        auto init = std::make_shared<op::v0::Constant>(element::f32, shape, 0);
+        auto read = std::make_shared<op::v3::ReadValue>(init, "accumulator");
+        auto add = std::make_shared<op::v1::Add>(read, input);
+        auto assign = std::make_shared<op::v3::Assign>(add, "accumulator");
+        auto relu = std::make_shared<op::v0::Relu>(add);
+
+        // WA. Limitation of ngraph. control_dependency are required.
+        assign->add_control_dependency(read);
+        relu->add_control_dependency(assign);
+
+        auto function = std::make_shared<Function>(NodeVector{relu}, ParameterVector{input}, "Accumulator");
+        auto network = PluginCache::get().ie()->LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU);
+        inputName = network.GetInputsInfo().begin()->first;
+        return network;
+    }
+
+    void infer(InferRequest& request, const std::vector<float>& values) {
+        auto input = request.GetBlob(inputName);
+        auto data = input->buffer().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            data[i] = values[i / channels];
+        request.Infer();
+    }
+
+    static float stateValue(const StateSession::Ptr& session) {
+        return session->GetStates().begin()->second->cbuffer().as<const float*>()[0];
+    }
+};
+
+TEST_F(StateSessionTest, sessionsKeepIndependentStates) {
+    auto network = loadAccumulator(1);
+    auto request = network.CreateInferRequest();
+    auto first = request.CreateStateSession();
+    auto second = request.CreateStateSession();
+    ASSERT_EQ(0.f, stateValue(first));
+
+    request.SetStateSessions({first});
+    infer(request, {1.f});
+    infer(request, {1.f});
+    request.SetStateSessions({second});
+    infer(request, {5.f});
+    ASSERT_EQ(2.f, stateValue(first));
+    ASSERT_EQ(5.f, stateValue(second));
+
+    // any request of the network can run a step for the session
+    auto otherRequest = network.CreateInferRequest();
+    otherRequest.SetStateSessions({first});
+    infer(otherRequest, {1.f});
+    ASSERT_EQ(3.f, stateValue(first));
+
+    // unbound request returns to own states
+    request.SetStateSessions({});
+    infer(request, {7.f});
+    ASSERT_EQ(3.f, stateValue(first));
+    ASSERT_EQ(5.f, stateValue(second));
+}
+
+TEST_F(StateSessionTest, snapshotRestoresSessionState) {
+    auto network = loadAccumulator(1);
+    auto request = network.CreateInferRequest();
+    auto session = request.CreateStateSession();
+
+    request.SetStateSessions({session});
+    infer(request, {1.f});
+    auto snapshot = session->Snapshot();
+    infer(request, {1.f});
+    ASSERT_EQ(2.f, stateValue(session));
+
+    session->Restore(snapshot);
+    ASSERT_EQ(1.f, stateValue(session));
+    session->Reset();
+    ASSERT_EQ(0.f, stateValue(session));
+}
+
+TEST_F(StateSessionTest, sessionsAreInferredAsBatch) {
+    auto network = loadAccumulator(2);
+    auto request = network.CreateInferRequest();
+    auto first = request.CreateStateSession();
+    auto second = request.CreateStateSession();
+    auto third = request.CreateStateSession();
+    ASSERT_THROW(request.SetStateSessions({first, second, third}), Exception);
+
+    request.SetStateSessions({first, second});
+    infer(request, {1.f, 2.f});
+    request.SetStateSessions({second, first});
+    infer(request, {1.f, 2.f});
+    ASSERT_EQ(3.f, stateValue(first));
+    ASSERT_EQ(3.f, stateValue(second));
+}
+
+}  // namespace CPUSubgraphTestsDefinitions
@@ -41,4 +41,8 @@ struct HeteroSyntheticTest : public testing::WithParamInterface<HeteroSyntheticT
     std::vector<std::string> _registredPlugins;
 };
 
+struct HeteroSyntheticMinLatencyTest : public HeteroSyntheticTest {
+    static std::vector<FunctionParameter> _withoutAffinityFunctions;
+};
+
 }  //  namespace HeteroTests
@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, latencyPolicyRunsRequestsOnAllDevicesUnderLoad) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MULTI_CONFIG_KEY(SCHEDULING_POLICY), InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY}});
+
+    // twice as many requests as the devices run in parallel, so some of them always wait for a vacant device request
+    auto numRequests = 2 * exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; i++) {
+        requests.push_back(exec_net.CreateInferRequest());
+    }
+    constexpr std::uint64_t iterations = 10;
+    for (std::uint64_t i = 0; i < iterations; i++) {
+        for (auto&& request : requests) {
+            ASSERT_NO_THROW(request.StartAsync());
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(InferRequest::RESULT_READY));
+        }
+    }
+
+    auto deviceRequests = exec_net.GetMetric(MULTI_METRIC_KEY(DEVICE_REQUESTS)).as<std::map<std::string, uint64_t>>();
+    ASSERT_EQ(GetParam().size(), deviceRequests.size());
+    std::uint64_t completed = 0;
+    for (auto&& device : GetParam()) {
+        ASSERT_NE(deviceRequests.end(), deviceRequests.find(device));
+        // the device that is not measured yet gets the requests the busy device can't start right away
+        ASSERT_LT(0u, deviceRequests[device]) << device;
+        completed += deviceRequests[device];
+    }
+    ASSERT_EQ(iterations * numRequests, completed);
+}
@@ -7,6 +7,10 @@
 #include <ngraph/variant.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <hetero/hetero_plugin_config.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <random>
 namespace HeteroTests {
 
@@ -61,6 +65,14 @@ std::vector<FunctionParameter> HeteroSyntheticTest::_randomMajorNodeFunctions{[]
     return results;
 } ()};
 
+std::vector<FunctionParameter> HeteroSyntheticMinLatencyTest::_withoutAffinityFunctions{[] {
+    std::vector<FunctionParameter> result;
+    for (auto&& builder : builders) {
+        result.push_back(FunctionParameter{{}, builder()});
+    }
+    return result;
+} ()};
+
 std::string HeteroSyntheticTest::getTestCaseName(const ::testing::TestParamInfo<HeteroSyntheticTestParameters>& obj) {
     std::vector<PluginParameter> pluginParameters;
     FunctionParameter functionParamter;
@@ -149,4 +161,60 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticMinLatencyTest, allLayersToFastestDevice) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    auto slowestDevice = pluginParameters.at(0)._name;
+    auto fastestDevice = pluginParameters.at(1)._name;
+    configuration = {
+        {HETERO_CONFIG_KEY(AFFINITY_POLICY), HETERO_CONFIG_VALUE(MIN_LATENCY)},
+        {HETERO_CONFIG_KEY(DEVICE_GFLOPS), slowestDevice + ":10," + fastestDevice + ":1000"},
+        {HETERO_CONFIG_KEY(DUMP_PARTITION), CONFIG_VALUE(YES)}
+    };
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        auto name = function->get_friendly_name();
+        std::ifstream report{"hetero_partition_" + name + ".txt"};
+        ASSERT_TRUE(report.is_open());
+        std::string header, subgraph, device;
+        std::getline(report, header);
+        std::size_t subgraphs = 0;
+        while (report >> subgraph >> device && subgraph != "total") {
+            ASSERT_EQ(fastestDevice, device);
+            std::getline(report, header);
+            ++subgraphs;
+        }
+        report.close();
+        ASSERT_EQ(1u, subgraphs);
+        std::remove(("hetero_partition_" + name + ".txt").c_str());
+    }
+}
+
+TEST_P(HeteroSyntheticMinLatencyTest, unknownDevicePerformanceFallsBackToPriority) {
+    auto& pluginParameters = std::get<Plugin>(GetParam());
+    auto firstDevice = pluginParameters.at(0)._name;
+    auto fastestDevice = pluginParameters.at(1)._name;
+    configuration = {
+        {HETERO_CONFIG_KEY(AFFINITY_POLICY), HETERO_CONFIG_VALUE(MIN_LATENCY)},
+        {HETERO_CONFIG_KEY(DEVICE_GFLOPS), fastestDevice + ":1000"},
+        {HETERO_CONFIG_KEY(DUMP_PARTITION), CONFIG_VALUE(YES)},
+        {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), CONFIG_VALUE(YES)}
+    };
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        auto name = function->get_friendly_name();
+        // all layers are supported by the first device, so it executes the whole network
+        std::ifstream affinities{"hetero_affinity_" + name + ".dot"};
+        ASSERT_TRUE(affinities.is_open());
+        std::string dot{std::istreambuf_iterator<char>{affinities}, std::istreambuf_iterator<char>{}};
+        affinities.close();
+        ASSERT_NE(std::string::npos, dot.find("device=" + firstDevice));
+        ASSERT_EQ(std::string::npos, dot.find("device=" + fastestDevice));
+
+        std::ifstream report{"hetero_partition_" + name + ".txt"};
+        ASSERT_FALSE(report.is_open());
+        std::remove(("hetero_affinity_" + name + ".dot").c_str());
+        std::remove(("hetero_subgraphs_" + name + ".dot").c_str());
+    }
+}
+
 }  //  namespace HeteroTests
@@ -24,8 +24,12 @@ public:
     MOCK_METHOD3(SetBlob, void(const std::string&, const InferenceEngine::Blob::Ptr &, const InferenceEngine::PreProcessInfo&));
     MOCK_CONST_METHOD1(GetPreProcess, const InferenceEngine::PreProcessInfo&(const std::string&));
     MOCK_METHOD1(SetCallback, void(std::function<void(std::exception_ptr)>));
+    MOCK_METHOD1(SetInlineCallback, void(bool));
+    MOCK_METHOD2(SetPriority, void(InferenceEngine::InferRequest::Priority, std::chrono::milliseconds));
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IVariableStateInternal::Ptr>());
+    MOCK_METHOD0(CreateStateSession, InferenceEngine::StateSession::Ptr());
+    MOCK_METHOD1(SetStateSessions, void(const std::vector<InferenceEngine::StateSession::Ptr>&));
     MOCK_METHOD0(Cancel, void());
     MOCK_METHOD0(StartAsyncImpl, void());
     MOCK_METHOD0(InferImpl, void());
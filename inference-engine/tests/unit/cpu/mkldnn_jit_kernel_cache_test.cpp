@@ -0,0 +1,191 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "common_test_utils/file_utils.hpp"
+#include "mkldnn_jit_kernel_cache.h"
+
+using MKLDNNPlugin::MKLDNNJitKernelCache;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+struct TestKernel {
+    virtual ~TestKernel() = default;
+    virtual void create_ker() {
+        compiled++;
+    }
+
+    void (*ker_)() = nullptr;
+    int compiled = 0;
+};
+
+TestKernel* createTestKernel() {
+    return new TestKernel();
+}
+
+struct TestJitKernelBase {
+    virtual ~TestJitKernelBase() = default;
+    virtual void create_ker() = 0;
+
+    void (*ker_)(float*) = nullptr;
+};
+
+// writes a constant from its own table, so the loaded code works only if the table address was relocated
+struct TestJitKernel : public TestJitKernelBase, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(TestJitKernel)
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+        generated++;
+    }
+
+    void generate() override {
+        mov(rax, l_table);
+        mov(ecx, ptr[rax]);
+        mov(ptr[abi_param1], ecx);
+        ret();
+
+        align(64);
+        L(l_table);
+        dd(0x40490fdb);  // 3.14159274f
+    }
+
+    Xbyak::Label l_table;
+
+    static int generated;
+};
+
+int TestJitKernel::generated = 0;
+
+TestJitKernelBase* createTestJitKernel() {
+    return new TestJitKernel();
+}
+
+class JitKernelCachePersistenceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!mayiuse(sse41))
+            GTEST_SKIP();
+
+        directory = "JitKernelCachePersistenceTest_" + std::to_string(testing::UnitTest::GetInstance()->random_seed());
+        CommonTestUtils::createDirectory(directory);
+        MKLDNNJitKernelCache::getInstance().setPersistentDirectory(directory);
+    }
+
+    void TearDown() override {
+        MKLDNNJitKernelCache::getInstance().setPersistentDirectory("");
+        CommonTestUtils::removeFilesWithExt(directory, "kernel");
+        CommonTestUtils::removeFilesWithExt(directory, "tmp");
+        CommonTestUtils::removeDir(directory);
+    }
+
+    std::string directory;
+};
+
+}  // namespace
+
+TEST(JitKernelCacheTest, KeyContainsAllParameters) {
+    auto key = MKLDNNJitKernelCache::makeKey("permute", 1, true, std::vector<size_t>{2, 3}, 4);
+    ASSERT_EQ("permute,1,1,[2 3 ],4", key);
+    ASSERT_NE(key, MKLDNNJitKernelCache::makeKey("permute", 1, true, std::vector<size_t>{2}, 3, 4));
+}
+
+TEST(JitKernelCacheTest, SameKeyReturnsCompiledKernel) {
+    auto& cache = MKLDNNJitKernelCache::getInstance();
+    auto before = cache.getStatistics();
+
+    auto key = MKLDNNJitKernelCache::makeKey("JitKernelCacheTest.SameKey");
+    auto first = cache.getOrCreate<TestKernel>(key, createTestKernel);
+    auto second = cache.getOrCreate<TestKernel>(key, createTestKernel);
+    auto other = cache.getOrCreate<TestKernel>(key + "_other", createTestKernel);
+
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(1, first->compiled);
+    ASSERT_EQ(1, other->compiled);
+
+    auto after = cache.getStatistics();
+    ASSERT_EQ(before.hits + 1, after.hits);
+    ASSERT_EQ(before.misses + 2, after.misses);
+}
+
+TEST(JitKernelCacheTest, ReleasedKernelIsCompiledAgain) {
+    auto& cache = MKLDNNJitKernelCache::getInstance();
+    auto key = MKLDNNJitKernelCache::makeKey("JitKernelCacheTest.Released");
+
+    std::weak_ptr<TestKernel> released = cache.getOrCreate<TestKernel>(key, createTestKernel);
+    ASSERT_TRUE(released.expired());
+
+    auto kernel = cache.getOrCreate<TestKernel>(key, createTestKernel);
+    ASSERT_NE(nullptr, kernel);
+    ASSERT_EQ(1, kernel->compiled);
+}
+
+TEST_F(JitKernelCachePersistenceTest, ReleasedKernelIsLoadedFromDirectory) {
+    auto& cache = MKLDNNJitKernelCache::getInstance();
+    auto key = MKLDNNJitKernelCache::makeKey("JitKernelCachePersistenceTest.Loaded");
+
+    const int generatedBefore = TestJitKernel::generated;
+    {
+        auto compiled = cache.getOrCreate<TestJitKernelBase>(key, createTestJitKernel);
+        float result = 0.f;
+        compiled->ker_(&result);
+        ASSERT_EQ(3.14159274f, result);
+    }
+    // the kernel is compiled the second time to find its absolute addresses
+    ASSERT_EQ(generatedBefore + 2, TestJitKernel::generated);
+    ASSERT_EQ(1, CommonTestUtils::listFilesWithExt(directory, "kernel").size());
+
+    auto before = cache.getStatistics();
+    auto loaded = cache.getOrCreate<TestJitKernelBase>(key, createTestJitKernel);
+    auto after = cache.getStatistics();
+    ASSERT_EQ(before.loads + 1, after.loads);
+    ASSERT_EQ(before.misses, after.misses);
+    ASSERT_EQ(generatedBefore + 2, TestJitKernel::generated);
+
+    float result = 0.f;
+    loaded->ker_(&result);
+    ASSERT_EQ(3.14159274f, result);
+}
+
+TEST_F(JitKernelCachePersistenceTest, KernelOfOtherVersionIsCompiled) {
+    auto& cache = MKLDNNJitKernelCache::getInstance();
+    auto key = MKLDNNJitKernelCache::makeKey("JitKernelCachePersistenceTest.OtherVersion");
+
+    cache.getOrCreate<TestJitKernelBase>(key, createTestJitKernel);
+    auto files = CommonTestUtils::listFilesWithExt(directory, "kernel");
+    ASSERT_EQ(1, files.size());
+
+    // the second line of the file identifies versions of the libraries and ISA
+    std::string content;
+    {
+        std::ifstream file(files[0], std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const auto tagBegin = content.find('\n') + 1;
+    const auto tagEnd = content.find('\n', tagBegin);
+    content.replace(tagBegin, tagEnd - tagBegin, "plugin 0;onednn 0.0.0 stale;sse41");
+    {
+        std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+        file << content;
+    }
+
+    auto before = cache.getStatistics();
+    auto kernel = cache.getOrCreate<TestJitKernelBase>(key, createTestJitKernel);
+    auto after = cache.getStatistics();
+    ASSERT_EQ(before.loads, after.loads);
+    ASSERT_EQ(before.misses + 1, after.misses);
+
+    float result = 0.f;
+    kernel->ker_(&result);
+    ASSERT_EQ(3.14159274f, result);
+}
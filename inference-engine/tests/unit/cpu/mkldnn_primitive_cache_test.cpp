@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "mkldnn_primitive_cache.h"
+
+using MKLDNNPlugin::MKLDNNPrimitiveCache;
+
+namespace {
+
+struct PrimitiveFactory {
+    MKLDNNPrimitiveCache::PrimitivePtr operator()() {
+        created++;
+        return std::make_shared<mkldnn::primitive>();
+    }
+
+    int created = 0;
+};
+
+}  // namespace
+
+TEST(PrimitiveCacheTest, SameKeyReturnsCreatedPrimitive) {
+    MKLDNNPrimitiveCache cache(4);
+    PrimitiveFactory factory;
+
+    auto first = cache.getOrCreate("conv", std::ref(factory));
+    auto second = cache.getOrCreate("conv", std::ref(factory));
+
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(1, factory.created);
+    ASSERT_EQ(1u, cache.getStatistics().hits);
+    ASSERT_EQ(1u, cache.getStatistics().misses);
+}
+
+TEST(PrimitiveCacheTest, LeastRecentlyUsedPrimitiveIsEvicted) {
+    MKLDNNPrimitiveCache cache(2);
+    PrimitiveFactory factory;
+
+    auto conv = cache.getOrCreate("conv", std::ref(factory));
+    cache.getOrCreate("pool", std::ref(factory));
+    cache.getOrCreate("conv", std::ref(factory));
+    cache.getOrCreate("lrn", std::ref(factory));
+
+    ASSERT_EQ(2u, cache.size());
+    ASSERT_EQ(1u, cache.getStatistics().evictions);
+    ASSERT_EQ(conv, cache.getOrCreate("conv", std::ref(factory)));
+
+    cache.getOrCreate("pool", std::ref(factory));
+    ASSERT_EQ(4, factory.created);
+    ASSERT_EQ(2u, cache.getStatistics().evictions);
+}
+
+TEST(PrimitiveCacheTest, CapacityReductionEvictsPrimitives) {
+    MKLDNNPrimitiveCache cache(4);
+    PrimitiveFactory factory;
+
+    cache.getOrCreate("conv", std::ref(factory));
+    cache.getOrCreate("pool", std::ref(factory));
+    cache.getOrCreate("lrn", std::ref(factory));
+
+    cache.setCapacity(1);
+    ASSERT_EQ(1u, cache.size());
+    ASSERT_EQ(2u, cache.getStatistics().evictions);
+
+    cache.setCapacity(0);
+    ASSERT_EQ(0u, cache.size());
+    cache.getOrCreate("conv", std::ref(factory));
+    cache.getOrCreate("conv", std::ref(factory));
+    ASSERT_EQ(0u, cache.size());
+    ASSERT_EQ(5, factory.created);
+}
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "utils/numa_memory.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+
+uint64_t placedBytes(const std::map<int, uint64_t>& placement) {
+    return std::accumulate(placement.begin(), placement.end(), uint64_t(0),
+                           [](uint64_t sum, const std::pair<const int, uint64_t>& node) { return sum + node.second; });
+}
+
+}  // namespace
+
+TEST(NumaMemoryTest, TouchedBufferIsPlacedCompletely) {
+    // odd size and offset, so the buffer starts and ends in the middle of pages
+    std::vector<uint8_t> buffer(3 * 4096 + 100);
+    const size_t size = buffer.size() - 7;
+
+    firstTouchMemory(buffer.data() + 7, size);
+
+    ASSERT_EQ(size, placedBytes(getMemoryPlacement(buffer.data() + 7, size)));
+}
+
+TEST(NumaMemoryTest, EmptyBufferHasNoPlacement) {
+    firstTouchMemory(nullptr, 0);
+    ASSERT_TRUE(getMemoryPlacement(nullptr, 0).empty());
+}
+
+TEST(NumaMemoryTest, HugePagesAreNotAdvisedForSmallBuffers) {
+    std::vector<uint8_t> buffer(4096);
+    ASSERT_FALSE(adviseHugePages(buffer.data(), buffer.size()));
+}
@@ -0,0 +1,176 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include <ie_common.h>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset7.hpp>
+
+#include "hetero_partitioning.hpp"
+
+using namespace HeteroPlugin;
+
+namespace {
+
+using SupportedDevices = std::unordered_map<ngraph::Node*, std::vector<std::string>>;
+
+struct ReluConvRelu {
+    // Relu -> Convolution -> Relu chain. The convolution takes about 3 MFLOP,
+    // its input and output transfers cost much less on a fast device.
+    ReluConvRelu() {
+        using namespace ngraph;
+        auto parameter = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 32, 32});
+        relu1 = std::make_shared<opset7::Relu>(parameter);
+        relu1->set_friendly_name("relu1");
+        auto weights = opset7::Constant::create(element::f32, Shape{64, 3, 3, 3}, {1.f});
+        conv = std::make_shared<opset7::Convolution>(relu1, weights, Strides{1, 1},
+                                                     CoordinateDiff{0, 0}, CoordinateDiff{0, 0}, Strides{1, 1});
+        conv->set_friendly_name("conv");
+        relu2 = std::make_shared<opset7::Relu>(conv);
+        relu2->set_friendly_name("relu2");
+        auto result = std::make_shared<opset7::Result>(relu2);
+        function = std::make_shared<Function>(ResultVector{result}, ParameterVector{parameter});
+    }
+
+    std::shared_ptr<ngraph::Node> relu1, conv, relu2;
+    std::shared_ptr<ngraph::Function> function;
+};
+
+struct ReluChain {
+    // Three cheap elementwise layers, a transfer costs more than any of them
+    ReluChain() {
+        using namespace ngraph;
+        auto parameter = std::make_shared<opset7::Parameter>(element::f32, Shape{1, 3, 8, 8});
+        std::shared_ptr<Node> last = parameter;
+        for (auto&& name : {"relu1", "relu2", "relu3"}) {
+            last = std::make_shared<opset7::Relu>(last);
+            last->set_friendly_name(name);
+            relus.push_back(last);
+        }
+        auto result = std::make_shared<opset7::Result>(last);
+        function = std::make_shared<Function>(ResultVector{result}, ParameterVector{parameter});
+    }
+
+    std::vector<std::shared_ptr<ngraph::Node>> relus;
+    std::shared_ptr<ngraph::Function> function;
+};
+
+CostModel MakeCostModel(const std::string& deviceGflops) {
+    return CostModel{{{HETERO_CONFIG_KEY(DEVICE_GFLOPS), deviceGflops}}};
+}
+
+}  // namespace
+
+TEST(HeteroCostModelTest, throwsOnWrongDeviceGflops) {
+    ASSERT_THROW(MakeCostModel("A"), InferenceEngine::Exception);
+    ASSERT_THROW(MakeCostModel(":100"), InferenceEngine::Exception);
+    ASSERT_THROW(MakeCostModel("A:0"), InferenceEngine::Exception);
+    ASSERT_THROW(MakeCostModel("A:fast"), InferenceEngine::Exception);
+    ASSERT_NO_THROW(MakeCostModel("A:100,B:0.5"));
+}
+
+TEST(HeteroCostModelTest, computeCostIsInverseToDeviceGflops) {
+    ReluConvRelu net;
+    auto costModel = MakeCostModel("A:1000,B:10");
+    auto fast = costModel.ComputeCost(net.conv.get(), "A");
+    auto slow = costModel.ComputeCost(net.conv.get(), "B");
+    ASSERT_GT(fast, 0.);
+    ASSERT_DOUBLE_EQ(100., slow / fast);
+}
+
+TEST(HeteroCostModelTest, costOfDeviceWithoutGflopsIsUnknown) {
+    ReluConvRelu net;
+    auto costModel = MakeCostModel("A:1000");
+    ASSERT_TRUE(costModel.IsDefinedFor("A"));
+    ASSERT_FALSE(costModel.IsDefinedFor("B"));
+    ASSERT_FALSE(CostModel{{}}.IsDefinedFor("A"));
+    ASSERT_THROW(costModel.ComputeCost(net.conv.get(), "B"), InferenceEngine::Exception);
+}
+
+TEST(HeteroCostModelTest, transferCostGrowsWithTensorSize) {
+    ReluConvRelu net;
+    CostModel costModel{{}};
+    auto small = costModel.TransferCost(net.relu1->output(0));
+    auto large = costModel.TransferCost(net.conv->output(0));
+    ASSERT_GT(small, 0.);
+    ASSERT_GT(large, small);
+}
+
+TEST(HeteroMinimizeLatencyTest, allLayersToFastestDevice) {
+    ReluConvRelu net;
+    SupportedDevices supported;
+    for (auto&& node : {net.relu1, net.conv, net.relu2}) {
+        supported[node.get()] = {"A", "B"};
+    }
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:10,B:1000"), 0);
+    std::map<std::string, std::string> expected = {{"relu1", "B"}, {"conv", "B"}, {"relu2", "B"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST(HeteroMinimizeLatencyTest, cheapLayerStaysWithNeighboursToAvoidTransfers) {
+    ReluChain net;
+    SupportedDevices supported = {
+        {net.relus[0].get(), {"B"}},
+        {net.relus[1].get(), {"A", "B"}},
+        {net.relus[2].get(), {"B"}},
+    };
+    // relu2 is faster on A, but two transfers cost more than the saved time
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:1000,B:100"), 0);
+    ASSERT_EQ("B", affinities.at("relu2"));
+}
+
+TEST(HeteroMinimizeLatencyTest, heavyLayerMovesToFastDeviceDespiteTransfers) {
+    ReluConvRelu net;
+    SupportedDevices supported = {
+        {net.relu1.get(), {"B"}},
+        {net.conv.get(), {"A", "B"}},
+        {net.relu2.get(), {"B"}},
+    };
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:1000,B:1"), 1);
+    std::map<std::string, std::string> expected = {{"relu1", "B"}, {"conv", "A"}, {"relu2", "B"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST(HeteroMinimizeLatencyTest, smallIslandIsMergedIntoNeighbourDevice) {
+    ReluConvRelu net;
+    SupportedDevices supported = {
+        {net.relu1.get(), {"B"}},
+        {net.conv.get(), {"A", "B"}},
+        {net.relu2.get(), {"B"}},
+    };
+    // the same partition as above, but the single layer subgraph on A is smaller than the minimal size
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:1000,B:1"), 3);
+    std::map<std::string, std::string> expected = {{"relu1", "B"}, {"conv", "B"}, {"relu2", "B"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST(HeteroMinimizeLatencyTest, islandIsNotMergedIntoDeviceWhichDoesNotSupportIt) {
+    ReluConvRelu net;
+    SupportedDevices supported = {
+        {net.relu1.get(), {"B"}},
+        {net.conv.get(), {"A"}},
+        {net.relu2.get(), {"B"}},
+    };
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:1000,B:1"), 3);
+    std::map<std::string, std::string> expected = {{"relu1", "B"}, {"conv", "A"}, {"relu2", "B"}};
+    ASSERT_EQ(expected, affinities);
+}
+
+TEST(HeteroMinimizeLatencyTest, layersWithoutSupportedDevicesAreNotAssigned) {
+    ReluChain net;
+    SupportedDevices supported = {
+        {net.relus[0].get(), {"A"}},
+        {net.relus[2].get(), {"A"}},
+    };
+    auto affinities = MinimizeLatency(net.function->get_ordered_ops(), supported, MakeCostModel("A:100"), 0);
+    std::map<std::string, std::string> expected = {{"relu1", "A"}, {"relu3", "A"}};
+    ASSERT_EQ(expected, affinities);
+}
@@ -388,6 +388,35 @@ TEST_F(InferRequestTests, canForwardAnyCallback) {
     ASSERT_NO_THROW(request.SetCompletionCallback([] {}));
 }
 
+TEST_F(InferRequestTests, canSetPriority) {
+    EXPECT_CALL(*mock_request.get(), SetPriority(InferRequest::LOW, std::chrono::milliseconds{5}));
+    ASSERT_NO_THROW(request.SetPriority(InferRequest::LOW, std::chrono::milliseconds{5}));
+}
+
+TEST_F(InferRequestTests, failToSetOutOfRangePriority) {
+    EXPECT_CALL(*mock_request.get(), SetPriority(_, _)).Times(0);
+    ASSERT_THROW(request.SetPriority(static_cast<InferRequest::Priority>(InferRequest::LOW + 1)), Exception);
+    ASSERT_THROW(request.SetPriority(static_cast<InferRequest::Priority>(-1)), Exception);
+}
+
+TEST_F(InferRequestTests, failToSetNegativeDeadline) {
+    EXPECT_CALL(*mock_request.get(), SetPriority(_, _)).Times(0);
+    ASSERT_THROW(request.SetPriority(InferRequest::HIGH, std::chrono::milliseconds{-1}), Exception);
+}
+
+TEST_F(InferRequestTests, callbackSetAfterInlineCompletionQueueIsNotInline) {
+    auto queue = std::make_shared<CompletionQueue>();
+    {
+        InSequence s;
+        EXPECT_CALL(*mock_request.get(), SetInlineCallback(true));
+        EXPECT_CALL(*mock_request.get(), SetCallback(_));
+        EXPECT_CALL(*mock_request.get(), SetInlineCallback(false));
+        EXPECT_CALL(*mock_request.get(), SetCallback(_));
+    }
+    ASSERT_NO_THROW(request.SetCompletionQueue(queue, nullptr, true));
+    ASSERT_NO_THROW(request.SetCompletionCallback([] {}));
+}
+
 TEST_F(InferRequestTests, failToSetInputWithInCorrectName) {
     EXPECT_CALL(*mock_request.get(), SetBlob(_, _)).WillOnce(Throw(NotFound{""}));
     auto blobMap = getBlobMapWithIncorrectName();
@@ -47,6 +47,15 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct SchedulingRecordingExecutor : public DeferedExecutor {
+    void runScheduled(Task task, const TaskScheduling& scheduling) override {
+        schedulings.push_back(scheduling);
+        run(std::move(task));
+    }
+
+    std::vector<TaskScheduling> schedulings;
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<AsyncInferRequestThreadSafeDefault> testRequest;
@@ -187,6 +196,70 @@ TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledIfAsyncRequestFailed)
     ASSERT_NE(nullptr, exceptionPtr);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, inlineCallbackBypassesCallbackExecutor) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    auto callbackExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, callbackExecutor);
+    bool called = false;
+    testRequest->SetCallback([&](std::exception_ptr) {
+        called = true;
+    });
+    testRequest->SetInlineCallback(true);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    ASSERT_TRUE(called);
+    ASSERT_TRUE(callbackExecutor->tasks.empty());
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::STATUS_ONLY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetInlineCallback) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetInlineCallback(true), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetStateSessions) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    EXPECT_CALL(*mockInferRequestInternal, SetStateSessions(_)).Times(0);
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetStateSessions({}), RequestBusy);
+    taskExecutor->executeAll();
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, priorityAndDeadlineArePassedToStageExecutors) {
+    auto taskExecutor = std::make_shared<SchedulingRecordingExecutor>();
+    auto callbackExecutor = std::make_shared<SchedulingRecordingExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, callbackExecutor);
+    testRequest->SetPriority(InferRequest::HIGH, std::chrono::milliseconds{10});
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    const auto start = std::chrono::steady_clock::now();
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    callbackExecutor->executeAll();
+    ASSERT_EQ(OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+
+    ASSERT_EQ(1u, taskExecutor->schedulings.size());
+    ASSERT_EQ(1u, callbackExecutor->schedulings.size());
+    ASSERT_EQ(TaskScheduling::HIGH, taskExecutor->schedulings.front().priority);
+    ASSERT_GE(taskExecutor->schedulings.front().deadline, start + std::chrono::milliseconds{10});
+    ASSERT_EQ(taskExecutor->schedulings.front().deadline, callbackExecutor->schedulings.front().deadline);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, returnRequestBusyOnSetPriority) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal, InferImpl()).Times(1).WillOnce(Return());
+    ASSERT_NO_THROW(testRequest->StartAsync());
+    ASSERT_THROW(testRequest->SetPriority(InferRequest::LOW, std::chrono::milliseconds::zero()), RequestBusy);
+    taskExecutor->executeAll();
+}
+
 TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailedAndNoCallback) {
     auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
     testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
@@ -0,0 +1,89 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <cpp/ie_completion_queue.hpp>
+
+#ifdef __linux__
+# include <poll.h>
+#endif
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+TEST(CompletionQueueTests, drainReturnsNothingForEmptyQueue) {
+    CompletionQueue queue;
+    CompletionQueue::Completion completions[4];
+    ASSERT_EQ(0, queue.Drain(completions, 4));
+    ASSERT_EQ(0, queue.Size());
+}
+
+TEST(CompletionQueueTests, drainReturnsCompletionsInPostOrder) {
+    CompletionQueue queue;
+    int tags[3];
+    for (auto& tag : tags) {
+        CompletionQueue::Completion completion;
+        completion.userData = &tag;
+        completion.status = &tag == &tags[1] ? GENERAL_ERROR : OK;
+        queue.Post(completion);
+    }
+    ASSERT_EQ(3, queue.Size());
+
+    CompletionQueue::Completion completions[2];
+    ASSERT_EQ(2, queue.Drain(completions, 2));
+    ASSERT_EQ(&tags[0], completions[0].userData);
+    ASSERT_EQ(OK, completions[0].status);
+    ASSERT_EQ(&tags[1], completions[1].userData);
+    ASSERT_EQ(GENERAL_ERROR, completions[1].status);
+
+    ASSERT_EQ(1, queue.Drain(completions, 2));
+    ASSERT_EQ(&tags[2], completions[0].userData);
+    ASSERT_EQ(0, queue.Size());
+}
+
+TEST(CompletionQueueTests, throwsOnNullOutputArray) {
+    CompletionQueue queue;
+    ASSERT_THROW(queue.Drain(nullptr, 1), InferenceEngine::Exception);
+}
+
+TEST(CompletionQueueTests, canPostFromSeveralThreads) {
+    CompletionQueue queue;
+    const size_t threadsNum = 4, postsNum = 100;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < postsNum; i++)
+                queue.Post({});
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<CompletionQueue::Completion> completions(threadsNum * postsNum);
+    ASSERT_EQ(threadsNum * postsNum, queue.Drain(completions.data(), completions.size()));
+}
+
+#ifdef __linux__
+TEST(CompletionQueueTests, notificationHandleIsReadableWhileQueueIsNotEmpty) {
+    CompletionQueue queue;
+    pollfd fd = {queue.GetNotificationHandle(), POLLIN, 0};
+    ASSERT_GE(fd.fd, 0);
+    ASSERT_EQ(0, poll(&fd, 1, 0));
+
+    queue.Post({});
+    queue.Post({});
+    ASSERT_EQ(1, poll(&fd, 1, 0));
+
+    CompletionQueue::Completion completion;
+    ASSERT_EQ(1, queue.Drain(&completion, 1));
+    ASSERT_EQ(1, poll(&fd, 1, 0));
+
+    ASSERT_EQ(1, queue.Drain(&completion, 1));
+    ASSERT_EQ(0, poll(&fd, 1, 0));
+}
+#endif
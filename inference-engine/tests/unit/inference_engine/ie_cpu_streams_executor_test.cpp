@@ -0,0 +1,131 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <threading/ie_cpu_streams_executor.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+namespace {
+
+// Occupies the only stream of the executor, so the next tasks are queued until release() is called
+struct StreamBlocker {
+    explicit StreamBlocker(ITaskExecutor& executor) {
+        executor.run([this] {
+            started.set_value();
+            released.get_future().wait();
+        });
+        started.get_future().wait();
+    }
+
+    void release() {
+        // lets the queued tasks age, so the queueing delays are not zero
+        this_thread::sleep_for(chrono::milliseconds{1});
+        released.set_value();
+    }
+
+    promise<void> started;
+    promise<void> released;
+};
+
+struct ExecutionOrder {
+    Task record(int id) {
+        return [this, id] {
+            lock_guard<mutex> lock{guard};
+            ids.push_back(id);
+        };
+    }
+
+    mutex guard;
+    vector<int> ids;
+};
+
+TaskScheduling makeScheduling(TaskScheduling::Priority priority,
+                              chrono::steady_clock::time_point deadline = chrono::steady_clock::time_point::max()) {
+    TaskScheduling scheduling;
+    scheduling.priority = priority;
+    scheduling.deadline = deadline;
+    return scheduling;
+}
+
+// the least urgent task is run after all tasks queued before it
+void waitAll(ITaskExecutor& executor) {
+    promise<void> done;
+    executor.runScheduled([&done] { done.set_value(); }, makeScheduling(TaskScheduling::LOW));
+    done.get_future().wait();
+}
+
+}  // namespace
+
+TEST(CPUStreamsExecutorTests, queuedTasksRunByPriorityClass) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"PriorityTest", 1, 1}};
+    ExecutionOrder order;
+    StreamBlocker blocker{executor};
+
+    executor.runScheduled(order.record(0), makeScheduling(TaskScheduling::LOW));
+    executor.run(order.record(1));
+    executor.runScheduled(order.record(2), makeScheduling(TaskScheduling::HIGH));
+    executor.runScheduled(order.record(3), makeScheduling(TaskScheduling::HIGH));
+    blocker.release();
+    waitAll(executor);
+
+    ASSERT_EQ((vector<int>{2, 3, 1, 0}), order.ids);
+}
+
+TEST(CPUStreamsExecutorTests, queuedTasksOfOneClassRunByEarliestDeadline) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"DeadlineTest", 1, 1}};
+    ExecutionOrder order;
+    StreamBlocker blocker{executor};
+
+    const auto now = chrono::steady_clock::now();
+    executor.runScheduled(order.record(0), makeScheduling(TaskScheduling::NORMAL));
+    executor.runScheduled(order.record(1), makeScheduling(TaskScheduling::NORMAL, now + chrono::seconds{2}));
+    executor.runScheduled(order.record(2), makeScheduling(TaskScheduling::NORMAL, now + chrono::seconds{1}));
+    blocker.release();
+    waitAll(executor);
+
+    ASSERT_EQ((vector<int>{2, 1, 0}), order.ids);
+}
+
+TEST(CPUStreamsExecutorTests, starvingTaskRunsFirst) {
+    IStreamsExecutor::Config config{"StarvationTest", 1, 1};
+    config._taskStarvationTimeout = chrono::milliseconds::zero();
+    CPUStreamsExecutor executor{config};
+    ExecutionOrder order;
+    StreamBlocker blocker{executor};
+
+    executor.runScheduled(order.record(0), makeScheduling(TaskScheduling::LOW));
+    executor.runScheduled(order.record(1), makeScheduling(TaskScheduling::HIGH));
+    blocker.release();
+    waitAll(executor);
+
+    ASSERT_EQ((vector<int>{0, 1}), order.ids);
+}
+
+TEST(CPUStreamsExecutorTests, queueingDelaysAreCountedPerPriorityClass) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"QueueingDelayTest", 1, 1}};
+    StreamBlocker blocker{executor};
+
+    executor.runScheduled([] {}, makeScheduling(TaskScheduling::HIGH));
+    executor.runScheduled([] {}, makeScheduling(TaskScheduling::LOW));
+    executor.runScheduled([] {}, makeScheduling(TaskScheduling::LOW));
+    blocker.release();
+    waitAll(executor);
+
+    const auto delays = executor.GetQueueingDelays();
+    ASSERT_EQ(static_cast<size_t>(TaskScheduling::priorities), delays.size());
+    ASSERT_EQ(1u, delays[TaskScheduling::HIGH]._tasks);
+    // two tasks and the task of waitAll()
+    ASSERT_EQ(3u, delays[TaskScheduling::LOW]._tasks);
+    ASSERT_GT(delays[TaskScheduling::LOW]._total.count(), 0);
+    ASSERT_GE(delays[TaskScheduling::LOW]._total, delays[TaskScheduling::LOW]._max);
+}
@@ -36,3 +36,64 @@ TEST(ExecutorManagerTests, returnTheSameExecutorForTheSameDevice) {
     ASSERT_EQ(executor, executor2);
     ASSERT_EQ(2, _manager.getExecutorsNumber());
 }
+
+TEST(ExecutorManagerTests, reservationGetsRequestedThreadsWithoutBudget) {
+    ExecutorManagerImpl _manager;
+    auto reservation1 = _manager.reserveCPUThreads("net1", 8, 1);
+    auto reservation2 = _manager.reserveCPUThreads("net2", 8, 1);
+
+    ASSERT_EQ(8, reservation1->_threads);
+    ASSERT_EQ(8, reservation2->_threads);
+    ASSERT_EQ(2u, _manager.getCPUThreadsReservations().size());
+}
+
+TEST(ExecutorManagerTests, reservationsNeverExceedBudget) {
+    ExecutorManagerImpl _manager;
+    _manager.setCPUThreadsBudget(12);
+    auto reservation1 = _manager.reserveCPUThreads("net1", 4, 1);
+    auto reservation2 = _manager.reserveCPUThreads("net2", 8, 2);
+
+    ASSERT_EQ(4, reservation1->_threads);
+    // the weighted share is 12 * 2 / 3 = 8, but only 8 threads are free
+    ASSERT_EQ(8, reservation2->_threads);
+    ASSERT_THROW(_manager.reserveCPUThreads("net3", 8, 1), InferenceEngine::Exception);
+}
+
+TEST(ExecutorManagerTests, reservationGetsNoMoreThanWeightedShare) {
+    ExecutorManagerImpl _manager;
+    _manager.setCPUThreadsBudget(12);
+    auto reservation1 = _manager.reserveCPUThreads("net1", 2, 1);
+    auto reservation2 = _manager.reserveCPUThreads("net2", 12, 1);
+    auto reservation3 = _manager.reserveCPUThreads("net3", 12, 1);
+
+    ASSERT_EQ(2, reservation1->_threads);
+    ASSERT_EQ(6, reservation2->_threads);
+    ASSERT_EQ(4, reservation3->_threads);
+    int reserved = 0;
+    for (const auto& reservation : _manager.getCPUThreadsReservations())
+        reserved += reservation._threads;
+    ASSERT_EQ(12, reserved);
+}
+
+TEST(ExecutorManagerTests, releasedThreadsReturnToBudget) {
+    ExecutorManagerImpl _manager;
+    _manager.setCPUThreadsBudget(8);
+    auto reservation1 = _manager.reserveCPUThreads("net1", 4, 1);
+    auto reservation2 = _manager.reserveCPUThreads("net2", 8, 1);
+    ASSERT_EQ(4, reservation2->_threads);
+    ASSERT_THROW(_manager.reserveCPUThreads("net3", 8, 1), InferenceEngine::Exception);
+
+    reservation1.reset();
+    ASSERT_EQ(1u, _manager.getCPUThreadsReservations().size());
+
+    auto reservation3 = _manager.reserveCPUThreads("net3", 8, 1);
+    ASSERT_EQ(4, reservation3->_threads);
+}
+
+TEST(ExecutorManagerTests, reservationsOfSameNameAreDistinguished) {
+    ExecutorManagerImpl _manager;
+    auto reservation1 = _manager.reserveCPUThreads("net", 8, 1);
+    auto reservation2 = _manager.reserveCPUThreads("net", 8, 1);
+
+    ASSERT_NE(reservation1->_id, reservation2->_id);
+}
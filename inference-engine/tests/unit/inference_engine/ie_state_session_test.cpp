@@ -0,0 +1,63 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cpp/ie_state_session.hpp>
+#include <blob_factory.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class StateSessionTests : public ::testing::Test {
+protected:
+    static Blob::Ptr makeState(float value) {
+        auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, 4}, Layout::NC));
+        blob->allocate();
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), value);
+        return blob;
+    }
+
+    static float firstValue(const Blob::CPtr& blob) {
+        return blob->cbuffer().as<const float*>()[0];
+    }
+};
+
+TEST_F(StateSessionTests, throwsOnNotAllocatedStorage) {
+    auto blob = make_blob_with_precision(TensorDesc(Precision::FP32, {1, 4}, Layout::NC));
+    ASSERT_THROW(StateSession({{"state", blob}}), NotAllocated);
+}
+
+TEST_F(StateSessionTests, resetFillsStatesWithZeros) {
+    StateSession session({{"state", makeState(1.f)}});
+    session.Reset();
+    ASSERT_EQ(0.f, firstValue(session.GetState("state")));
+}
+
+TEST_F(StateSessionTests, throwsOnUnknownVariable) {
+    StateSession session({{"state", makeState(1.f)}});
+    ASSERT_THROW(session.GetState("unknown"), NotFound);
+}
+
+TEST_F(StateSessionTests, snapshotIsNotChangedWithSession) {
+    StateSession session({{"state", makeState(1.f)}});
+    auto snapshot = session.Snapshot();
+    session.Reset();
+    ASSERT_EQ(1.f, firstValue(snapshot.at("state")));
+
+    session.Restore(snapshot);
+    ASSERT_EQ(1.f, firstValue(session.GetState("state")));
+}
+
+TEST_F(StateSessionTests, throwsOnRestoreFromIncompatibleSnapshot) {
+    StateSession session({{"state", makeState(1.f)}});
+    ASSERT_THROW(session.Restore({{"other", makeState(2.f)}}), NotFound);
+    ASSERT_THROW(session.Restore({}), ParameterMismatch);
+
+    auto bigger = make_blob_with_precision(TensorDesc(Precision::FP32, {2, 4}, Layout::NC));
+    bigger->allocate();
+    ASSERT_THROW(session.Restore({{"state", bigger}}), ParameterMismatch);
+    ASSERT_EQ(1.f, firstValue(session.GetState("state")));
+}
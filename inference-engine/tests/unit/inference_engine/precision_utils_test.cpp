@@ -6,7 +6,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
 #include <limits>
+#include <random>
+#include <utility>
+#include <vector>
 
 using namespace InferenceEngine;
 
@@ -46,3 +50,49 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP16ToFP32ArraysMatchScalarConversion) {
+    // all FP16 values and a tail which is not a multiple of vector length
+    std::vector<short> src(0x10000 + 7);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<short>(i & 0xFFFF);
+    }
+
+    for (const auto& scaleBias : std::vector<std::pair<float, float>>{{1.0f, 0.0f}, {0.37f, -1.5f}}) {
+        std::vector<float> dst(src.size());
+        InferenceEngine::PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(),
+                                                        scaleBias.first, scaleBias.second);
+
+        for (size_t i = 0; i < src.size(); ++i) {
+            const float expected = InferenceEngine::PrecisionUtils::f16tof32(static_cast<ie_fp16>(src[i])) *
+                                   scaleBias.first + scaleBias.second;
+            ASSERT_EQ(0, std::memcmp(&expected, &dst[i], sizeof(float))) << "at index " << i;
+        }
+    }
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToFP16ArraysMatchScalarConversion) {
+    std::vector<float> src{0.0f, -0.0f, 1.0f, -1.0f, 65504.0f, 65519.0f, 65520.0f, -65520.0f,
+                           6.1e-5f, 3.0e-5f, 2.9e-5f, 1.0e-8f, -1.0e-8f, 0.333333f, 1.0e10f,
+                           std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                           std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::max(),
+                           std::numeric_limits<float>::lowest(), std::numeric_limits<float>::denorm_min()};
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-70000.0f, 70000.0f);
+    for (size_t i = 0; i < 200000; ++i) {
+        src.push_back(distribution(generator));
+        src.push_back(distribution(generator) * 1.0e-9f);
+    }
+
+    for (const auto& scaleBias : std::vector<std::pair<float, float>>{{1.0f, 0.0f}, {0.37f, -1.5f}}) {
+        std::vector<short> dst(src.size());
+        InferenceEngine::PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size(),
+                                                        scaleBias.first, scaleBias.second);
+
+        for (size_t i = 0; i < src.size(); ++i) {
+            const auto expected = InferenceEngine::PrecisionUtils::f32tof16(src[i] * scaleBias.first + scaleBias.second);
+            ASSERT_EQ(expected, static_cast<ie_fp16>(dst[i])) << "at index " << i << " for value " << src[i];
+        }
+    }
+}
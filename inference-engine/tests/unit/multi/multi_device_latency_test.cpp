@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include <multi-device/multi_device_config.hpp>
+
+#include "multi_device_exec_network.hpp"
+
+using namespace MultiDevicePlugin;
+using DeviceStatistics = MultiDeviceExecutableNetwork::DeviceStatistics;
+using std::chrono::microseconds;
+
+TEST(MultiDeviceStatisticsTest, idleDeviceCompletesInServiceTime) {
+    DeviceStatistics statistics{2};
+    ASSERT_EQ(microseconds::zero(), statistics.ExpectedCompletionTime());
+    statistics.UpdateServiceTime(microseconds{1000});
+    statistics._busyRequests = 1;
+    ASSERT_EQ(microseconds{1000}, statistics.ExpectedCompletionTime());
+}
+
+TEST(MultiDeviceStatisticsTest, firstSampleInitializesServiceTime) {
+    DeviceStatistics statistics{1};
+    statistics.UpdateServiceTime(microseconds{800});
+    ASSERT_EQ(800u, statistics._serviceTime.load());
+    statistics.UpdateServiceTime(microseconds{1600});
+    ASSERT_EQ(900u, statistics._serviceTime.load());
+}
+
+TEST(MultiDeviceStatisticsTest, zeroSampleMarksDeviceAsMeasured) {
+    DeviceStatistics statistics{1};
+    statistics.UpdateServiceTime(microseconds::zero());
+    ASSERT_NE(0u, statistics._serviceTime.load());
+    statistics._busyRequests = 1;
+    ASSERT_NE(microseconds::max(), statistics.ExpectedCompletionTime());
+}
+
+TEST(MultiDeviceStatisticsTest, waitingRequestsAddShareOfServiceTime) {
+    DeviceStatistics statistics{2};
+    statistics.UpdateServiceTime(microseconds{1000});
+    statistics._busyRequests = 2;
+    // the new request waits for one of two parallel requests
+    ASSERT_EQ(microseconds{1500}, statistics.ExpectedCompletionTime());
+    statistics._queuedTasks = 2;
+    ASSERT_EQ(microseconds{2500}, statistics.ExpectedCompletionTime());
+}
+
+TEST(MultiDeviceStatisticsTest, unmeasuredLoadedDeviceIsNotExpectedToComplete) {
+    DeviceStatistics statistics{1};
+    statistics._busyRequests = 1;
+    ASSERT_EQ(microseconds::max(), statistics.ExpectedCompletionTime());
+}
+
+class MultiDeviceSelectByLatencyTest : public ::testing::Test {
+protected:
+    void CreateNetwork(const std::string& deadline = "") {
+        std::unordered_map<std::string, InferenceEngine::Parameter> config = {
+            {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+             std::string{InferenceEngine::MultiDeviceConfigParams::MULTI_LATENCY}}};
+        if (!deadline.empty()) {
+            config[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_REQUEST_DEADLINE] = deadline;
+        }
+        network = std::make_shared<MultiDeviceExecutableNetwork>(
+            DeviceMap<InferenceEngine::ExecutableNetwork>{}, devices, config);
+        for (auto&& device : devices) {
+            network->_deviceStatistics[device.deviceName].reset(new DeviceStatistics{1});
+        }
+    }
+
+    // sets the measured service time and the number of busy requests of the device
+    void SetLoad(const std::string& device, std::uint64_t serviceTime, int busyRequests) {
+        auto& statistics = *network->_deviceStatistics.at(device);
+        statistics._serviceTime = serviceTime;
+        statistics._busyRequests = busyRequests;
+    }
+
+    std::string Select() const {
+        return network->SelectDeviceByLatency(devices, network->_requestDeadline);
+    }
+
+    std::string Select(const InferenceEngine::TaskScheduling& scheduling) const {
+        return network->SelectDeviceByLatency(devices, network->TimeToDeadline(scheduling));
+    }
+
+    std::vector<DeviceInformation> devices = {{"A", {}, 1}, {"B", {}, 1}};
+    std::shared_ptr<MultiDeviceExecutableNetwork> network;
+};
+
+TEST_F(MultiDeviceSelectByLatencyTest, selectsEarliestCompletion) {
+    CreateNetwork();
+    SetLoad("A", 1000, 1);
+    SetLoad("B", 1200, 0);
+    ASSERT_EQ("B", Select());
+    SetLoad("B", 2500, 0);
+    ASSERT_EQ("A", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, tieIsResolvedByPriority) {
+    CreateNetwork();
+    ASSERT_EQ("A", Select());
+    SetLoad("A", 1000, 0);
+    SetLoad("B", 1000, 0);
+    ASSERT_EQ("A", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, idleUnmeasuredDeviceIsTried) {
+    CreateNetwork();
+    SetLoad("A", 1000, 1);
+    SetLoad("B", 0, 0);
+    ASSERT_EQ("B", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, loadedUnmeasuredDeviceIsAvoided) {
+    CreateNetwork();
+    SetLoad("A", 0, 1);
+    SetLoad("B", 5000, 1);
+    ASSERT_EQ("B", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, firstDeviceMeetingDeadlineIsPreferred) {
+    CreateNetwork("5000");
+    SetLoad("A", 3000, 0);
+    SetLoad("B", 1000, 0);
+    ASSERT_EQ("A", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, deviceMissingDeadlineIsSkipped) {
+    CreateNetwork("2000");
+    SetLoad("A", 3000, 0);
+    SetLoad("B", 1000, 0);
+    ASSERT_EQ("B", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, earliestDeviceIsSelectedIfNoneMeetsDeadline) {
+    CreateNetwork("1000");
+    SetLoad("A", 3000, 0);
+    SetLoad("B", 4000, 0);
+    ASSERT_EQ("A", Select());
+    SetLoad("A", 3000, 1);
+    ASSERT_EQ("B", Select());
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, requestDeadlineOverridesNetworkDeadline) {
+    CreateNetwork("2000");
+    SetLoad("A", 3000, 0);
+    SetLoad("B", 1000, 0);
+    InferenceEngine::TaskScheduling scheduling;
+    // without the request deadline the network one is used
+    ASSERT_EQ(microseconds{2000}, network->TimeToDeadline(scheduling));
+    ASSERT_EQ("B", Select(scheduling));
+    scheduling.deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    ASSERT_EQ("A", Select(scheduling));
+}
+
+TEST_F(MultiDeviceSelectByLatencyTest, missedRequestDeadlineSelectsEarliestDevice) {
+    CreateNetwork();
+    SetLoad("A", 3000, 0);
+    SetLoad("B", 1000, 0);
+    InferenceEngine::TaskScheduling scheduling;
+    scheduling.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds{1};
+    ASSERT_EQ(microseconds{1}, network->TimeToDeadline(scheduling));
+    ASSERT_EQ("B", Select(scheduling));
+}
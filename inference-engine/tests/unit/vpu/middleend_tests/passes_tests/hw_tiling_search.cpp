@@ -0,0 +1,98 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+#include <vpu/middleend/hw/utility.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+using namespace vpu;
+
+class VPU_HwTilingSearchTest : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static HWTilingNS::ConvolutionOptions convolutionOptions(const std::string& name, int size, int channels) {
+        DimValues inputDims;
+        inputDims.set(Dim::W, size);
+        inputDims.set(Dim::H, size);
+        inputDims.set(Dim::C, channels);
+        inputDims.set(Dim::N, 1);
+
+        // 3x3 kernel with unit stride and paddings keeps the plane size
+        return HWTilingNS::ConvolutionOptions{name, inputDims, inputDims, inputDims, 3, 3, 1, 1, 1, 1, 1, false};
+    }
+
+    static std::shared_ptr<const HWTilingNS::HWConvolutionTiler> findTiler(
+            const HWTilingNS::ConvolutionOptions& options) {
+        return std::make_shared<const HWTilingNS::HWConvolutionTiler>(
+            options, HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+    }
+};
+
+TEST_F(VPU_HwTilingSearchTest, StagesWithSameGeometryShareTiler) {
+    const std::vector<HWTilingNS::ConvolutionOptions> stagesOptions{
+        convolutionOptions("conv1", 56, 256),
+        convolutionOptions("conv2", 56, 256),
+        convolutionOptions("conv3", 28, 512),
+        convolutionOptions("conv4", 56, 256),
+    };
+
+    const auto tilers = HWTilingNS::findTilers<HWTilingNS::HWConvolutionTiler>(stagesOptions, findTiler);
+
+    ASSERT_EQ(tilers.first.size(), stagesOptions.size());
+    EXPECT_EQ(tilers.second, 2u);
+
+    EXPECT_EQ(tilers.first[0], tilers.first[1]);
+    EXPECT_EQ(tilers.first[0], tilers.first[3]);
+    EXPECT_NE(tilers.first[0], tilers.first[2]);
+
+    for (size_t stageInd = 0; stageInd < stagesOptions.size(); ++stageInd) {
+        const auto expected = findTiler(stagesOptions[stageInd]);
+        const auto& actual = tilers.first[stageInd];
+
+        ASSERT_EQ(actual->isTilingPossible(), expected->isTilingPossible());
+        if (!expected->isTilingPossible()) {
+            continue;
+        }
+
+        ASSERT_EQ(actual->getHwTilings().size(), expected->getHwTilings().size());
+        for (size_t tilingInd = 0; tilingInd < expected->getHwTilings().size(); ++tilingInd) {
+            const auto& actualTiling = actual->getHwTilings()[tilingInd];
+            const auto& expectedTiling = expected->getHwTilings()[tilingInd];
+
+            EXPECT_EQ(actualTiling->sohTiles, expectedTiling->sohTiles);
+            EXPECT_EQ(actualTiling->sowTiles, expectedTiling->sowTiles);
+            EXPECT_EQ(actualTiling->socTiles, expectedTiling->socTiles);
+        }
+    }
+}
+
+TEST_F(VPU_HwTilingSearchTest, WorkersSeeCompileEnv) {
+    const auto env = CompileEnv::getOrNull();
+    std::atomic<int> numMatched{0};
+
+    parallelTilingSearch(64, [&](int) {
+        if (CompileEnv::getOrNull() == env) {
+            ++numMatched;
+        }
+    });
+
+    EXPECT_EQ(numMatched.load(), 64);
+    EXPECT_EQ(CompileEnv::getOrNull(), env);
+}
+
+TEST_F(VPU_HwTilingSearchTest, ExceptionIsRethrown) {
+    EXPECT_THROW(parallelTilingSearch(16, [](int ind) {
+        if (ind == 7) {
+            throw std::runtime_error("tiling failed");
+        }
+    }), std::runtime_error);
+}
@@ -31,6 +31,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -469,17 +470,22 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        struct Provenance;
+        Provenance& get_provenance();
+
+        // The size and layout of Node differ from the versions which kept descriptors in std::deque and had
+        // m_node_type member, so binaries derived from Node (e.g. extensions) must be rebuilt with this header
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // Provenance is rarely used, so it is allocated on the first modification
+        std::shared_ptr<Provenance> m_provenance;
+        // Most nodes have one or two inputs and a single output, they are kept inside the node
+        StableVector<descriptor::Input, 2> m_inputs;
+        StableVector<descriptor::Output, 1> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -0,0 +1,208 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ngraph
+{
+    /// \brief Sequence container which never moves its elements, like std::deque, but keeps
+    ///        the first N elements inside the container object.
+    ///
+    /// Elements are only appended, so references to them stay valid while the container
+    /// lives. Node inputs and outputs point to each other, so they need stable addresses,
+    /// while most nodes have one or two of them and an empty std::deque already allocates
+    /// several hundred bytes.
+    template <typename T, size_t N>
+    class StableVector
+    {
+    public:
+        template <typename Container, typename Value>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+            Iterator(Container* container, size_t index)
+                : m_container(container)
+                , m_index(index)
+            {
+            }
+
+            reference operator*() const { return (*m_container)[m_index]; }
+            pointer operator->() const { return &(*m_container)[m_index]; }
+            reference operator[](difference_type n) const { return (*m_container)[m_index + n]; }
+            Iterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator result = *this;
+                ++m_index;
+                return result;
+            }
+            Iterator& operator--()
+            {
+                --m_index;
+                return *this;
+            }
+            Iterator operator--(int)
+            {
+                Iterator result = *this;
+                --m_index;
+                return result;
+            }
+            Iterator& operator+=(difference_type n)
+            {
+                m_index += n;
+                return *this;
+            }
+            Iterator& operator-=(difference_type n)
+            {
+                m_index -= n;
+                return *this;
+            }
+            Iterator operator+(difference_type n) const
+            {
+                return Iterator(m_container, m_index + n);
+            }
+            Iterator operator-(difference_type n) const
+            {
+                return Iterator(m_container, m_index - n);
+            }
+            difference_type operator-(const Iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) -
+                       static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const Iterator& other) const { return m_index < other.m_index; }
+            bool operator>(const Iterator& other) const { return m_index > other.m_index; }
+            bool operator<=(const Iterator& other) const { return m_index <= other.m_index; }
+            bool operator>=(const Iterator& other) const { return m_index >= other.m_index; }
+
+        private:
+            Container* m_container = nullptr;
+            size_t m_index = 0;
+        };
+
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<StableVector, T>;
+        using const_iterator = Iterator<const StableVector, const T>;
+
+        StableVector() = default;
+        StableVector(const StableVector& other)
+        {
+            for (const auto& value : other)
+            {
+                emplace_back(value);
+            }
+        }
+        StableVector& operator=(const StableVector& other)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto& value : other)
+                {
+                    emplace_back(value);
+                }
+            }
+            return *this;
+        }
+        ~StableVector() { clear(); }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        T& operator[](size_t i) { return i < N ? local(i) : (*m_overflow)[i - N]; }
+        const T& operator[](size_t i) const { return i < N ? local(i) : (*m_overflow)[i - N]; }
+        T& at(size_t i)
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+        const T& at(size_t i) const
+        {
+            check_range(i);
+            return (*this)[i];
+        }
+        T& front() { return (*this)[0]; }
+        const T& front() const { return (*this)[0]; }
+        T& back() { return (*this)[m_size - 1]; }
+        const T& back() const { return (*this)[m_size - 1]; }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_size); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_size); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size < N)
+            {
+                new (&m_local[m_size]) T(std::forward<Args>(args)...);
+            }
+            else
+            {
+                if (!m_overflow)
+                {
+                    m_overflow.reset(new std::deque<T>());
+                }
+                m_overflow->emplace_back(std::forward<Args>(args)...);
+            }
+            return (*this)[m_size++];
+        }
+        void push_back(const T& value) { emplace_back(value); }
+        void push_back(T&& value) { emplace_back(std::move(value)); }
+
+        void clear()
+        {
+            m_overflow.reset();
+            for (size_t i = std::min(m_size, N); i > 0; --i)
+            {
+                local(i - 1).~T();
+            }
+            m_size = 0;
+        }
+
+    private:
+        T& local(size_t i) { return *reinterpret_cast<T*>(&m_local[i]); }
+        const T& local(size_t i) const { return *reinterpret_cast<const T*>(&m_local[i]); }
+        void check_range(size_t i) const
+        {
+            if (i >= m_size)
+            {
+                throw std::out_of_range("StableVector index is out of range");
+            }
+        }
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_local[N];
+        size_t m_size = 0;
+        std::unique_ptr<std::deque<T>> m_overflow;
+    };
+}
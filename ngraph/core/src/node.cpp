@@ -22,15 +22,28 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+struct Node::Provenance
+{
+    unordered_set<string> tags;
+    set<shared_ptr<Node>> group;
+};
+
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance = make_shared<Provenance>();
+    }
+    return *m_provenance;
+}
+
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? make_shared<Provenance>(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -50,8 +63,8 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance =
+        node.m_provenance ? make_shared<Provenance>(*node.m_provenance) : nullptr;
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -296,12 +309,15 @@ void Node::set_friendly_name(const string& name)
 
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -320,7 +336,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_provenance ? m_provenance->group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -352,7 +369,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -390,13 +407,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty;
+    return m_provenance ? m_provenance->tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.tags.insert(tag);
+    for (auto node : provenance.group)
     {
         node->add_provenance_tag(tag);
     }
@@ -404,7 +423,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/util.hpp"
+#include "misc.hpp"
 #include "runtime/backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -46,3 +47,54 @@ TEST(backend_api, DISABLED_config_unsupported)
     EXPECT_FALSE(backend->set_config(config, error));
     EXPECT_FALSE(error == "");
 }
+
+namespace
+{
+    // Computes a graph with parallel branches and a tensor reused across calls
+    vector<float> run_branches(const shared_ptr<runtime::Backend>& backend, size_t calls)
+    {
+        Shape shape{2, 3};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto sum = make_shared<op::v1::Add>(a, b);
+        auto product = make_shared<op::v1::Multiply>(a, b);
+        auto difference = make_shared<op::v1::Subtract>(sum, product);
+        auto scale = op::Constant::create(element::f32, Shape{}, {2.f});
+        auto scaled = make_shared<op::v1::Multiply>(difference, scale);
+        auto result = make_shared<op::v1::Add>(scaled, make_shared<op::v0::Relu>(sum));
+        auto f = make_shared<Function>(result, ParameterVector{a, b});
+
+        auto handle = backend->compile(f);
+        auto x = backend->create_tensor(element::f32, shape);
+        auto y = backend->create_tensor(element::f32, shape);
+        auto out = backend->create_tensor(element::f32, shape);
+        vector<float> values;
+        for (size_t i = 0; i < calls; ++i)
+        {
+            auto shift = static_cast<float>(i);
+            copy_data(x, vector<float>{1 + shift, -2, 3, -4, 5, -6});
+            copy_data(y, vector<float>{0.5f, 1, -1.5f, 2 + shift, 2.5f, 3});
+            handle->call_with_validate({out}, {x, y});
+            auto output = read_vector<float>(out);
+            values.insert(values.end(), output.begin(), output.end());
+        }
+        return values;
+    }
+}
+
+TEST(backend_api, interpreter_memory_plan)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto planned = run_branches(backend, 3);
+
+    set_environment("NGRAPH_INTERPRETER_THREADS", "4", 1);
+    auto parallel = run_branches(backend, 3);
+    unset_environment("NGRAPH_INTERPRETER_THREADS");
+
+    set_environment("NGRAPH_INTERPRETER_ALLOCATE_PER_CALL", "1", 1);
+    auto allocated = run_branches(backend, 3);
+    unset_environment("NGRAPH_INTERPRETER_ALLOCATE_PER_CALL");
+
+    EXPECT_EQ(allocated, planned);
+    EXPECT_EQ(allocated, parallel);
+}
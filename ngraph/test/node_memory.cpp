@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset7.hpp"
+
+#include <memory>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    size_t allocated_bytes()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+        return static_cast<size_t>(static_cast<unsigned>(mallinfo().uordblks));
+#else
+        return 0;
+#endif
+    }
+}
+
+// Heap memory used by a node of a long chain is compared with the parts every node needs: the node object and
+// its output tensor. Storage of input and output descriptors must not add allocations comparable to them.
+TEST(node_memory, bytes_per_node)
+{
+    const size_t nodes = 100000;
+
+    vector<shared_ptr<descriptor::Tensor>> tensors;
+    tensors.reserve(nodes);
+    auto before = allocated_bytes();
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        tensors.push_back(make_shared<descriptor::Tensor>(element::f32, PartialShape{1, 16}, ""));
+    }
+    auto after = allocated_bytes();
+    tensors.clear();
+    if (before == 0 || after <= before)
+    {
+        // allocator statistics are not available
+        return;
+    }
+    auto baseline = sizeof(opset7::Relu) + (after - before) / nodes;
+
+    before = allocated_bytes();
+    shared_ptr<Function> function;
+    {
+        auto parameter = make_shared<opset7::Parameter>(element::f32, Shape{1, 16});
+        Output<Node> last = parameter;
+        for (size_t i = 0; i < nodes; ++i)
+        {
+            last = make_shared<opset7::Relu>(last);
+        }
+        function = make_shared<Function>(OutputVector{last}, ParameterVector{parameter});
+    }
+    after = allocated_bytes();
+    auto per_node = (after - before) / nodes;
+    // connected nodes also keep lists of consumers and inferred shapes, which are smaller than the baseline
+    EXPECT_LT(per_node, 2 * baseline) << "heap bytes per node: " << per_node << ", baseline: " << baseline;
+}
@@ -3,9 +3,17 @@
 //
 
 #include "int_executable.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
+#include <functional>
+#include <map>
+#include <thread>
 #include "backend_manager.hpp"
 #include "evaluates_map.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/type/bfloat16.hpp"
@@ -17,6 +25,112 @@ using namespace ngraph;
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
+/// \brief Persistent threads running independent ops of one schedule group
+class runtime::interpreter::INTExecutable::WorkerPool
+{
+public:
+    explicit WorkerPool(size_t threads)
+    {
+        for (size_t i = 1; i < threads; ++i)
+        {
+            m_threads.emplace_back([this] { work(); });
+        }
+    }
+
+    ~WorkerPool()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    /// Runs task(i) for every i in [0, count) on the pool and the calling thread
+    void run(size_t count, const function<void(size_t)>& task)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_task = &task;
+            m_count = count;
+            m_next = 0;
+            m_pending = m_threads.size();
+            m_error = nullptr;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+        run_tasks();
+        unique_lock<mutex> lock(m_mutex);
+        m_done.wait(lock, [this] { return m_pending == 0; });
+        m_task = nullptr;
+        if (m_error)
+        {
+            rethrow_exception(m_error);
+        }
+    }
+
+private:
+    void run_tasks()
+    {
+        for (size_t i = m_next.fetch_add(1); i < m_count; i = m_next.fetch_add(1))
+        {
+            try
+            {
+                (*m_task)(i);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = current_exception();
+                }
+            }
+        }
+    }
+
+    void work()
+    {
+        size_t generation = 0;
+        for (;;)
+        {
+            {
+                unique_lock<mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stop || m_generation != generation; });
+                if (m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+            }
+            run_tasks();
+            {
+                lock_guard<mutex> lock(m_mutex);
+                if (--m_pending == 0)
+                {
+                    m_done.notify_all();
+                }
+            }
+        }
+    }
+
+    vector<thread> m_threads;
+    mutex m_mutex;
+    condition_variable m_wake;
+    condition_variable m_done;
+    const function<void(size_t)>* m_task = nullptr;
+    size_t m_count = 0;
+    atomic<size_t> m_next{0};
+    size_t m_pending = 0;
+    size_t m_generation = 0;
+    bool m_stop = false;
+    exception_ptr m_error;
+};
+
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
                                                    bool enable_performance_collection)
     : m_is_compiled{true}
@@ -28,10 +142,323 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    m_allocate_per_call = getenv_bool("NGRAPH_INTERPRETER_ALLOCATE_PER_CALL");
+    if (!m_allocate_per_call)
+    {
+        auto threads = getenv_int("NGRAPH_INTERPRETER_THREADS", 1);
+        if (threads > 1)
+        {
+            m_workers.reset(new WorkerPool(static_cast<size_t>(threads)));
+        }
+        plan();
+    }
+}
+
+runtime::interpreter::INTExecutable::~INTExecutable() = default;
+
+void runtime::interpreter::INTExecutable::plan()
+{
+    // Ops are grouped into steps: a step per op, or a step per graph level if ops run in parallel
+    const bool parallel = m_workers != nullptr;
+    unordered_map<Node*, size_t> step_of;
+    vector<shared_ptr<Node>> ops;
+    for (const auto& op : m_nodes)
+    {
+        if (op::is_parameter(op) || op::is_constant(op))
+        {
+            continue;
+        }
+        size_t step = ops.size();
+        if (parallel)
+        {
+            step = 0;
+            auto update = [&](Node* dependency) {
+                auto it = step_of.find(dependency);
+                if (it != step_of.end())
+                {
+                    step = max(step, it->second + 1);
+                }
+            };
+            for (const auto& input : op->inputs())
+            {
+                update(input.get_source_output().get_node());
+            }
+            for (const auto& dependency : op->get_control_dependencies())
+            {
+                update(dependency.get());
+            }
+        }
+        step_of[op.get()] = step;
+        ops.push_back(op);
+    }
+    stable_sort(ops.begin(), ops.end(), [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+        return step_of[a.get()] < step_of[b.get()];
+    });
+
+    const auto& evaluators = get_evaluators_map();
+    unordered_map<descriptor::Tensor*, vector<TensorUse>> uses;
+    m_steps.resize(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        auto& step = m_steps[i];
+        step.node = ops[i];
+        auto it = evaluators.find(step.node->get_type_info());
+        step.evaluator = it != evaluators.end() ? &it->second : nullptr;
+        step.inputs.resize(step.node->get_input_size());
+        step.outputs.resize(step.node->get_output_size());
+        if (m_performance_counters_enabled)
+        {
+            step.timer = &m_timer_map[step.node];
+        }
+        for (size_t j = 0; j < step.inputs.size(); ++j)
+        {
+            uses[&step.node->get_input_tensor(j)].push_back({i, false, j});
+        }
+        for (size_t j = 0; j < step.outputs.size(); ++j)
+        {
+            uses[&step.node->get_output_tensor(j)].push_back({i, true, j});
+        }
+        if (i == 0 || step_of[ops[i - 1].get()] != step_of[ops[i].get()])
+        {
+            m_groups.push_back(i);
+        }
+    }
+    m_groups.push_back(m_steps.size());
+
+    for (const auto& parameter : get_parameters())
+    {
+        for (size_t i = 0; i < parameter->get_output_size(); ++i)
+        {
+            m_parameter_uses.push_back(move(uses[&parameter->get_output_tensor(i)]));
+        }
+    }
+    for (const auto& result : get_results())
+    {
+        m_result_uses.push_back(move(uses[&result->get_output_tensor(0)]));
+    }
+
+    // Constants are read in place
+    for (const auto& node : m_nodes)
+    {
+        if (auto constant = as_type_ptr<op::Constant>(node))
+        {
+            auto tensor = make_shared<HostTensor>(constant->get_element_type(),
+                                                  constant->get_shape(),
+                                                  const_cast<void*>(constant->get_data_ptr()));
+            bind(uses[&constant->get_output_tensor(0)], tensor);
+        }
+    }
+
+    // Offsets of op outputs with static shapes: a buffer is released after the group of its last
+    // consumer and can be taken by outputs of the following groups
+    static const size_t alignment = 64;
+    struct Planned
+    {
+        Output<Node> output;
+        size_t size;
+        size_t offset;
+    };
+    vector<Planned> planned;
+    map<size_t, vector<size_t>> released_after;
+    map<size_t, size_t> free_blocks;
+    size_t total_size = 0;
+    auto allocate = [&](size_t size) {
+        auto best = free_blocks.end();
+        for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it)
+        {
+            if (it->second >= size && (best == free_blocks.end() || it->second < best->second))
+            {
+                best = it;
+            }
+        }
+        if (best == free_blocks.end())
+        {
+            auto last = free_blocks.empty() ? free_blocks.end() : prev(free_blocks.end());
+            if (last != free_blocks.end() && last->first + last->second == total_size)
+            {
+                // grow the block at the end of the buffer
+                auto offset = last->first;
+                total_size = offset + size;
+                free_blocks.erase(last);
+                return offset;
+            }
+            auto offset = total_size;
+            total_size += size;
+            return offset;
+        }
+        auto offset = best->first;
+        auto rest = best->second - size;
+        free_blocks.erase(best);
+        if (rest > 0)
+        {
+            free_blocks[offset + size] = rest;
+        }
+        return offset;
+    };
+    auto release = [&](size_t offset, size_t size) {
+        auto it = free_blocks.emplace(offset, size).first;
+        auto next = std::next(it);
+        if (next != free_blocks.end() && it->first + it->second == next->first)
+        {
+            it->second += next->second;
+            free_blocks.erase(next);
+        }
+        if (it != free_blocks.begin())
+        {
+            auto previous = std::prev(it);
+            if (previous->first + previous->second == it->first)
+            {
+                previous->second += it->second;
+                free_blocks.erase(it);
+            }
+        }
+    };
+    for (size_t group = 0; group + 1 < m_groups.size(); ++group)
+    {
+        for (size_t i = m_groups[group]; i < m_groups[group + 1]; ++i)
+        {
+            const auto& node = m_steps[i].node;
+            if (op::is_output(node))
+            {
+                continue;
+            }
+            for (const auto& output : node->outputs())
+            {
+                auto& output_uses = uses[&output.get_tensor()];
+                if (output.get_partial_shape().is_dynamic() ||
+                    output.get_element_type().is_dynamic())
+                {
+                    m_dynamic_tensors.emplace_back(output, move(output_uses));
+                    continue;
+                }
+                size_t last_group = group;
+                for (const auto& use : output_uses)
+                {
+                    auto use_group = upper_bound(m_groups.begin(), m_groups.end(), use.step) -
+                                     m_groups.begin() - 1;
+                    last_group = max(last_group, static_cast<size_t>(use_group));
+                }
+                size_t size = shape_size(output.get_shape()) * output.get_element_type().size();
+                size = max<size_t>((size + alignment - 1) / alignment * alignment, alignment);
+                released_after[last_group].push_back(planned.size());
+                planned.push_back({output, size, allocate(size)});
+            }
+        }
+        for (auto index : released_after[group])
+        {
+            release(planned[index].offset, planned[index].size);
+        }
+    }
+
+    m_memory = make_shared<runtime::AlignedBuffer>(max<size_t>(total_size, 1), alignment);
+    for (const auto& tensor : planned)
+    {
+        bind(uses[&tensor.output.get_tensor()],
+             make_shared<HostTensor>(tensor.output.get_element_type(),
+                                     tensor.output.get_shape(),
+                                     m_memory->get_ptr<char>() + tensor.offset));
+    }
+}
+
+void runtime::interpreter::INTExecutable::bind(const vector<TensorUse>& uses,
+                                               const shared_ptr<HostTensor>& tensor)
+{
+    for (const auto& use : uses)
+    {
+        auto& step = m_steps[use.step];
+        (use.is_output ? step.outputs : step.inputs)[use.port] = tensor;
+    }
+}
+
+void runtime::interpreter::INTExecutable::execute(Step& step)
+{
+    if (step.timer)
+    {
+        step.timer->start();
+    }
+    if (!step.node->evaluate(step.outputs, step.inputs))
+    {
+        if (!step.evaluator)
+        {
+            throw unsupported_op(
+                std::string("Interpreter backend doesn't implement evaluate method for OP ") +
+                step.node->get_type_info().name);
+        }
+        if (!(*step.evaluator)(step.node, step.outputs, step.inputs))
+        {
+            throw ngraph_error(std::string("Running evaluate method for OP ") +
+                               step.node->get_type_info().name + std::string(" failed!"));
+        }
+    }
+    if (step.timer)
+    {
+        step.timer->stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(step.outputs, step.node.get());
+    }
 }
 
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    if (m_allocate_per_call)
+    {
+        return call_with_allocation(outputs, inputs);
+    }
+
+    lock_guard<mutex> lock(m_call_mutex);
+    for (size_t i = 0; i < m_parameter_uses.size(); ++i)
+    {
+        auto host_tensor = static_pointer_cast<runtime::HostTensor>(inputs[i]);
+        if (m_nan_check_enabled)
+        {
+            perform_nan_check({host_tensor});
+        }
+        bind(m_parameter_uses[i], host_tensor);
+    }
+    for (size_t i = 0; i < m_result_uses.size(); ++i)
+    {
+        bind(m_result_uses[i], static_pointer_cast<runtime::HostTensor>(outputs[i]));
+    }
+    for (const auto& tensor : m_dynamic_tensors)
+    {
+        bind(tensor.second, make_shared<HostTensor>(tensor.first));
+    }
+
+    for (size_t group = 0; group + 1 < m_groups.size(); ++group)
+    {
+        auto begin = m_groups[group];
+        auto count = m_groups[group + 1] - begin;
+        if (count == 1 || !m_workers)
+        {
+            for (size_t i = begin; i < begin + count; ++i)
+            {
+                execute(m_steps[i]);
+            }
+        }
+        else
+        {
+            m_workers->run(count, [&](size_t i) { execute(m_steps[begin + i]); });
+        }
+    }
+
+    // user tensors are not kept after the call
+    for (const auto& uses : m_parameter_uses)
+    {
+        bind(uses, nullptr);
+    }
+    for (const auto& uses : m_result_uses)
+    {
+        bind(uses, nullptr);
+    }
+    return true;
+}
+
+bool runtime::interpreter::INTExecutable::call_with_allocation(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
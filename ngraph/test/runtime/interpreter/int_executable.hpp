@@ -7,12 +7,14 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <ngraph/runtime/host_tensor.hpp>
 #include "backend.hpp"
+#include "evaluates_map.hpp"
 #include "int_backend_visibility.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
@@ -40,9 +42,15 @@ class INTERPRETER_BACKEND_API ngraph::runtime::interpreter::INTExecutable : publ
     friend class INTBackend;
 
 public:
+    /// Intermediate tensors are planned once: tensors with static shapes get offsets in a
+    /// single buffer, which is reused by tensors with disjoint lifetimes and across calls.
+    /// NGRAPH_INTERPRETER_ALLOCATE_PER_CALL=1 restores allocation of every tensor on each call.
+    /// NGRAPH_INTERPRETER_THREADS=N runs independent ops on N threads.
     INTExecutable(const std::shared_ptr<Function>& function,
                   bool enable_performance_collection = false);
 
+    ~INTExecutable() override;
+
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& inputs) override;
 
@@ -66,6 +74,43 @@ protected:
     bool evaluate_node(const std::shared_ptr<Node>& node,
                        const HostTensorVector& outputs,
                        const HostTensorVector& inputs) const;
+
+    class WorkerPool;
+
+    // Position of a tensor in the schedule
+    struct TensorUse
+    {
+        size_t step;
+        bool is_output;
+        size_t port;
+    };
+
+    struct Step
+    {
+        std::shared_ptr<Node> node;
+        const EvaluatorsMap::mapped_type* evaluator = nullptr;
+        HostTensorVector inputs;
+        HostTensorVector outputs;
+        stopwatch* timer = nullptr;
+    };
+
+    void plan();
+    bool call_with_allocation(const std::vector<std::shared_ptr<Tensor>>& outputs,
+                              const std::vector<std::shared_ptr<Tensor>>& inputs);
+    void bind(const std::vector<TensorUse>& uses, const std::shared_ptr<HostTensor>& tensor);
+    void execute(Step& step);
+
+    bool m_allocate_per_call = false;
+    // Steps ordered for execution, m_groups are bounds of steps which may run concurrently
+    std::vector<Step> m_steps;
+    std::vector<size_t> m_groups;
+    // Uses of tensors which are bound on every call
+    std::vector<std::vector<TensorUse>> m_parameter_uses;
+    std::vector<std::vector<TensorUse>> m_result_uses;
+    std::vector<std::pair<Output<Node>, std::vector<TensorUse>>> m_dynamic_tensors;
+    std::shared_ptr<runtime::AlignedBuffer> m_memory;
+    std::unique_ptr<WorkerPool> m_workers;
+    std::mutex m_call_mutex;
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset7.hpp"
+#include "ngraph/stable_vector.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace ngraph;
+
+TEST(stable_vector, elements_are_not_moved)
+{
+    StableVector<string, 2> values;
+    vector<const string*> addresses;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        addresses.push_back(&values.emplace_back(to_string(i)));
+    }
+    ASSERT_EQ(100, values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(addresses[i], &values[i]);
+        EXPECT_EQ(to_string(i), values.at(i));
+    }
+    EXPECT_THROW(values.at(100), out_of_range);
+}
+
+TEST(stable_vector, copy_and_iterate)
+{
+    StableVector<int, 2> values;
+    for (int i = 0; i < 5; ++i)
+    {
+        values.push_back(i);
+    }
+    StableVector<int, 2> copy;
+    copy.push_back(42);
+    copy = values;
+    ASSERT_EQ(values.size(), copy.size());
+    int expected = 0;
+    for (auto value : copy)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+    EXPECT_EQ(5, copy.end() - copy.begin());
+    EXPECT_EQ(4, copy.back());
+    copy.clear();
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST(stable_vector, node_with_many_inputs_and_outputs)
+{
+    OutputVector inputs;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        inputs.push_back(make_shared<opset7::Parameter>(element::f32, Shape{1, 2}));
+    }
+    auto concat = make_shared<opset7::Concat>(inputs, 0);
+    auto axis = opset7::Constant::create(element::i64, Shape{}, {0});
+    auto split = make_shared<opset7::Split>(concat, axis, 5);
+    ASSERT_EQ(10, concat->get_input_size());
+    ASSERT_EQ(5, split->get_output_size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        EXPECT_EQ(inputs[i], concat->input_value(i));
+        EXPECT_EQ(1, inputs[i].get_target_inputs().size());
+    }
+
+    auto clone = concat->clone_with_new_inputs(concat->input_values());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        EXPECT_EQ(inputs[i], clone->input_value(i));
+        EXPECT_EQ(2, inputs[i].get_target_inputs().size());
+    }
+    clone.reset();
+    for (auto& output : split->outputs())
+    {
+        EXPECT_EQ(Shape({2, 2}), output.get_shape());
+    }
+}